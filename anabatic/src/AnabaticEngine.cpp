@@ -14,6 +14,7 @@
 // +-----------------------------------------------------------------+
 
 
+#include <algorithm>
 #include <sstream>
 #include <iostream>
 #include "hurricane/Bug.h"
@@ -422,6 +423,8 @@ namespace Anabatic {
     , _state            (EngineCreation)
     , _matrix           ()
     , _gcells           ()
+    , _dirtyGCells      ()
+    , _congestionIndex  ()
     , _ovEdges          ()
     , _netOrdering      ()
     , _netDatas         ()
@@ -569,6 +572,8 @@ namespace Anabatic {
       cmess1 << "  o  Deleting GCells..." << endl;
       for ( GCell* gcell : _gcells ) gcell->destroy();
       _gcells.clear();
+      _dirtyGCells.clear();
+      _congestionIndex.clear();
       _ovEdges.clear();
       cmess1 << "  o  Done." << endl;
     }
@@ -1206,8 +1211,8 @@ namespace Anabatic {
     for ( GCell* gcell : _gcells ) gcell->cleanupGlobal();
     UpdateSession::close();
 
-    for ( Net* net : getCell()->getNets() ) {
-      for ( Component* component : net->getComponents() ) {
+    for ( Net* net : getCell()->getNetRange() ) {
+      for ( Component* component : net->getComponentRange() ) {
         if (_configuration->isGLayer(component->getLayer())) {
           cerr << Error( "AnabaticEngine::cleanupGlobal(): Remaining global routing,\n"
                          "        %s"
@@ -1702,7 +1707,51 @@ namespace Anabatic {
 
 
   void  AnabaticEngine::updateDensity ()
-  { for ( GCell* gcell : _gcells ) gcell->updateDensity(); } 
+  {
+  // Only the GCells modified since the last call are recomputed. Updating
+  // a density may dirty some more GCells, so loop until the list is empty.
+    vector<GCell*> dirtyGCells;
+    while (not _dirtyGCells.empty()) {
+      dirtyGCells.swap( _dirtyGCells );
+      for ( GCell* gcell : dirtyGCells ) {
+        gcell->flags().reset( Flags::DensityDirty );
+        gcell->updateDensity();
+      }
+      dirtyGCells.clear();
+    }
+  }
+
+
+  size_t  AnabaticEngine::getCongestedGCells ( size_t count, vector<GCell*>& gcells )
+  {
+    updateDensity();
+
+    gcells.clear();
+    for ( auto& entry : _congestionIndex ) {
+      if (gcells.size() >= count) break;
+      gcells.push_back( entry.second );
+    }
+    return gcells.size();
+  }
+
+
+  void  AnabaticEngine::_updateCongestion ( GCell* gcell, float previous, float current )
+  {
+    if (previous == current) return;
+    if (previous >= 0.0) _congestionIndex.erase( make_pair(previous,gcell) );
+    _congestionIndex.insert( make_pair(current,gcell) );
+  }
+
+
+  void  AnabaticEngine::_forgetDensity ( GCell* gcell )
+  {
+    if (gcell->getCongestion() >= 0.0)
+      _congestionIndex.erase( make_pair(gcell->getCongestion(),gcell) );
+    if (gcell->flags() & Flags::DensityDirty) {
+      auto idirty = std::find( _dirtyGCells.begin(), _dirtyGCells.end(), gcell );
+      if (idirty != _dirtyGCells.end()) _dirtyGCells.erase( idirty );
+    }
+  }
 
 
   size_t  AnabaticEngine::checkGCellDensities ()
@@ -1990,6 +2039,7 @@ namespace Anabatic {
     Record* record = Super::_getRecord();
     record->add( getSlot("_configuration"    ,  _configuration     ) );
     record->add( getSlot("_gcells"           , &_gcells            ) );
+    record->add( getSlot("_dirtyGCells"      , &_dirtyGCells       ) );
     record->add( getSlot("_matrix"           , &_matrix            ) );
     record->add( getSlot("_flags"            , &_flags             ) );
     record->add( getSlot("_autoSegmentLut"   , &_autoSegmentLut    ) );
@@ -2152,7 +2152,7 @@ namespace Anabatic {
     vector<GCell*> gcells;
     getGCells( gcells );
     for ( size_t i=0 ; i<gcells.size() ; ++i ) {
-      gcells[i]->flags() |= Flags::Invalidated;
+      gcells[i]->invalidateDensity();
       cdebug_log(149,0) << "changeDepth() " << gcells[i] << this << " " << endl;
     }
 
@@ -1353,40 +1353,235 @@ namespace Anabatic {
 
 
 // -------------------------------------------------------------------
-// Class  :  "Anabatic::PrioriryQueue::CompareByDistance".
+// Class  :  "Anabatic::HeapQueue".
 
-  
-  PriorityQueue2* PriorityQueue2::CompareByDistance::_pqueue = NULL;
 
+  void  HeapQueue::_siftUp ( size_t index )
+  {
+    Entry entry = _heap[index];
+    while ( index > 0 ) {
+      size_t parent = (index-1) / Arity;
+      if (not _lowerThan(entry,_heap[parent])) break;
+      _place( index, _heap[parent] );
+      index = parent;
+    }
+    _place( index, entry );
+  }
 
-  bool PriorityQueue2::CompareByDistance::operator() ( const Vertex* lhs, const Vertex* rhs ) const
+
+  void  HeapQueue::_siftDown ( size_t index )
   {
-    if (lhs->getDistance() == rhs->getDistance()) {
-      if (_pqueue and _pqueue->hasAttractor()) {
-        DbU::Unit lhsDistance = _pqueue->getAttractor().manhattanDistance( lhs->getCenter() );
-        DbU::Unit rhsDistance = _pqueue->getAttractor().manhattanDistance( rhs->getCenter() );
+    Entry  entry = _heap[index];
+    size_t size  = _heap.size();
+    while ( true ) {
+      size_t first = index*Arity + 1;
+      if (first >= size) break;
 
-        cdebug_log(112,0) << "CompareByDistance: lhs:" << DbU::getValueString(lhsDistance)
-                          << " rhs:" << DbU::getValueString(rhsDistance) << endl;
+      size_t last = std::min( first+Arity, size );
+      size_t best = first;
+      for ( size_t child=first+1 ; child<last ; ++child ) {
+        if (_lowerThan(_heap[child],_heap[best])) best = child;
+      }
+      if (not _lowerThan(_heap[best],entry)) break;
+      _place( index, _heap[best] );
+      index = best;
+    }
+    _place( index, entry );
+  }
 
-        if (lhsDistance != rhsDistance) return lhsDistance < rhsDistance;
+
+  void  HeapQueue::_remove ( size_t index )
+  {
+    Vertex* v = _heap[index]._vertex;
+    v->setQueueIndex( Vertex::npos );
+    v->unsetFlags( Vertex::Queued );
+
+    size_t last = _heap.size() - 1;
+    if (index != last) {
+      _place( index, _heap[last] );
+      _heap.pop_back();
+      _siftUp  ( index );
+      _siftDown( _heap[index]._vertex->getQueueIndex() );
+    } else
+      _heap.pop_back();
+  }
+
+
+  void  HeapQueue::clear ()
+  {
+    for ( Entry& entry : _heap ) {
+      entry._vertex->setQueueIndex( Vertex::npos );
+      entry._vertex->unsetFlags( Vertex::Queued );
+    }
+    _heap.clear();
+    _hasAttractor = false;
+  }
+
+
+  void  HeapQueue::dump () const
+  {
+    if (cdebug.enabled(112)) {
+      cdebug_log(112,1) << "HeapQueue::dump() size:" << size() << std::endl;
+      for ( size_t i=0 ; i<_heap.size() ; ++i )
+        cdebug_log(112,0) << "[" << tsetw(3) << i << "] " << _heap[i]._vertex << std::endl;
+      cdebug_tabw(112,-1);
+    }
+  }
+
+
+// -------------------------------------------------------------------
+// Class  :  "Anabatic::BucketQueue".
+
+
+  void  BucketQueue::_insert ( const Entry& entry )
+  {
+    size_t ibucket = _getBucket( entry._distance );
+    vector<Entry>& bucket = _buckets[ibucket];
+
+    bucket.push_back( entry );
+    if (ibucket == 0) {
+      entry._vertex->setQueueIndex( 0, 0 );
+      push_heap( bucket.begin(), bucket.end()
+               , [this](const Entry& lhs, const Entry& rhs) { return _lowerThan(rhs,lhs); } );
+    } else
+      entry._vertex->setQueueIndex( bucket.size()-1, ibucket );
+  }
+
+
+  void  BucketQueue::_remove ( Vertex* v )
+  {
+    size_t         ibucket = v->getQueueBucket();
+    vector<Entry>& bucket  = _buckets[ibucket];
+
+    if (ibucket == 0) {
+      for ( size_t i=0 ; i<bucket.size() ; ++i ) {
+        if (bucket[i]._vertex != v) continue;
+        bucket[i] = bucket.back();
+        bucket.pop_back();
+        make_heap( bucket.begin(), bucket.end()
+                 , [this](const Entry& lhs, const Entry& rhs) { return _lowerThan(rhs,lhs); } );
+        break;
       }
-      return lhs->getBranchId() > rhs->getBranchId();
+    } else {
+      size_t index = v->getQueueIndex();
+      if (index+1 != bucket.size()) {
+        bucket[index] = bucket.back();
+        bucket[index]._vertex->setQueueIndex( index, ibucket );
+      }
+      bucket.pop_back();
+    }
+    v->setQueueIndex( Vertex::npos );
+    v->unsetFlags( Vertex::Queued );
+    --_size;
+  }
+
+
+  void  BucketQueue::_rebase ( DbU::Unit distance )
+  {
+    vector<Entry> entries;
+    entries.reserve( _size );
+    for ( vector<Entry>& bucket : _buckets ) {
+      entries.insert( entries.end(), bucket.begin(), bucket.end() );
+      bucket.clear();
+    }
+    _last = distance;
+    for ( const Entry& entry : entries ) _insert( entry );
+  }
+
+
+  bool  BucketQueue::_refill ()
+  {
+    if (not _buckets[0].empty()) return true;
+
+    size_t ibucket = 1;
+    while ( (ibucket < BucketCount) and _buckets[ibucket].empty() ) ++ibucket;
+    if (ibucket == BucketCount) return false;
+
+    vector<Entry> entries;
+    entries.swap( _buckets[ibucket] );
+    _last = entries[0]._distance;
+    for ( const Entry& entry : entries ) _last = std::min( _last, entry._distance );
+    for ( const Entry& entry : entries ) _insert( entry );
+    return true;
+  }
+
+
+  void  BucketQueue::push ( Vertex* v )
+  {
+    if (contains(v)) _remove( v );
+
+    Entry entry { v->getPriority(), v };
+    if      (_size == 0)               _last = entry._distance;
+    else if (entry._distance < _last) _rebase( entry._distance );
+
+    _insert( entry );
+    v->setFlags( Vertex::Queued );
+    ++_size;
+  }
+
+
+  Vertex* BucketQueue::top ()
+  {
+    if (not _refill()) return NULL;
+    return _buckets[0].front()._vertex;
+  }
+
+
+  void  BucketQueue::pop ()
+  {
+    if (not _refill()) return;
+
+    vector<Entry>& bucket = _buckets[0];
+    cdebug_log(112,0) << "Pop: (size:" << _size << ") " << bucket.front()._vertex << std::endl;
+
+    pop_heap( bucket.begin(), bucket.end()
+            , [this](const Entry& lhs, const Entry& rhs) { return _lowerThan(rhs,lhs); } );
+    bucket.back()._vertex->setQueueIndex( Vertex::npos );
+    bucket.back()._vertex->unsetFlags( Vertex::Queued );
+    bucket.pop_back();
+    --_size;
+  }
+
+
+  void  BucketQueue::clear ()
+  {
+    for ( vector<Entry>& bucket : _buckets ) {
+      for ( Entry& entry : bucket ) {
+        entry._vertex->setQueueIndex( Vertex::npos );
+        entry._vertex->unsetFlags( Vertex::Queued );
+      }
+      bucket.clear();
+    }
+    _size         = 0;
+    _last         = 0;
+    _hasAttractor = false;
+  }
+
+
+  void  BucketQueue::dump () const
+  {
+    if (cdebug.enabled(112)) {
+      cdebug_log(112,1) << "BucketQueue::dump() size:" << size()
+                        << " last:" << DbU::getValueString(_last) << std::endl;
+      for ( size_t ibucket=0 ; ibucket<BucketCount ; ++ibucket ) {
+        for ( const Entry& entry : _buckets[ibucket] )
+          cdebug_log(112,0) << "[" << tsetw(2) << ibucket << "] " << entry._vertex << std::endl;
+      }
+      cdebug_tabw(112,-1);
     }
-    return lhs->getDistance() < rhs->getDistance();
   }
 
 
 // -------------------------------------------------------------------
-// Class  :  "Anabatic::PrioriryQueue::CompareByDistance".
+// Class  :  "Anabatic::SetQueue::CompareByDistance".
 
   
-  PriorityQueue* PriorityQueue::CompareByDistance::_pqueue = NULL;
+  SetQueue* SetQueue::CompareByDistance::_pqueue = NULL;
 
 
-  bool PriorityQueue::CompareByDistance::operator() ( const Vertex* lhs, const Vertex* rhs ) const
+  bool SetQueue::CompareByDistance::operator() ( const Vertex* lhs, const Vertex* rhs ) const
   {
-    if (lhs->getDistance() == rhs->getDistance()) {
+    if (lhs->getPriority() == rhs->getPriority()) {
       if (_pqueue and _pqueue->hasAttractor()) {
         DbU::Unit lhsDistance = _pqueue->getAttractor().manhattanDistance( lhs->getCenter() );
         DbU::Unit rhsDistance = _pqueue->getAttractor().manhattanDistance( rhs->getCenter() );
@@ -1398,7 +1593,7 @@ namespace Anabatic {
       }
       return lhs->getBranchId() > rhs->getBranchId();
     }
-    return lhs->getDistance() < rhs->getDistance();
+    return lhs->getPriority() < rhs->getPriority();
   }
 
 
@@ -1417,8 +1612,12 @@ namespace Anabatic {
   string Dijkstra::Mode::_getString () const
   {
     string s = "";
-    s += (_flags & Standart ) ? 'S' : '-';
-    s += (_flags & Monotonic) ? 'M' : '-';
+    s += (_flags & Standart      ) ? 'S' : '-';
+    s += (_flags & Monotonic     ) ? 'M' : '-';
+    s += (_flags & UseBucketQueue) ? 'b' : '-';
+    s += (_flags & UseSetQueue   ) ? 's' : '-';
+    s += (_flags & AStar         ) ? 'a' : '-';
+    s += (_flags & Bidirectional ) ? 'B' : '-';
 
     return s;
   }
@@ -1469,6 +1668,14 @@ namespace Anabatic {
     , _connectedsId  (-1)
     , _queue         ()
     , _flags         (0)
+    , _useEstimate   (false)
+    , _estimateHScale(1.0)
+    , _estimateVScale(1.0)
+    , _targetsBox    ()
+    , _rqueue        ()
+    , _rvisiteds     ()
+    , _expandeds     (0)
+    , _totalExpandeds(0)
   {
     const vector<GCell*>& gcells = _anabatic->getGCells();
     for ( GCell* gcell : gcells ) {
@@ -1478,6 +1685,34 @@ namespace Anabatic {
   }
 
 
+// Shares the Vertexes of <shared> (no allocation, no ownership). Used
+// to run concurrent searches over disjoint areas of the same grid.
+
+  Dijkstra::Dijkstra ( const Dijkstra* shared )
+    : _anabatic      (shared->_anabatic)
+    , _vertexes      ()
+    , _distanceCb    (_distance)
+    , _mode          (Mode::Standart)
+    , _net           (NULL)
+    , _stamp         (-1)
+    , _sources       ()
+    , _targets       ()
+    , _searchArea    ()
+    , _searchAreaHalo(shared->_searchAreaHalo)
+    , _connectedsId  (-1)
+    , _queue         ()
+    , _flags         (0)
+    , _useEstimate   (false)
+    , _estimateHScale(shared->_estimateHScale)
+    , _estimateVScale(shared->_estimateVScale)
+    , _targetsBox    ()
+    , _rqueue        ()
+    , _rvisiteds     ()
+    , _expandeds     (0)
+    , _totalExpandeds(0)
+  { }
+
+
   Dijkstra::~Dijkstra ()
   {
     for ( Vertex* vertex : _vertexes ) delete vertex;
@@ -1551,12 +1786,12 @@ namespace Anabatic {
   }
 
 
-  void  Dijkstra::load ( Net* net )
+  void  Dijkstra::load ( Net* net, bool newStamp )
   {
     _cleanup();
 
     _net   = net;
-    _stamp = _anabatic->incStamp();
+    _stamp = (newStamp) ? _anabatic->incStamp() : _anabatic->getStamp();
 
     DebugSession::open( _net, 112, 120 );
     cdebug_log(112,1) << "Dijkstra::load() " << _net << endl;
@@ -1758,7 +1993,7 @@ namespace Anabatic {
                                                   ) );
         }
         if (gcell) {
-          _queue.push(gcell->getObserver<Vertex>(GCell::Observable::Vertex));
+          _push(gcell->getObserver<Vertex>(GCell::Observable::Vertex));
         }
         while ( not _queue.empty() ) {
           Vertex* current  = _queue.top();
@@ -1776,7 +2011,7 @@ namespace Anabatic {
               Vertex* vnext = gnext->getObserver<Vertex>(GCell::Observable::Vertex);
               if (  (gnext->getXCenter() == state->getSymAxis()) 
                  && (gnext->getYMin() <= cell->getAbutmentBox().getYMax())
-                 ) _queue.push( vnext );
+                 ) _push( vnext );
             }
           } else if (state->isSymHorizontal()){
           // check East
@@ -1785,7 +2020,7 @@ namespace Anabatic {
               Vertex* vnext = gnext->getObserver<Vertex>(GCell::Observable::Vertex);
               if (  (gnext->getXCenter() == state->getSymAxis())
                  && (gnext->getXMin() <= cell->getAbutmentBox().getXMax())
-                 ) _queue.push( vnext );
+                 ) _push( vnext );
             }
           }   
         }
@@ -1815,7 +2050,7 @@ namespace Anabatic {
                                                   ) );
         }
         if (gcell) {
-          _queue.push(gcell->getObserver<Vertex>(GCell::Observable::Vertex));
+          _push(gcell->getObserver<Vertex>(GCell::Observable::Vertex));
           setFlags(Mode::AxisTarget);
           cdebug_log(112,0) << "Find axis targets: " << endl;
         }
@@ -1841,7 +2076,7 @@ namespace Anabatic {
               if (  ( (state->getSymAxis() >= gnext->getXMin()) && (state->getSymAxis() <= gnext->getXMax()) )
                  && (gnext->getYMin() <= cell->getAbutmentBox().getYMax())
                  ){ 
-                _queue.push( vnext );
+                _push( vnext );
               } else {  cdebug_log(112,0) << "isNOT: " << gnext << endl;
               }
 
@@ -1854,7 +2089,7 @@ namespace Anabatic {
               if (  ( (state->getSymAxis() >= gnext->getYMin()) && (state->getSymAxis() <= gnext->getYMax()) )
                  && (gnext->getXMin() <= cell->getAbutmentBox().getXMax())
                  ) {
-                _queue.push( vnext );
+                _push( vnext );
               } else { cdebug_log(112,0) << "isNOT: " << gnext << endl;
               }
             }
@@ -1973,6 +2208,7 @@ namespace Anabatic {
       if      ( current->isAxisTarget() and needAxisTarget()) unsetFlags(Mode::AxisTarget);
       else if ((current->getConnexId() == _connectedsId) or (current->getConnexId() < 0)) {
         cdebug_log(111,0) << "Looking for neighbors:" << endl;
+        ++_expandeds;
 
         for ( Edge* edge : current->getGCell()->getEdges() ) {
           cdebug_log(111,0) << "@ Edge " << edge << endl;
@@ -2063,7 +2299,7 @@ namespace Anabatic {
             vneighbor->setDistance( distance );
             cdebug_log(111,0) << "| setFrom1: " << vneighbor << endl; 
             vneighbor->setFrom ( edge );
-            _queue.push( vneighbor );
+            _push( vneighbor );
             cdebug_log(111,0) << "| Push: (size:" << _queue.size() << ") " << vneighbor << ", isFromFrom2: " << vneighbor->isFromFrom2() << endl;
           }
           
@@ -2096,7 +2332,7 @@ namespace Anabatic {
               vneighbor->setFrom ( edge );
               if (gneighbor->isAnalog()) vneighbor->setFrom2( NULL );
 
-              _queue.push( vneighbor );
+              _push( vneighbor );
               cdebug_log(111,0) << "Push: (size:" << _queue.size() << ") " << vneighbor << endl;
             } else {
               if ( (distance < vneighbor->getDistance()) and (distance != Vertex::unreachable) ) {
@@ -2123,7 +2359,7 @@ namespace Anabatic {
                 vneighbor->setFrom ( edge );
                 if (gneighbor->isAnalog()) vneighbor->setFrom2( NULL );
 
-                _queue.push( vneighbor );
+                _push( vneighbor );
                 cdebug_log(111,0) << "Push: (size:" << _queue.size() << ") " << vneighbor << endl;
               } else {
                 cdebug_log(111,0) << "Reject: Vertex reached through a *longer* path or unreachable:"
@@ -2160,6 +2396,254 @@ namespace Anabatic {
   }
 
 
+// A* lower bound of the remaining distance: the Manhattan distance
+// from the vertex to the bounding box of the centers of the remaining
+// targets, scaled by the minimal cost per unit of length of the H & V
+// edges (see setEstimateScale()). It is admissible as long as no edge
+// is cheaper than its length times the scale.
+
+  DbU::Unit  Dijkstra::_getEstimate ( const Vertex* v ) const
+  {
+    if (_targetsBox.isEmpty()) return 0;
+
+    Point     center = v->getCenter();
+    DbU::Unit dx     = 0;
+    DbU::Unit dy     = 0;
+    if      (center.getX() < _targetsBox.getXMin()) dx = _targetsBox.getXMin() - center.getX();
+    else if (center.getX() > _targetsBox.getXMax()) dx = center.getX() - _targetsBox.getXMax();
+    if      (center.getY() < _targetsBox.getYMin()) dy = _targetsBox.getYMin() - center.getY();
+    else if (center.getY() > _targetsBox.getYMax()) dy = center.getY() - _targetsBox.getYMax();
+
+    return (DbU::Unit)( (float)dx * _estimateHScale + (float)dy * _estimateVScale );
+  }
+
+
+  void  Dijkstra::_updateTargetsBox ()
+  {
+    _targetsBox.makeEmpty();
+    for ( Vertex* target : _targets ) _targetsBox.merge( target->getCenter() );
+  }
+
+
+  void  Dijkstra::_push ( Vertex* v )
+  {
+    v->setEstimate( (_useEstimate) ? _getEstimate(v) : 0 );
+    _queue.push( v );
+  }
+
+
+// The bidirectional search is restricted to the digital connexions
+// between exactly two components (the source one and one target).
+
+  bool  Dijkstra::_isBidirectional () const
+  {
+    if (_targets.empty() or needAxisTarget()) return false;
+    if (_mode & Mode::Monotonic) return false;
+
+    int targetId = (*_targets.begin())->getConnexId();
+    for ( Vertex* target : _targets ) {
+      if (target->getConnexId() != targetId) return false;
+      if (target->isAnalog()) return false;
+    }
+    for ( Vertex* source : _sources ) {
+      if (source->isAnalog()) return false;
+    }
+    return true;
+  }
+
+
+// The distance callback only knows about the forward labels of the
+// vertexes (distance & from edge), so the backward labels are swapped
+// in for the time of the call. As the cost is direction dependent (via
+// & go straight), the backward distance is only an approximation of the
+// forward one. A vertex not reached by the forward search still holds
+// the labels of a previous one, they are reset before it is stamped
+// (as the forward search would do), so they cannot be seen as current.
+
+  DbU::Unit  Dijkstra::_getBackwardDistance ( Vertex* current, Vertex* vneighbor, Edge* edge )
+  {
+    int       stamp    = current->getStamp();
+    DbU::Unit distance = current->getDistance();
+    Edge*     from     = current->getFrom();
+
+    if (not current->hasValidStamp()) {
+      current->setConnexId( -1 );
+      current->setBranchId(  0 );
+      current->setDegree  (  1 );
+      current->setRpCount (  0 );
+    }
+    current->setStamp   ( _stamp );
+    current->setDistance( current->getRDistance() );
+    current->setFrom    ( current->getRFrom() );
+    DbU::Unit rdistance = _distanceCb( current, vneighbor, edge );
+    current->setStamp   ( stamp );
+    current->setDistance( distance );
+    current->setFrom    ( from );
+
+    return rdistance;
+  }
+
+
+// Bidirectional Dijkstra for two terminals connexions. The forward
+// search uses the regular queue and vertex labels, the backward one
+// keeps its labels in Vertex::_rdistance & Vertex::_rfrom and uses a
+// lazy binary heap (outdated entries are skipped when popped). The
+// side with the lowest frontier is expanded first, and the search
+// stops when the sum of the two frontiers exceeds the best meeting
+// distance. The backward half of the path is then converted into
+// forward "from" edges so _traceback() can be used unchanged.
+
+  bool  Dijkstra::_propagateBidirectional ()
+  {
+    cdebug_log(112,1) << "Dijkstra::_propagateBidirectional() " << _net <<  endl;
+
+    auto rcompare = [](const REntry& lhs, const REntry& rhs) {
+      if (lhs.first != rhs.first) return lhs.first > rhs.first;
+      return lhs.second->getId() > rhs.second->getId();
+    };
+
+    int       targetId        = (*_targets.begin())->getConnexId();
+    Vertex*   meeting         = NULL;
+    DbU::Unit meetingDistance = Vertex::unreached;
+
+    auto meet = [&]( Vertex* v ) {
+      if (not v->hasValidStamp()) return;
+      DbU::Unit forward  = v->getDistance();
+      DbU::Unit backward = v->getRDistance();
+      if ((forward >= Vertex::unreachable) or (backward >= Vertex::unreachable)) return;
+      if (forward + backward < meetingDistance) {
+        meeting         = v;
+        meetingDistance = forward + backward;
+      }
+    };
+
+    _rqueue.clear();
+    for ( Vertex* target : _targets ) {
+      target->setRDistance( 0 );
+      target->setRFrom    ( NULL );
+      _rvisiteds.push_back( target );
+      _rqueue   .push_back( REntry(0,target) );
+    }
+    make_heap( _rqueue.begin(), _rqueue.end(), rcompare );
+
+    while ( not _queue.empty() or not _rqueue.empty() ) {
+      DbU::Unit forwardMin  = (_queue .empty()) ? 0 : _queue.top()->getDistance();
+      DbU::Unit backwardMin = (_rqueue.empty()) ? 0 : _rqueue.front().first;
+      if (meeting and (forwardMin + backwardMin >= meetingDistance)) break;
+
+      if (not _queue.empty() and (_rqueue.empty() or (forwardMin <= backwardMin))) {
+        Vertex* current = _queue.top();
+        _queue.pop();
+        if (current->getConnexId() == targetId) { meet( current ); continue; }
+        ++_expandeds;
+
+        cdebug_log(111,0) << "Forward:" << current << endl;
+        for ( Edge* edge : current->getGCell()->getEdges() ) {
+          if (edge == current->getFrom()) continue;
+
+          Vertex* vneighbor = current->getNeighbor( edge );
+          if (vneighbor->getConnexId() == _connectedsId) continue;
+          if (not _searchArea.intersect(vneighbor->getBoundingBox())) continue;
+
+          DbU::Unit distance = _distanceCb( current, vneighbor, edge );
+          if (distance == Vertex::unreachable) continue;
+
+          if (not vneighbor->hasValidStamp()) {
+            vneighbor->setConnexId( -1 );
+            vneighbor->setStamp   ( _stamp );
+            vneighbor->setDegree  ( 1 );
+            vneighbor->setRpCount ( 0 );
+            vneighbor->unsetFlags ( Vertex::AxisTarget|Vertex::Queued );
+          } else {
+            if (distance >= vneighbor->getDistance()) continue;
+            if (vneighbor->getDistance() != Vertex::unreached) _queue.erase( vneighbor );
+          }
+          vneighbor->setBranchId( current->getBranchId() );
+          vneighbor->setDistance( distance );
+          vneighbor->setFrom    ( edge );
+          _push( vneighbor );
+          meet( vneighbor );
+        }
+      } else {
+        pop_heap( _rqueue.begin(), _rqueue.end(), rcompare );
+        REntry entry = _rqueue.back();
+        _rqueue.pop_back();
+
+        Vertex* current = entry.second;
+        if (entry.first != current->getRDistance()) continue;
+        if (current->getConnexId() == _connectedsId) { meet( current ); continue; }
+        ++_expandeds;
+
+        cdebug_log(111,0) << "Backward:" << current << endl;
+        for ( Edge* edge : current->getGCell()->getEdges() ) {
+          if (edge == current->getRFrom()) continue;
+
+          Vertex* vneighbor = current->getNeighbor( edge );
+          if (vneighbor->getConnexId() == targetId) continue;
+          if (not _searchArea.intersect(vneighbor->getBoundingBox())) continue;
+
+          DbU::Unit distance = _getBackwardDistance( current, vneighbor, edge );
+          if (distance == Vertex::unreachable) continue;
+          if (distance >= vneighbor->getRDistance()) continue;
+
+          if (vneighbor->getRDistance() == Vertex::unreached) _rvisiteds.push_back( vneighbor );
+          vneighbor->setRDistance( distance );
+          vneighbor->setRFrom    ( edge );
+          _rqueue.push_back( REntry(distance,vneighbor) );
+          push_heap( _rqueue.begin(), _rqueue.end(), rcompare );
+          meet( vneighbor );
+        }
+      }
+    }
+
+    bool found = (meeting != NULL);
+    if (found) {
+      cdebug_log(112,0) << "Meeting: " << meeting << endl;
+
+    // Splice the backward half of the path toward the target.
+      Vertex* current = meeting;
+      while ( current->getConnexId() != targetId ) {
+        Edge* edge = current->getRFrom();
+        if (not edge) break;
+
+        Vertex* next   = current->getNeighbor( edge );
+        bool    queued = false;
+        if (not next->hasValidStamp()) {
+          next->setConnexId( -1 );
+          next->setStamp   ( _stamp );
+          next->setDegree  ( 1 );
+          next->setRpCount ( 0 );
+          next->unsetFlags ( Vertex::AxisTarget|Vertex::Queued );
+        } else if (next->isQueued()) {
+        // The distance is the queue key, take it out while changing it.
+          _queue.erase( next );
+          queued = true;
+        }
+        next->setDistance( current->getDistance() + current->getRDistance() - next->getRDistance() );
+        next->setBranchId( current->getBranchId() );
+        next->setFrom    ( edge );
+        if (queued) _push( next );
+        current = next;
+      }
+      _traceback( current );
+    } else {
+      cerr << Error( "Dijkstra::_propagateBidirectional(): %s has unreachable targets."
+                   , getString(_net).c_str()
+                   ) << endl;
+    }
+
+    for ( Vertex* vertex : _rvisiteds ) {
+      vertex->setRDistance( Vertex::unreached );
+      vertex->setRFrom    ( NULL );
+    }
+    _rvisiteds.clear();
+    _rqueue   .clear();
+
+    cdebug_tabw(112,-1);
+    return found;
+  }
+
+
   void  Dijkstra::_traceback ( Vertex* current )
   {
     cdebug_log(112,1) << "Dijkstra::_traceback() " << _net << " branchId:" << _sources.size() << endl;
@@ -2210,10 +2694,11 @@ namespace Anabatic {
         current->setConnexId( _connectedsId );
         current->setBranchId( branchId );
         _sources.insert( current );
-        _queue.push( current );
+        _push( current );
         current = current->getPredecessor();
       }
     }
+    if (_useEstimate) _updateTargetsBox();
     cdebug_tabw(112,-1);
   }
 
@@ -2374,13 +2859,21 @@ namespace Anabatic {
     DebugSession::open( _net, 111, 120 );
 
     cdebug_log(112,1) << "Dijkstra::run() on " << _net << " mode:" << mode << endl;
+    if (search(mode)) materialize();
+    
+    cdebug_tabw(112,-1);
+    DebugSession::close();
+  }
+
+
+  bool  Dijkstra::search ( Dijkstra::Mode mode )
+  {
     _mode = mode;
 
     _selectFirstSource();
     if (_sources.empty()) {
       cdebug_log(112,0) << "No source to start, not routed." << endl;
-      cdebug_tabw(112,-1);
-      return;
+      return false;
     }
 
     Flags enabledEdges = Flags::AllSides;
@@ -2392,25 +2885,43 @@ namespace Anabatic {
     }
 
     _queue.clear();
+    if      (_mode & Mode::UseBucketQueue) _queue.setKind( PriorityQueue::Bucket );
+    else if (_mode & Mode::UseSetQueue   ) _queue.setKind( PriorityQueue::Set );
+    else                                   _queue.setKind( PriorityQueue::Heap );
     _queue.setAttractor( _searchArea.getCenter() );
     _connectedsId = (*_sources.begin())->getConnexId();
+    _expandeds    = 0;
+
+    bool bidirectional = (_mode & Mode::Bidirectional) and _isBidirectional();
+    _useEstimate = (_mode & Mode::AStar) and not bidirectional and not needAxisTarget();
+    if (_useEstimate) _updateTargetsBox();
+
     for ( Vertex* source : _sources ) {
-      _queue.push( source );
       source->setDistance( 0.0 );
+      _push( source );
       cdebug_log(112,0) << "Push source: (size:" << _queue.size() << ") "
                         << source
                         << " _connectedsId:" << _connectedsId << endl;
     }
-    while ( ((not _targets.empty()) ||  needAxisTarget()) and _propagate(enabledEdges) );
+    if (bidirectional)
+      _propagateBidirectional();
+    else
+      while ( ((not _targets.empty()) ||  needAxisTarget()) and _propagate(enabledEdges) );
       
     _queue.clear();
+    _useEstimate     = false;
+    _totalExpandeds += _expandeds;
+    cdebug_log(112,0) << "Expanded vertexes: " << _expandeds << endl;
+    return true;
+  }
+
+
+  void  Dijkstra::materialize ()
+  {
     _materialize();
     unsetAxisTargets();
 
     _anabatic->getNetData( _net )->setGlobalRouted( true );
-    
-    cdebug_tabw(112,-1);
-    DebugSession::close();
   }
 
 
@@ -2423,7 +2934,7 @@ namespace Anabatic {
     source->setDistance( 0.0 );
     _targets.erase ( source );
     _sources.insert( source );
-    _queue.push( source );
+    _push( source );
 
     VertexSet stack;
     stack.insert( source );
@@ -2453,7 +2964,7 @@ namespace Anabatic {
 
         _targets.erase ( vneighbor );
         _sources.insert( vneighbor );
-        _queue.push( vneighbor );
+        _push( vneighbor );
         stack.insert( vneighbor );
       }
     }
@@ -2826,7 +3337,7 @@ namespace Anabatic {
       current->setConnexId( _connectedsId );
       current->setBranchId( branchId );
       _sources.insert( current );
-      _queue.push( current );
+      _push( current );
     } else {
     //cdebug_log(112,0) << "Is first" << endl;
       isfirst = false;
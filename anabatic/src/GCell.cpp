@@ -302,6 +302,7 @@ namespace Anabatic {
     , _rpCount       (0)
     , _blockages     (new DbU::Unit [_depth])
     , _cDensity      (0.0)
+    , _congestion    (-1.0)
     , _densities     (new float [_depth])
     , _feedthroughs  (new float [_depth])
     , _fragmentations(new float [_depth])
@@ -336,6 +337,7 @@ namespace Anabatic {
   {
     Super::_postCreate();
     _anabatic->_add( this );
+    _setDensityDirty();
   }
 
 
@@ -919,7 +921,7 @@ namespace Anabatic {
   {
     cdebug_log(110,1) << "GCell::invalidate() " << this << endl;
     Super::invalidate( propagateFlag );
-    _flags |= Flags::Invalidated;
+    invalidateDensity();
 
     cdebug_log(110,1) << "West side."  << endl; for ( Edge* edge : _westEdges  ) edge->invalidate(); cdebug_tabw(110,-1);
     cdebug_log(110,1) << "East side."  << endl; for ( Edge* edge : _eastEdges  ) edge->invalidate(); cdebug_tabw(110,-1);
@@ -1413,7 +1415,7 @@ namespace Anabatic {
     if (depth >= Session::getAllowedDepth()) return;
 
     _blockages[depth] += length;
-    _flags |= Flags::Invalidated;
+    invalidateDensity();
 
     cdebug_log(149,0) << "GCell::addBlockage() " << this << " "
                 << depth << ":" << DbU::getValueString(_blockages[depth]) << endl;
@@ -1436,7 +1438,7 @@ namespace Anabatic {
     if (found) {
       cdebug_log(149,0) << "remove " << ac << " from " << this << endl;
       _contacts.pop_back();
-      _flags |= Flags::Invalidated;
+      invalidateDensity();
     } else {
       cerr << Bug("%p:%s do not belong to %s."
                  ,ac->base(),getString(ac).c_str(),_getString().c_str()) << endl;
@@ -1470,7 +1472,7 @@ namespace Anabatic {
                  , _getString().c_str(), getString(segment).c_str() ) << endl;
 
     _hsegments.erase( _hsegments.begin() + end, _hsegments.end() );
-    _flags |= Flags::Invalidated;
+    invalidateDensity();
   }
 
 
@@ -1496,7 +1498,7 @@ namespace Anabatic {
                  , getString(segment).c_str() ) << endl;
 
     _vsegments.erase( _vsegments.begin() + end, _vsegments.end() );
-    _flags |= Flags::Invalidated;
+    invalidateDensity();
   }
 
 
@@ -1504,6 +1506,13 @@ namespace Anabatic {
   { for ( AutoContact* contact : _contacts ) contact->updateGeometry(); }
 
 
+  void  GCell::_setDensityDirty ()
+  {
+    _flags |= Flags::DensityDirty;
+    _anabatic->_addDirty( this );
+  }
+
+
   size_t  GCell::updateDensity ()
   {
     if (not isInvalidated()) return (isSaturated()) ? 1 : 0;
@@ -1666,6 +1675,12 @@ namespace Anabatic {
     else           _cDensity = 0;
     _flags.reset( Flags::Invalidated );
 
+    float congestion = 0.0;
+    for ( size_t i=_pinDepth ; i<Session::getAllowedDepth() ; ++i )
+      congestion = std::max( congestion, _densities[i] );
+    _anabatic->_updateCongestion( this, _congestion, congestion );
+    _congestion = congestion;
+
     checkDensity();
 
     // if (getId() == 267173) {
@@ -1977,6 +1992,7 @@ namespace Anabatic {
     }
 
     record->add( getSlot ( "_cDensity", &_cDensity  ) );
+    record->add( getSlot ( "_congestion", &_congestion ) );
     for ( size_t depth=0 ; depth<_depth ; ++depth ) {
       ostringstream s;
       const Layer* layer = rg->getRoutingLayer(depth);
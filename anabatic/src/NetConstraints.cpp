@@ -288,7 +288,7 @@ namespace Anabatic {
     cdebug_tabw(146,1);
 
     vector<RoutingPad*> routingPads;
-    for ( Component* component : net->getComponents() ) {
+    for ( Component* component : net->getComponentRange() ) {
       Contact* contact = dynamic_cast<Contact*>( component );
       if (contact) {
         AutoContact* autoContact = Session::lookup( contact );
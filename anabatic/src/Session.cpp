@@ -92,7 +92,7 @@ namespace Anabatic {
 
   void  Session::_postCreate ()
   {
-    UpdateSession::open();
+    UpdateSession::open( UpdateSession::Bulk );
     _session = this;
   }
 
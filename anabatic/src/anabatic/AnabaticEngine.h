@@ -190,6 +190,24 @@ namespace Anabatic {
   typedef  std::map<uint64_t,NetData*>         NetDatas;
 
 
+// -------------------------------------------------------------------
+// Class  :  "Anabatic::CompareByCongestion".
+//
+// Most congested GCells first, ties broken by id to keep the order
+// deterministic.
+
+  class CompareByCongestion {
+    public:
+      inline bool  operator() ( const std::pair<float,GCell*>& lhs, const std::pair<float,GCell*>& rhs ) const
+      {
+        if (lhs.first != rhs.first) return lhs.first > rhs.first;
+        return lhs.second->getId() < rhs.second->getId();
+      }
+  };
+
+  typedef  std::set< std::pair<float,GCell*>, CompareByCongestion >  CongestionIndex;
+
+
   class AnabaticEngine : public ToolEngine {
     public:
       static const uint32_t  DigitalMode      = (1 <<  0);
@@ -280,6 +298,7 @@ namespace Anabatic {
       inline const  vector<NetData*>& getNetOrdering          () const;
                     void              invalidateRoutingPads   ();
                     void              updateDensity           ();
+                    size_t            getCongestedGCells      ( size_t count, vector<GCell*>& );
                     size_t            checkGCellDensities     ();
                     void              setupNetBuilder         ();
       inline        void              setRoutingMode          ( uint32_t );
@@ -335,6 +354,9 @@ namespace Anabatic {
                     void              reset                   ();
       inline        void              _add                    ( GCell* );
       inline        void              _remove                 ( GCell* );
+      inline        void              _addDirty               ( GCell* );
+                    void              _updateCongestion       ( GCell*, float previous, float current );
+                    void              _forgetDensity          ( GCell* );
       inline        void              _updateLookup           ( GCell* );
       inline        void              _updateGContacts        ( Flags flags=Flags::Horizontal|Flags::Vertical );
       inline        void              _resizeMatrix           ();
@@ -362,6 +384,8 @@ namespace Anabatic {
              EngineState         _state;
              Matrix              _matrix;
              vector<GCell*>      _gcells;
+             vector<GCell*>      _dirtyGCells;
+             CongestionIndex     _congestionIndex;
              vector<Edge*>       _ovEdges;
              vector<NetData*>    _netOrdering;
              NetDatas            _netDatas;
@@ -429,6 +453,7 @@ namespace Anabatic {
   inline       void              AnabaticEngine::setGlobalThreshold       ( DbU::Unit threshold ) { _configuration->setGlobalThreshold(threshold); }
   inline const NetDatas&         AnabaticEngine::getNetDatas              () const { return _netDatas; }
   inline       void              AnabaticEngine::_updateLookup            ( GCell* gcell ) { _matrix.updateLookup(gcell); }
+  inline       void              AnabaticEngine::_addDirty                ( GCell* gcell ) { _dirtyGCells.push_back(gcell); }
   inline       void              AnabaticEngine::_resizeMatrix            () { _matrix.resize( getCell(), getGCells() ); }
   inline       void              AnabaticEngine::_updateGContacts         ( Flags flags ) { for ( GCell* gcell : getGCells() ) gcell->updateGContacts(flags); }
   inline       bool              AnabaticEngine::_inDestroy               () const { return _flags & Flags::DestroyMask; }
@@ -444,6 +469,7 @@ namespace Anabatic {
   inline void  AnabaticEngine::_remove ( GCell* gcell )
   {
     if (_inDestroy()) return;
+    _forgetDensity( gcell );
     for ( auto igcell = _gcells.begin() ; igcell != _gcells.end() ; ++igcell )
       if (*igcell == gcell) {
         if (_inDestroy()) (*igcell) = NULL;
@@ -16,11 +16,8 @@
 
 #pragma  once
 #include <set>
+#include <vector>
 #include <iomanip>
-#include <boost/multi_index_container.hpp>
-#include <boost/multi_index/ordered_index.hpp>
-#include <boost/multi_index/hashed_index.hpp>
-#include <boost/multi_index/identity.hpp>
 #include "hurricane/Error.h"
 #include "hurricane/Observer.h"
 namespace Hurricane {
@@ -199,6 +196,7 @@ namespace Anabatic {
     public:
       static         DbU::Unit       unreached;
       static         DbU::Unit       unreachable;
+      static const   uint32_t        npos = (uint32_t)-1;
     public:                         
       static         void            notify            ( Vertex*, unsigned flags );
       static inline  Vertex*         lookup            ( GCell* );
@@ -219,6 +217,10 @@ namespace Anabatic {
                      bool            hasValidStamp     () const;
              inline  Point           getCenter         () const;
              inline  DbU::Unit       getDistance       () const;
+             inline  DbU::Unit       getEstimate       () const;
+             inline  DbU::Unit       getPriority       () const;
+             inline  DbU::Unit       getRDistance      () const;
+             inline  Edge*           getRFrom          () const;
              inline  int             getStamp          () const;
              inline  int             getBranchId       () const;
              inline  int             getConnexId       () const;
@@ -229,6 +231,9 @@ namespace Anabatic {
              inline  Vertex*         getNeighbor       ( Edge* ) const;
              inline  void            setDriver         ( bool state );
              inline  void            setDistance       ( DbU::Unit );
+             inline  void            setEstimate       ( DbU::Unit );
+             inline  void            setRDistance      ( DbU::Unit );
+             inline  void            setRFrom          ( Edge* );
              inline  void            setStamp          ( int );
              inline  void            setConnexId       ( int );
              inline  void            setBranchId       ( int );
@@ -237,6 +242,9 @@ namespace Anabatic {
              inline  void            setRpCount        ( int );
              inline  void            incRpCount        ( int delta=1 );
              inline  void            setFrom           ( Edge* );
+             inline  uint32_t        getQueueIndex     () const;
+             inline  uint32_t        getQueueBucket    () const;
+             inline  void            setQueueIndex     ( uint32_t index, uint32_t bucket=0 );
              inline  void            add               ( RoutingPad* );
              inline  void            clearRps          ();
              inline  Contact*        breakGoThrough    ( Net* );
@@ -316,8 +324,13 @@ namespace Anabatic {
       int                  _rpCount : 8;
       int                  _stamp;
       DbU::Unit            _distance;
+      DbU::Unit            _estimate;
+      DbU::Unit            _rdistance;
       Edge*                _from;
+      Edge*                _rfrom;
       uint32_t             _flags;
+      uint32_t             _queueIndex;
+      uint32_t             _queueBucket;
       GRAData*             _adata;
   }; 
 
@@ -332,9 +345,14 @@ namespace Anabatic {
     , _rpCount ( 0)
     , _stamp   (-1)
     , _distance(unreached)
+    , _estimate(0)
+    , _rdistance(unreached)
     , _from    (NULL)
-    , _flags   (NoRestriction)
-    , _adata   (NULL)
+    , _rfrom   (NULL)
+    , _flags      (NoRestriction)
+    , _queueIndex (npos)
+    , _queueBucket(0)
+    , _adata      (NULL)
   {
     gcell->setObserver( GCell::Observable::Vertex, &_observer );
   }
@@ -354,6 +372,10 @@ namespace Anabatic {
   inline Contact*        Vertex::getGContact    ( Net* net ) { return _gcell->getGContact(net); }
   inline Point           Vertex::getCenter      () const { return _gcell->getBoundingBox().getCenter(); }
   inline DbU::Unit       Vertex::getDistance    () const { return hasValidStamp() ? _distance : unreached; }
+  inline DbU::Unit       Vertex::getEstimate    () const { return _estimate; }
+  inline DbU::Unit       Vertex::getPriority    () const { return getDistance() + _estimate; }
+  inline DbU::Unit       Vertex::getRDistance   () const { return _rdistance; }
+  inline Edge*           Vertex::getRFrom       () const { return _rfrom; }
   inline int             Vertex::getStamp       () const { return _stamp; }
   inline int             Vertex::getConnexId    () const { return hasValidStamp() ? _connexId : -1; }
   inline int             Vertex::getBranchId    () const { return hasValidStamp() ? _branchId :  0; }
@@ -361,7 +383,13 @@ namespace Anabatic {
   inline int             Vertex::getRpCount     () const { return hasValidStamp() ? _rpCount  :  0; }
 //inline Edge*           Vertex::getFrom        () const { return _from; }
   inline void            Vertex::setDistance    ( DbU::Unit distance ) { _distance=distance; }
+  inline void            Vertex::setEstimate    ( DbU::Unit estimate ) { _estimate=estimate; }
+  inline void            Vertex::setRDistance   ( DbU::Unit distance ) { _rdistance=distance; }
+  inline void            Vertex::setRFrom       ( Edge* from ) { _rfrom=from; }
   inline void            Vertex::setFrom        ( Edge* from ) { _from=from; }
+  inline uint32_t        Vertex::getQueueIndex  () const { return _queueIndex; }
+  inline uint32_t        Vertex::getQueueBucket () const { return _queueBucket; }
+  inline void            Vertex::setQueueIndex  ( uint32_t index, uint32_t bucket ) { _queueIndex=index; _queueBucket=bucket; }
   inline void            Vertex::setStamp       ( int stamp ) { _stamp=stamp; }
   inline void            Vertex::setConnexId    ( int id ) { _connexId=id; }
   inline void            Vertex::setBranchId    ( int id ) { _branchId=id; }
@@ -427,88 +455,258 @@ namespace Anabatic {
 
 
 // -------------------------------------------------------------------
-// Class  :  "Anabatic::PriorityQueue2".
+// Class  :  "Anabatic::BaseQueue".
+//
+// Common part of the indexed queues: the attractor and the ordering
+// of the vertexes. The priority (distance plus A* estimate) is cached
+// in the queue entry at insertion time so the comparison do not go
+// through the stamp check of Vertex::getDistance(). Ties are broken by
+// the attractor then by the branch id, like the historical multiset
+// comparator.
+
+  class BaseQueue {
+    public:
+      struct Entry {
+        DbU::Unit  _distance;
+        Vertex*    _vertex;
+      };
+    public:
+      inline                BaseQueue    ();
+      inline        void    setAttractor ( const Point& );
+      inline  const Point&  getAttractor () const;
+      inline        bool    hasAttractor () const;
+    protected:
+      inline        bool    _lowerThan   ( const Entry& lhs, const Entry& rhs ) const;
+    protected:
+      bool   _hasAttractor;
+      Point  _attractor;
+  };
+
+
+  inline               BaseQueue::BaseQueue    () : _hasAttractor(false), _attractor() { }
+  inline       void    BaseQueue::setAttractor ( const Point& p ) { _attractor=p;  _hasAttractor=true; }
+  inline       bool    BaseQueue::hasAttractor () const { return _hasAttractor; }
+  inline const Point&  BaseQueue::getAttractor () const { return _attractor; }
+
+  inline bool  BaseQueue::_lowerThan ( const Entry& lhs, const Entry& rhs ) const
+  {
+    if (lhs._distance != rhs._distance) return lhs._distance < rhs._distance;
+    if (_hasAttractor) {
+      DbU::Unit lhsDistance = _attractor.manhattanDistance( lhs._vertex->getCenter() );
+      DbU::Unit rhsDistance = _attractor.manhattanDistance( rhs._vertex->getCenter() );
+      if (lhsDistance != rhsDistance) return lhsDistance < rhsDistance;
+    }
+    return lhs._vertex->getBranchId() > rhs._vertex->getBranchId();
+  }
+
+
+// -------------------------------------------------------------------
+// Class  :  "Anabatic::HeapQueue".
+//
+// Indexed 4-ary min-heap. The position of each vertex in the heap is
+// kept in the Vertex itself (Vertex::_queueIndex), so erase() and
+// re-pushing an already queued vertex (decrease-key) are O(log n).
+
+  class HeapQueue : public BaseQueue {
+    public:
+      static const size_t  Arity = 4;
+    public:
+      inline                HeapQueue ();
+      inline        bool    empty     () const;
+      inline        size_t  size      () const;
+      inline        bool    contains  ( const Vertex* ) const;
+      inline        void    push      ( Vertex* );
+      inline        void    erase     ( Vertex* );
+      inline        Vertex* top       ();
+      inline        void    pop       ();
+                    void    clear     ();
+                    void    dump      () const;
+    private:
+      inline        void    _place    ( size_t index, const Entry& );
+                    void    _siftUp   ( size_t index );
+                    void    _siftDown ( size_t index );
+                    void    _remove   ( size_t index );
+    private:
+      std::vector<Entry>  _heap;
+  };
+
+
+  inline         HeapQueue::HeapQueue () : BaseQueue(), _heap() { }
+  inline bool    HeapQueue::empty     () const { return _heap.empty(); }
+  inline size_t  HeapQueue::size      () const { return _heap.size(); }
+  inline Vertex* HeapQueue::top       () { return _heap.empty() ? NULL : _heap[0]._vertex; }
+
+  inline bool  HeapQueue::contains ( const Vertex* v ) const
+  {
+    uint32_t index = v->getQueueIndex();
+    return (index < _heap.size()) and (_heap[index]._vertex == v);
+  }
+
+  inline void  HeapQueue::_place ( size_t index, const Entry& entry )
+  {
+    _heap[index] = entry;
+    entry._vertex->setQueueIndex( index );
+  }
+
+  inline void  HeapQueue::push ( Vertex* v )
+  {
+    if (contains(v)) {
+      size_t index = v->getQueueIndex();
+      _heap[index]._distance = v->getPriority();
+      _siftUp  ( index );
+      _siftDown( v->getQueueIndex() );
+      return;
+    }
+    _heap.push_back( Entry { v->getPriority(), v } );
+    v->setQueueIndex( _heap.size()-1 );
+    v->setFlags( Vertex::Queued );
+    _siftUp( _heap.size()-1 );
+  }
+
+  inline void  HeapQueue::pop ()
+  {
+    cdebug_log(112,0) << "Pop: (size:" << _heap.size() << ") " << _heap[0]._vertex << std::endl;
+    _remove( 0 );
+  }
+
+  inline void  HeapQueue::erase ( Vertex* v )
+  {
+    if (contains(v)) _remove( v->getQueueIndex() );
+  }
+
+
+// -------------------------------------------------------------------
+// Class  :  "Anabatic::BucketQueue".
+//
+// Monotone radix (bucket) queue over the integer DbU distances. A
+// vertex of distance d is stored in the bucket of the most significant
+// bit differing from the last extracted distance. Bucket 0 holds the
+// vertexes at exactly the minimal distance and is kept as a binary
+// heap so the attractor/branch tie-break is preserved.
+//
+// Dijkstra is monotone between two tracebacks only, pushing a distance
+// lower than the last extracted one rebases the whole queue (O(n)),
+// which happens once per reached target.
+
+  class BucketQueue : public BaseQueue {
+    public:
+      static const size_t  BucketCount = 65;
+    public:
+      inline                BucketQueue ();
+      inline        bool    empty       () const;
+      inline        size_t  size        () const;
+      inline        bool    contains    ( const Vertex* ) const;
+                    void    push        ( Vertex* );
+      inline        void    erase       ( Vertex* );
+                    Vertex* top         ();
+                    void    pop         ();
+                    void    clear       ();
+                    void    dump        () const;
+    private:
+      inline        size_t  _getBucket  ( DbU::Unit ) const;
+                    void    _insert     ( const Entry& );
+                    void    _remove     ( Vertex* );
+                    void    _rebase     ( DbU::Unit );
+                    bool    _refill     ();
+    private:
+      DbU::Unit           _last;
+      size_t              _size;
+      std::vector<Entry>  _buckets [BucketCount];
+  };
+
+
+  inline         BucketQueue::BucketQueue () : BaseQueue(), _last(0), _size(0), _buckets() { }
+  inline bool    BucketQueue::empty       () const { return _size == 0; }
+  inline size_t  BucketQueue::size        () const { return _size; }
+
+  inline bool  BucketQueue::contains ( const Vertex* v ) const
+  { return (v->getQueueIndex() != Vertex::npos); }
+
+  inline void  BucketQueue::erase ( Vertex* v )
+  { if (contains(v)) _remove( v ); }
+
+  inline size_t  BucketQueue::_getBucket ( DbU::Unit distance ) const
+  {
+    uint64_t diff = (uint64_t)distance ^ (uint64_t)_last;
+    return (diff) ? 64 - __builtin_clzll(diff) : 0;
+  }
+
+
+// -------------------------------------------------------------------
+// Class  :  "Anabatic::SetQueue".
+//
+// Original multiset based queue, kept for comparison purposes.
+// Erase is a linear scan.
 
-  class PriorityQueue2 {
+  class SetQueue {
     public:
-      inline                PriorityQueue2 ();
-      inline               ~PriorityQueue2 ();
-      inline        bool    empty          () const;
-      inline        size_t  size           () const;
-      inline        void    push           ( Vertex* );
-      inline        void    erase          ( Vertex* );
-      inline        Vertex* top            ();
-      inline        void    pop            ();
-      inline        void    clear          ();
-      inline        void    dump           () const;
-      inline        void    setAttractor   ( const Point& );
-      inline  const Point&  getAttractor   () const;
-      inline        bool    hasAttractor   () const;
+      inline                SetQueue     ();
+      inline               ~SetQueue     ();
+      inline        bool    empty        () const;
+      inline        size_t  size         () const;
+      inline        void    push         ( Vertex* );
+      inline        void    erase        ( Vertex* );
+      inline        Vertex* top          ();
+      inline        void    pop          ();
+      inline        void    clear        ();
+      inline        void    dump         () const;
+      inline        void    setAttractor ( const Point& );
+      inline  const Point&  getAttractor () const;
+      inline        bool    hasAttractor () const;
     private:
       class CompareByDistance {
         public:
                  inline      CompareByDistance ();
                         bool operator()        ( const Vertex* lhs, const Vertex* rhs ) const;
-          static inline void setQueue          ( PriorityQueue2* );
+          static inline void setQueue          ( SetQueue* );
         private:
-          static PriorityQueue2* _pqueue;
+          static SetQueue* _pqueue;
       };
     private:
-      struct  IndexByDistance { };
-      struct  IndexByPointer  { };
-      typedef boost::multi_index_container<
-                Vertex*,
-                boost::multi_index::indexed_by<
-                  boost::multi_index::ordered_non_unique<
-                    boost::multi_index::tag<IndexByDistance>,
-                    boost::multi_index::identity<Vertex*>,
-                    CompareByDistance
-                  >,
-                  boost::multi_index::hashed_unique<
-                    boost::multi_index::tag<IndexByPointer>,
-                    boost::multi_index::identity<Vertex*>
-                  >
-                >
-              > DualQueue;
-    private:
-      bool       _hasAttractor;
-      Point      _attractor;
-      DualQueue  _queue;
+      bool                                 _hasAttractor;
+      Point                                _attractor;
+      multiset<Vertex*,CompareByDistance>  _queue;
   };
 
 
-  inline      PriorityQueue2::CompareByDistance::CompareByDistance () { }
+  inline      SetQueue::CompareByDistance::CompareByDistance () { }
 
-  inline void PriorityQueue2::CompareByDistance::setQueue ( PriorityQueue2* pqueue ) { _pqueue = pqueue; }
+  inline void SetQueue::CompareByDistance::setQueue ( SetQueue* pqueue ) { _pqueue = pqueue; }
 
 
-  inline               PriorityQueue2::PriorityQueue2  () : _hasAttractor(false), _attractor(), _queue() { PriorityQueue2::CompareByDistance::setQueue(this); }
-  inline               PriorityQueue2::~PriorityQueue2 () { }
-  inline       bool    PriorityQueue2::empty          () const { return _queue.empty(); }
-  inline       size_t  PriorityQueue2::size           () const { return _queue.size(); }
-  inline       void    PriorityQueue2::push           ( Vertex* v ) { _queue.insert(v); v->setFlags(Vertex::Queued); }
-  inline       Vertex* PriorityQueue2::top            () { return _queue.empty() ? NULL : *_queue.begin(); }
-  inline       void    PriorityQueue2::clear          () { _queue.clear(); _hasAttractor=false; }
-  inline       void    PriorityQueue2::setAttractor   ( const Point& p ) { _attractor=p;  _hasAttractor=true; }
-  inline       bool    PriorityQueue2::hasAttractor   () const { return _hasAttractor; }
-  inline const Point&  PriorityQueue2::getAttractor   () const { return _attractor; }
+  inline               SetQueue::SetQueue     () : _hasAttractor(false), _attractor(), _queue() { SetQueue::CompareByDistance::setQueue(this); }
+  inline               SetQueue::~SetQueue    () { }
+  inline       bool    SetQueue::empty        () const { return _queue.empty(); }
+  inline       size_t  SetQueue::size         () const { return _queue.size(); }
+  inline       void    SetQueue::push         ( Vertex* v ) { _queue.insert(v); v->setFlags(Vertex::Queued); }
+  inline       Vertex* SetQueue::top          () { return _queue.empty() ? NULL : *_queue.begin(); }
+  inline       void    SetQueue::clear        () { _queue.clear(); _hasAttractor=false; }
+  inline       void    SetQueue::setAttractor ( const Point& p ) { _attractor=p;  _hasAttractor=true; }
+  inline       bool    SetQueue::hasAttractor () const { return _hasAttractor; }
+  inline const Point&  SetQueue::getAttractor () const { return _attractor; }
 
-  inline void  PriorityQueue2::pop ()
+  inline void  SetQueue::pop ()
   {
     cdebug_log(112,0) << "Pop: (size:" << _queue.size() << ") " << *_queue.begin() << std::endl;
     (*_queue.begin())->unsetFlags( Vertex::Queued );
     _queue.erase(_queue.begin());
   }
 
-  inline void  PriorityQueue2::erase ( Vertex* v )
+  inline void  SetQueue::erase ( Vertex* v )
   {
-    _queue.get<IndexByPointer>().erase( v );
+    if (not v->isQueued())
+      return;
+    for ( auto ivertex=_queue.begin(); ivertex != _queue.end() ; ++ivertex ) {
+      if (*ivertex == v) { _queue.erase( ivertex ); return; }
+    }
+    std::cerr << Error( "SetQueue::erase(): Unable to remove %s."
+                      , v->_getString().c_str() ) << std::endl;
   }
 
-  inline void  PriorityQueue2::dump () const
+  inline void  SetQueue::dump () const
   {
     if (cdebug.enabled(112)) {
-      cdebug_log(112,1) << "PriorityQueue2::dump() size:" << size() << std::endl;
+      cdebug_log(112,1) << "SetQueue::dump() size:" << size() << std::endl;
       size_t order = 0;
       for ( Vertex* v : _queue )
         cdebug_log(112,0) << "[" << tsetw(3) << order++ << "] " << v << std::endl;
@@ -519,11 +717,20 @@ namespace Anabatic {
 
 // -------------------------------------------------------------------
 // Class  :  "Anabatic::PriorityQueue".
+//
+// The queue used by Dijkstra. Dispatch to one of the implementations
+// above, selected through Dijkstra::Mode.
 
   class PriorityQueue {
+    public:
+      enum Kind { Heap   = 0
+                , Bucket = 1
+                , Set    = 2
+                };
     public:
       inline                PriorityQueue ();
-      inline               ~PriorityQueue ();
+      inline        Kind    getKind       () const;
+      inline        void    setKind       ( Kind );
       inline        bool    empty         () const;
       inline        size_t  size          () const;
       inline        void    push          ( Vertex* );
@@ -533,84 +740,110 @@ namespace Anabatic {
       inline        void    clear         ();
       inline        void    dump          () const;
       inline        void    setAttractor  ( const Point& );
-      inline  const Point&  getAttractor  () const;
-      inline        bool    hasAttractor  () const;
     private:
-      class CompareByDistance {
-        public:
-                 inline      CompareByDistance ();
-                        bool operator()        ( const Vertex* lhs, const Vertex* rhs ) const;
-          static inline void setQueue          ( PriorityQueue* );
-        private:
-          static PriorityQueue* _pqueue;
-      };
-    private:
-      bool                                 _hasAttractor;
-      Point                                _attractor;
-      multiset<Vertex*,CompareByDistance>  _queue;
+      Kind         _kind;
+      HeapQueue    _heap;
+      BucketQueue  _bucket;
+      SetQueue     _set;
   };
 
 
-  inline      PriorityQueue::CompareByDistance::CompareByDistance () { }
+  inline PriorityQueue::PriorityQueue () : _kind(Heap), _heap(), _bucket(), _set() { }
+  inline PriorityQueue::Kind  PriorityQueue::getKind () const { return _kind; }
 
-  inline void PriorityQueue::CompareByDistance::setQueue ( PriorityQueue* pqueue ) { _pqueue = pqueue; }
+  inline void  PriorityQueue::setKind ( Kind kind )
+  {
+    if (kind == _kind) return;
+    clear();
+    _kind = kind;
+  }
 
+  inline bool  PriorityQueue::empty () const
+  {
+    switch ( _kind ) {
+      case Bucket: return _bucket.empty();
+      case Set:    return _set   .empty();
+      default:     break;
+    }
+    return _heap.empty();
+  }
 
-  inline               PriorityQueue::PriorityQueue  () : _hasAttractor(false), _attractor(), _queue() { PriorityQueue::CompareByDistance::setQueue(this); }
-  inline               PriorityQueue::~PriorityQueue () { }
-  inline       bool    PriorityQueue::empty          () const { return _queue.empty(); }
-  inline       size_t  PriorityQueue::size           () const { return _queue.size(); }
-  inline       void    PriorityQueue::push           ( Vertex* v ) { _queue.insert(v); v->setFlags(Vertex::Queued); }
-  inline       Vertex* PriorityQueue::top            () { return _queue.empty() ? NULL : *_queue.begin(); }
-  inline       void    PriorityQueue::clear          () { _queue.clear(); _hasAttractor=false; }
-  inline       void    PriorityQueue::setAttractor   ( const Point& p ) { _attractor=p;  _hasAttractor=true; }
-  inline       bool    PriorityQueue::hasAttractor   () const { return _hasAttractor; }
-  inline const Point&  PriorityQueue::getAttractor   () const { return _attractor; }
+  inline size_t  PriorityQueue::size () const
+  {
+    switch ( _kind ) {
+      case Bucket: return _bucket.size();
+      case Set:    return _set   .size();
+      default:     break;
+    }
+    return _heap.size();
+  }
 
-  inline void  PriorityQueue::pop ()
+  inline void  PriorityQueue::push ( Vertex* v )
   {
-    cdebug_log(112,0) << "Pop: (size:" << _queue.size() << ") " << *_queue.begin() << std::endl;
-    (*_queue.begin())->unsetFlags( Vertex::Queued );
-    _queue.erase(_queue.begin());
+    switch ( _kind ) {
+      case Bucket: _bucket.push( v ); return;
+      case Set:    _set   .push( v ); return;
+      default:     break;
+    }
+    _heap.push( v );
   }
 
   inline void  PriorityQueue::erase ( Vertex* v )
   {
-    // auto ivertex = _queue.upper_bound( v );
-    // while ( true ) {
-    //   if (*ivertex == v) {
-    //     _queue.erase( ivertex );
-    //     return;
-    //   }
-    //   if (ivertex == _queue.begin()) break;
-    //   --ivertex;
-    // }
-    // for ( ; ivertex != _queue.end() ; ++ivertex ) {
-    //   if (*ivertex == v) { _queue.erase( ivertex ); break; }
-    // }
-    if (not v->isQueued())
-      return;
-    // for ( auto ivertex=_queue.begin(); ivertex != _queue.end() ; ++ivertex ) {
-    //   if (*ivertex == v) { _queue.erase( ivertex ); return; }
-    // }
-    for ( auto ivertex=_queue.begin(); ivertex != _queue.end() ; ++ivertex ) {
-      if (*ivertex == v) { _queue.erase( ivertex ); return; }
+    switch ( _kind ) {
+      case Bucket: _bucket.erase( v ); return;
+      case Set:    _set   .erase( v ); return;
+      default:     break;
     }
-    std::cerr << Error( "PriorityQueue::erase(): Unable to remove %s."
-                      , v->_getString().c_str() ) << std::endl;
+    _heap.erase( v );
+  }
+
+  inline Vertex* PriorityQueue::top ()
+  {
+    switch ( _kind ) {
+      case Bucket: return _bucket.top();
+      case Set:    return _set   .top();
+      default:     break;
+    }
+    return _heap.top();
+  }
+
+  inline void  PriorityQueue::pop ()
+  {
+    switch ( _kind ) {
+      case Bucket: _bucket.pop(); return;
+      case Set:    _set   .pop(); return;
+      default:     break;
+    }
+    _heap.pop();
+  }
+
+  inline void  PriorityQueue::clear ()
+  {
+    _heap  .clear();
+    _bucket.clear();
+    _set   .clear();
   }
 
   inline void  PriorityQueue::dump () const
   {
-    if (cdebug.enabled(112)) {
-      cdebug_log(112,1) << "PriorityQueue::dump() size:" << size() << std::endl;
-      size_t order = 0;
-      for ( Vertex* v : _queue )
-        cdebug_log(112,0) << "[" << tsetw(3) << order++ << "] " << v << std::endl;
-      cdebug_tabw(112,-1);
+    switch ( _kind ) {
+      case Bucket: _bucket.dump(); return;
+      case Set:    _set   .dump(); return;
+      default:     break;
     }
+    _heap.dump();
   }
 
+  inline void  PriorityQueue::setAttractor ( const Point& p )
+  {
+    switch ( _kind ) {
+      case Bucket: _bucket.setAttractor( p ); return;
+      case Set:    _set   .setAttractor( p ); return;
+      default:     break;
+    }
+    _heap.setAttractor( p );
+  }
 
 // -------------------------------------------------------------------
 // Class  :  "Anabatic::Dijkstra".
@@ -620,10 +853,14 @@ namespace Anabatic {
     // Mode sub-classe.
       class Mode : public Hurricane::BaseFlags {
         public:
-          enum Flag { NoMode     = 0
-                    , Standart   = (1<<0)
-                    , Monotonic  = (1<<1)
-                    , AxisTarget = (1<<2)
+          enum Flag { NoMode         = 0
+                    , Standart       = (1<<0)
+                    , Monotonic      = (1<<1)
+                    , AxisTarget     = (1<<2)
+                    , UseBucketQueue = (1<<3)
+                    , UseSetQueue    = (1<<4)
+                    , AStar          = (1<<5)
+                    , Bidirectional  = (1<<6)
                     };
         public:
           inline               Mode         ( Flag flags=NoMode );
@@ -634,8 +871,10 @@ namespace Anabatic {
       };
     public:
       typedef std::function<DbU::Unit(const Vertex*,const Vertex*,const Edge*)>  distance_t;
+      typedef std::pair<DbU::Unit,Vertex*>                                        REntry;
     public:
                               Dijkstra                 ( AnabaticEngine* );
+                              Dijkstra                 ( const Dijkstra* shared );
                              ~Dijkstra                 ();
     public:                                            
       inline       bool       isBipoint                () const;
@@ -644,12 +883,18 @@ namespace Anabatic {
       inline       bool       isTargetVertex           ( Vertex* ) const;
                    DbU::Unit  getAntennaGateMaxWL      () const;
       inline       DbU::Unit  getSearchAreaHalo        () const;
+      inline const Box&       getSearchArea            () const;
       template<typename DistanceT>                     
       inline       DistanceT* setDistance              ( DistanceT );
       inline       void       setSearchAreaHalo        ( DbU::Unit );
-                   void       load                     ( Net* net ); 
+      inline       void       setEstimateScale         ( float hscale, float vscale );
+      inline       uint64_t   getExpandeds             () const;
+      inline       uint64_t   getTotalExpandeds        () const;
+                   void       load                     ( Net* net, bool newStamp=true ); 
                    void       loadFixedGlobal          ( Net* net ); 
                    void       run                      ( Mode mode=Mode::Standart );
+                   bool       search                   ( Mode mode=Mode::Standart );
+                   void       materialize              ();
       inline const VertexSet& getSources               () const;
     private:                                           
                                Dijkstra                ( const Dijkstra& );
@@ -658,6 +903,12 @@ namespace Anabatic {
                    Point      _getPonderedPoint        () const;
                    void       _cleanup                 ();
                    bool       _propagate               ( Flags enabledSides );
+                   bool       _propagateBidirectional  ();
+                   bool       _isBidirectional         () const;
+                   DbU::Unit  _getBackwardDistance     ( Vertex*, Vertex*, Edge* );
+                   DbU::Unit  _getEstimate             ( const Vertex* ) const;
+                   void       _updateTargetsBox        ();
+                   void       _push                    ( Vertex* );
                    void       _traceback               ( Vertex* );
                    void       _materialize             ();
                    void       _selectFirstSource       ();
@@ -697,6 +948,14 @@ namespace Anabatic {
       int              _connectedsId;
       PriorityQueue    _queue;
       Flags            _flags;
+      bool             _useEstimate;
+      float            _estimateHScale;
+      float            _estimateVScale;
+      Box              _targetsBox;
+      vector<REntry>   _rqueue;
+      vector<Vertex*>  _rvisiteds;
+      uint64_t         _expandeds;
+      uint64_t         _totalExpandeds;
   };
 
 
@@ -708,7 +967,11 @@ namespace Anabatic {
   inline bool       Dijkstra::isTargetVertex    ( Vertex* v ) const { return (_targets.find(v) != _targets.end()); }
   inline Net*       Dijkstra::getNet            () const { return _net; }
   inline DbU::Unit  Dijkstra::getSearchAreaHalo () const { return _searchAreaHalo; }
+  inline const Box& Dijkstra::getSearchArea     () const { return _searchArea; }
   inline void       Dijkstra::setSearchAreaHalo ( DbU::Unit halo ) { _searchAreaHalo = halo; }
+  inline void       Dijkstra::setEstimateScale  ( float hscale, float vscale ) { _estimateHScale=hscale; _estimateVScale=vscale; }
+  inline uint64_t   Dijkstra::getExpandeds      () const { return _expandeds; }
+  inline uint64_t   Dijkstra::getTotalExpandeds () const { return _totalExpandeds; }
 
   template<typename DistanceT>
   inline DistanceT* Dijkstra::setDistance       ( DistanceT cb ) { _distanceCb = cb; return _distanceCb.target<DistanceT>(); }
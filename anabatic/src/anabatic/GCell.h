@@ -243,6 +243,7 @@ namespace Anabatic {
                     float                 getAverageHVDensity  () const;
                     float                 getMaxHVDensity      () const;
       inline        float                 getCDensity          ( Flags flags=Flags::NoFlags ) const;
+      inline        float                 getCongestion        () const;
                     float                 getWDensity          ( size_t depth, Flags flags=Flags::NoFlags  ) const;
       inline        DbU::Unit             getBlockage          ( size_t depth ) const;
       inline        float                 getFragmentation     ( size_t depth ) const;
@@ -277,6 +278,7 @@ namespace Anabatic {
                     void                  updateGContacts      ( Flags flags );
                     void                  updateContacts       ();
                     size_t                updateDensity        ();
+      inline        void                  invalidateDensity    ();
       inline        void                  updateKey            ( size_t depth );
                     void                  truncDensities       ();
                     bool                  stepBalance          ( size_t depth, Set& invalidateds );
@@ -297,6 +299,7 @@ namespace Anabatic {
                     void                  _destroyEdges        ();
     private:                                                   
                     void                  _moveEdges           ( GCell* dest, size_t ibegin, Flags flags );
+                    void                  _setDensityDirty     ();
     public:                                                    
     // Observers.                                              
       template<typename OwnerT>                                
@@ -348,6 +351,7 @@ namespace Anabatic {
               int                   _rpCount;
               DbU::Unit*            _blockages;
               float                 _cDensity;
+              float                 _congestion;
               float*                _densities;
               float*                _feedthroughs;
               float*                _fragmentations;
@@ -485,14 +489,23 @@ namespace Anabatic {
   inline  DbU::Unit  GCell::getBlockage ( size_t depth ) const
   { return (depth<_depth) ? _blockages[depth] : 0; }
 
+  inline  float  GCell::getCongestion () const
+  { return _congestion; }
+
+  inline  void  GCell::invalidateDensity ()
+  {
+    _flags |= Flags::Invalidated;
+    if (not (_flags & Flags::DensityDirty)) _setDensityDirty();
+  }
+
   inline  void  GCell::addHSegment ( AutoSegment* segment )
-  { _flags |= Flags::Invalidated; _hsegments.push_back(segment); }
+  { invalidateDensity(); _hsegments.push_back(segment); }
 
   inline void  GCell::addVSegment ( AutoSegment* segment )
-  { _flags |= Flags::Invalidated; _vsegments.push_back(segment); }
+  { invalidateDensity(); _vsegments.push_back(segment); }
 
   inline  void  GCell::addContact ( AutoContact* contact )
-  { _flags |= Flags::Invalidated; _contacts.push_back(contact); }
+  { invalidateDensity(); _contacts.push_back(contact); }
 
   inline bool GCell::isSatProcessed ( size_t depth ) const
   { return (_satProcessed & (1 << depth)); }
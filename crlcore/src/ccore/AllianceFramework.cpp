@@ -345,6 +345,8 @@ namespace CRL {
 
   Cell* AllianceFramework::getCell ( const string& name, unsigned int mode, unsigned int depth )
   {
+  // The masters loaded by the parsers are located in the same pass.
+    SearchPath::Pass  pass       ( _environment.getLIBRARIES() );
     bool              createCell = false;
     Catalog::State*   state      = _catalog.getState( name );
     ParserFormatSlot* parser;
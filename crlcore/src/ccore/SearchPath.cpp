@@ -14,6 +14,8 @@
 // +-----------------------------------------------------------------+
 
 
+#include <dirent.h>
+#include <sys/stat.h>
 #include "crlcore/SearchPath.h"
 
 
@@ -31,6 +33,58 @@ namespace CRL {
   }
 
 
+  bool  SearchPath::Element::_listFiles ( time_t mtime ) const
+  {
+    _files.clear();
+    _listed = false;
+
+    DIR* fdir = opendir( _path.c_str() );
+    if (not fdir) return false;
+
+    struct dirent* fentry = NULL;
+    while ( (fentry = readdir(fdir)) != NULL ) _files.insert( fentry->d_name );
+    closedir( fdir );
+
+    _mtime  = mtime;
+    _listed = true;
+    return true;
+  }
+
+
+// Tells if the file may be in the directory, without probing it with
+// an open(). The listing of the directory is cached and rebuilt only
+// when its st_mtime changes, which is checked on a miss (a hit is
+// confirmed by the actual open). Inside a lookup pass (non zero pass,
+// see SearchPath::Pass) the directory is stat'ed only once, a file
+// appearing meanwhile is seen by the next pass. As st_mtime has a one
+// second resolution, a file created by another process in the second
+// of the listing may be missed; the ones created through locate() in
+// write mode invalidate the listing.
+  bool  SearchPath::Element::mayContain ( const string& file, uint64_t pass ) const
+  {
+    if (file.find('/') != string::npos) return true;
+    if (_listed and _files.count(file)) return true;
+
+    if (not pass or (pass != _statPass)) {
+      _statPass = pass;
+
+      struct stat status;
+      _exists = (stat( _path.c_str(), &status ) == 0);
+      if (not _exists) {
+        _files.clear();
+        _listed = false;
+        return false;
+      }
+      if (not _listed or (status.st_mtime != _mtime)) {
+        if (not _listFiles(status.st_mtime)) return true;
+        return _files.count( file );
+      }
+    }
+    if (not _exists) return false;
+    return not _listed;
+  }
+
+
   Record *SearchPath::Element::_getRecord () const
   {
     Record* record = new Record ( "<SearchPath::Element>" );
@@ -44,9 +98,11 @@ namespace CRL {
 
 
   SearchPath::SearchPath ()
-    : _paths   ()
-    , _index   (npos)
-    , _selected(_selectFailed)
+    : _paths    ()
+    , _index    (npos)
+    , _selected (_selectFailed)
+    , _pass     (0)
+    , _passDepth(0)
   { }
 
 
@@ -111,10 +167,22 @@ namespace CRL {
 
   size_t  SearchPath::locate ( const string& file, ios::openmode mode, int first, int last )
   {
-    if ( hasSelected() and _canOpen(_paths[_index],file,mode) ) return _index;
+  // When reading, the directories that cannot hold the file are skipped.
+  // When writing, the listing of the selected directory is dropped.
+    bool     reading = not (mode & ios::out);
+    uint64_t pass    = (_passDepth) ? _pass : 0;
+
+    if (    hasSelected()
+       and (not reading or _paths[_index].mayContain(file,pass))
+       and _canOpen(_paths[_index],file,mode) ) {
+      if (not reading) _paths[_index].invalidate();
+      return _index;
+    }
 
     for ( int i=max(0,first) ; i < min((int)_paths.size(),last) ; i++ ) {
+      if ( reading and not _paths[i].mayContain(file,pass) ) continue;
       if ( _canOpen(_paths[i],file,mode) ) {
+        if (not reading) _paths[i].invalidate();
         return _index = i;
       }
     }
@@ -18,6 +18,9 @@
 #include <cstdlib>
 #include <cstring>
 #include <cstdarg>
+#include <chrono>
+#include <charconv>
+#include <unordered_map>
 #include "hurricane/DataBase.h"
 #include "hurricane/RegularLayer.h"
 #include "hurricane/Technology.h"
@@ -36,9 +39,6 @@
 namespace {
 
 
-# define    LINE_SIZE    4096
-
-
   using namespace Hurricane;
   using namespace CRL;
 
@@ -97,11 +97,13 @@ namespace {
   { return _layer; }
 
 
-  class LayerInformations : public map<const Name,LayerInformation> {
+// Looked up with the raw AP field, hence the string key (a Name would
+// go through the global Name table on each segment).
+  class LayerInformations : public unordered_map<string,LayerInformation> {
     public:
       void        setTechnology  ( Technology* technology );
-      void        add            ( const Name& apLayer
-                                 , const Name& hLayer
+      void        add            ( const string& apLayer
+                                 , const Name&   hLayer
                                  , bool        isConnectorapLayer
                                  , bool        isBlockage
                                  );
@@ -114,10 +116,10 @@ namespace {
   { _technology = technology; }
 
 
-  void  LayerInformations::add ( const Name& apLayer
-                               , const Name& hLayer
-                               , bool        isConnector
-                               , bool        isBlockage
+  void  LayerInformations::add ( const string& apLayer
+                               , const Name&   hLayer
+                               , bool          isConnector
+                               , bool          isBlockage
                                )
   {
     insert ( make_pair( apLayer
@@ -132,8 +134,9 @@ namespace {
 
   class ApParser {
     public:
-                   ApParser     ( AllianceFramework* af );
-             void  loadFromFile ( const string& cellPath, Cell* cell );
+                    ApParser      ( AllianceFramework* af );
+      inline size_t getLineNumber () const;
+             void   loadFromFile  ( const string& cellPath, Cell* cell );
 
     private:
       enum ParserState      { StateVersion
@@ -151,22 +154,30 @@ namespace {
                             , DirectionLeft      =DirectionHorizontal|DirectionDecrease
                             , DirectionRight     =DirectionHorizontal|DirectionIncrease
                             };
-             LayerInformations  _layerInformations;
-             AllianceFramework* _framework;
-             string             _cellPath;
-             Cell*              _cell;
-             Catalog::State*    _state;
-             double             _scaleRatio;
-             int                _parserState;
-             size_t             _lineNumber;
-             char               _rawLine[LINE_SIZE];
+             LayerInformations          _layerInformations;
+             AllianceFramework*         _framework;
+             string                     _cellPath;
+             Cell*                      _cell;
+             Catalog::State*            _state;
+             double                     _scaleRatio;
+             int                        _parserState;
+             size_t                     _lineNumber;
+             vector<char>               _buffer;
+             char*                      _cursor;
+             char*                      _rawLine;
+             vector<char*>              _fields;
+             unordered_map<string,Net*> _netsLookup;
+             Net*                       _fusedNet;
 
     protected:
     // Internal: Methods.
-             LayerInformation*  _getLayerInformation ( const Name& layerName );
+             bool               _readFile            ( const string& cellPath );
+             char*              _readLine            ();
+             LayerInformation*  _getLayerInformation ( const char* layerName );
+      inline long               _getLong             ( const char* value );
       inline DbU::Unit          _getUnit             ( long value );
       inline DbU::Unit          _getUnit             ( const char* value );
-             vector<char*>      _splitString         ( char* s, char separator );
+      const  vector<char*>&     _splitString         ( char* s, char separator );
              Net*               _getNet              ( const char* apName );
              Net*               _getFusedNet         ();
              Net*               _safeGetNet          ( const char* apName );
@@ -193,6 +204,12 @@ namespace {
     , _scaleRatio (100.0)
     , _parserState(StateVersion)
     , _lineNumber (0)
+    , _buffer     ()
+    , _cursor     (NULL)
+    , _rawLine    (NULL)
+    , _fields     ()
+    , _netsLookup ()
+    , _fusedNet   (NULL)
   {
     _layerInformations.setTechnology ( DataBase::getDB()->getTechnology() );
 
@@ -259,9 +276,53 @@ namespace {
   }
 
 
-  LayerInformation* ApParser::_getLayerInformation ( const Name& layerName )
+  inline size_t  ApParser::getLineNumber () const { return _lineNumber; }
+
+
+  bool  ApParser::_readFile ( const string& cellPath )
+  {
+  // The whole file is loaded at once, the lines and fields are then
+  // split in place (NUL terminated) without any further copy.
+    FILE* file = fopen( cellPath.c_str(), "r" );
+    if (not file) return false;
+
+    _buffer.clear();
+    char   chunk[65536];
+    size_t length;
+    while ( (length = fread( chunk, 1, sizeof(chunk), file )) > 0 )
+      _buffer.insert( _buffer.end(), chunk, chunk+length );
+    bool success = not ferror( file );
+    fclose( file );
+
+    _buffer.push_back( '\0' );
+    _cursor  = _buffer.data();
+    _rawLine = _cursor;
+    return success;
+  }
+
+
+  char* ApParser::_readLine ()
+  {
+  // Past the last line, returns the terminal empty string (end of file).
+    char* end = _buffer.data() + _buffer.size() - 1;
+    if (_cursor >= end) return (_rawLine = end);
+
+    _rawLine = _cursor;
+    char* eol = (char*)memchr( _cursor, '\n', end-_cursor );
+    if (eol) {
+      *eol    = '\0';
+      _cursor = eol + 1;
+    } else
+      _cursor = end;
+    ++_lineNumber;
+
+    return _rawLine;
+  }
+
+
+  LayerInformation* ApParser::_getLayerInformation ( const char* layerName )
   {
-    map<const Name, LayerInformation>::iterator  it = _layerInformations.find ( layerName );
+    LayerInformations::iterator  it = _layerInformations.find ( layerName );
     if ( it != _layerInformations.end() )
       return &(it->second);
 
@@ -269,42 +330,48 @@ namespace {
   }
 
 
-  vector<char*>  ApParser::_splitString ( char* s, char separator )
+  const vector<char*>& ApParser::_splitString ( char* s, char separator )
   {
-    vector<char*>  fields;
-
-    fields.push_back ( s );
-    while ( *s != '\0' ) {
-      if ( *s == separator ) {
-        fields.push_back ( s+1 );
-        *s = '\0';
-      }
-      s++;
+    _fields.clear();
+    _fields.push_back ( s );
+    while ( (s = strchr(s,separator)) ) {
+      *s++ = '\0';
+      _fields.push_back ( s );
     }
 
-    return fields;
+    return _fields;
   }
 
 
-  inline DbU::Unit  ApParser::_getUnit ( long value )
+  inline long  ApParser::_getLong ( const char* value )
   {
-    return DbU::lambda ( _scaleRatio*value );
-  }
-
+    while ( *value == ' ' ) ++value;
+    if    ( *value == '+' ) ++value;
 
-  inline DbU::Unit  ApParser::_getUnit ( const char* value )
-  {
-    char* end;
-    long  convert = strtol ( value, &end, 10 );
+    long        convert = 0;
+    const char* end     = value + strlen( value );
+    auto        result  = std::from_chars( value, end, convert );
 
-    if ( *end != '\0' )
+    if ( (result.ec != std::errc()) or (result.ptr != end) )
       _printError ( false
                   , "Incomplete string to integer conversion for \"%s\" (%ld)."
                   , value
                   , convert
                   );
 
-    return _getUnit ( convert );
+    return convert;
+  }
+
+
+  inline DbU::Unit  ApParser::_getUnit ( long value )
+  {
+    return DbU::lambda ( _scaleRatio*value );
+  }
+
+
+  inline DbU::Unit  ApParser::_getUnit ( const char* value )
+  {
+    return _getUnit ( _getLong(value) );
   }
 
 
@@ -312,10 +379,10 @@ namespace {
   {
     if ( *value == '\0' ) return DirectionUndefined;
 
-    if ( string("UP"   ).compare(value) == 0 ) return DirectionUp;
-    if ( string("DOWN" ).compare(value) == 0 ) return DirectionDown;
-    if ( string("LEFT" ).compare(value) == 0 ) return DirectionLeft;
-    if ( string("RIGHT").compare(value) == 0 ) return DirectionRight;
+    if ( not strcmp(value,"UP"   ) ) return DirectionUp;
+    if ( not strcmp(value,"DOWN" ) ) return DirectionDown;
+    if ( not strcmp(value,"LEFT" ) ) return DirectionLeft;
+    if ( not strcmp(value,"RIGHT") ) return DirectionRight;
 
     return DirectionUndefined;
   }
@@ -323,6 +390,9 @@ namespace {
 
   Net* ApParser::_getNet ( const char* apName )
   {
+    auto inet = _netsLookup.find( apName );
+    if (inet != _netsLookup.end()) return (*inet).second;
+
     string hName = apName;
 
     size_t  separator = hName.find ( ' ' );
@@ -350,6 +420,7 @@ namespace {
         net->setType   ( Net::Type::BLOCKAGE );
       }
     }
+    _netsLookup.insert( make_pair( string(apName), net ));
 
     return net;
   }
@@ -357,14 +428,16 @@ namespace {
 
   Net* ApParser::_getFusedNet ()
   {
+    if (_fusedNet) return _fusedNet;
+
     Name fusedName = "fused_net";
-    Net* net       = _cell->getNet( fusedName );
-    if (not net) {
-      net = Net::create ( _cell, fusedName );
-      net->setAutomatic ( true );
-      net->setType      ( Net::Type::FUSED );
+    _fusedNet = _cell->getNet( fusedName );
+    if (not _fusedNet) {
+      _fusedNet = Net::create ( _cell, fusedName );
+      _fusedNet->setAutomatic ( true );
+      _fusedNet->setType      ( Net::Type::FUSED );
     }
-    return net;
+    return _fusedNet;
   }
 
 
@@ -392,7 +465,7 @@ namespace {
   {
     if ( _rawLine[0] != 'H' ) _printError ( true, "Missing Cell Header." );
           
-    vector<char*>  fields = _splitString ( _rawLine+2, ',' );
+    const vector<char*>& fields = _splitString ( _rawLine+2, ',' );
 
     if ( fields.size() < 4 )
       _printError ( true, "Malformed header line." );
@@ -417,7 +490,7 @@ namespace {
       DbU::Unit  XAB2 = 10;
       DbU::Unit  YAB2 = 10;
 
-      vector<char*>  fields = _splitString ( _rawLine+2, ',' );
+      const vector<char*>& fields = _splitString ( _rawLine+2, ',' );
       if ( fields.size() < 4 )
         _printError ( false, "Malformed Abutment Box line." );
       else {
@@ -437,7 +510,7 @@ namespace {
   {
     DbU::Unit  XREF, YREF;
 
-    vector<char*>  fields = _splitString ( _rawLine+2, ',' );
+    const vector<char*>& fields = _splitString ( _rawLine+2, ',' );
     if ( fields.size() < 4 )
       _printError ( false, "Malformed Reference line." );
     else {
@@ -459,13 +532,9 @@ namespace {
   //       Pin*                  pin;
            LayerInformation*     layerInfo;
            Pin::AccessDirection  accessDirection;
-           Name                  orientation;
-    static Name                  NORTH = "NORTH";
-    static Name                  SOUTH = "SOUTH";
-    static Name                  EAST  = "EAST";
-    static Name                  WEST  = "WEST";
+           const char*           orientation;
 
-    vector<char*>  fields = _splitString( _rawLine+2, ',' );
+    const vector<char*>& fields = _splitString( _rawLine+2, ',' );
     if (fields.size() < 7)
       _printError ( false, "Malformed Connector line." );
     else {
@@ -476,7 +545,7 @@ namespace {
       orientation = fields[5];
 
       index       = -1;
-      if (fields[4][0] != '\0') index = atoi( fields[4] );
+      if (fields[4][0] != '\0') index = _getLong( fields[4] );
 
       size_t length = strlen( fields[3] );
       if (length > 1000) {
@@ -497,16 +566,16 @@ namespace {
       net       = _getNet             ( fields[3] );
       layerInfo = _getLayerInformation( fields[6] );
 
-      if(orientation == NORTH) {
+      if (not strcmp(orientation,"NORTH")) {
         accessDirection = Pin::AccessDirection::NORTH;
         HEIGHT          = layerInfo->getLayer()->getMinimalSize();
-      } else if (orientation == SOUTH) {
+      } else if (not strcmp(orientation,"SOUTH")) {
         accessDirection = Pin::AccessDirection::SOUTH;
         HEIGHT          = layerInfo->getLayer()->getMinimalSize();
-      } else if (orientation == WEST ) {
+      } else if (not strcmp(orientation,"WEST" )) {
         accessDirection = Pin::AccessDirection::WEST;
         WIDTH           = layerInfo->getLayer()->getMinimalSize();
-      } else if (orientation == EAST ) {
+      } else if (not strcmp(orientation,"EAST" )) {
         accessDirection = Pin::AccessDirection::EAST;
         WIDTH           = layerInfo->getLayer()->getMinimalSize();
       } else {
@@ -539,7 +608,7 @@ namespace {
     Net*              net;
     LayerInformation* layerInfo;
 
-    vector<char*>  fields = _splitString ( _rawLine+2, ',' );
+    const vector<char*>& fields = _splitString ( _rawLine+2, ',' );
     if ( fields.size() < 4 )
       _printError ( false, "Malformed VIA line." );
     else {
@@ -562,7 +631,7 @@ namespace {
     Net*              net;
     LayerInformation* layerInfo;
 
-    vector<char*>  fields = _splitString ( _rawLine+2, ',' );
+    const vector<char*>& fields = _splitString ( _rawLine+2, ',' );
     if ( fields.size() < 6 )
       _printError ( false, "Malformed big VIA line." );
     else {
@@ -593,7 +662,7 @@ namespace {
     LayerInformation* layerInfo;
     SegmentDirection  segDir;
 
-    vector<char*>  fields = _splitString ( _rawLine+2, ',' );
+    const vector<char*>& fields = _splitString ( _rawLine+2, ',' );
     if ( fields.size() < 8 )
       _printError ( false, "Malformed Segment line." );
     else {
@@ -643,23 +712,15 @@ namespace {
 
   void  ApParser::_parseInstance ()
   {
-           DbU::Unit  XINS, YINS;
-           Name       masterCellName;
-           Name       instanceName;
-           Name       orientName;
+           DbU::Unit    XINS, YINS;
+           Name         masterCellName;
+           Name         instanceName;
+           const char*  orientName;
            Transformation::Orientation
-                      orient  = Transformation::Orientation::ID;
-    static Name       NOSYM   = "NOSYM";
-    static Name       SYM_X   = "SYM_X";
-    static Name       SYM_Y   = "SYM_Y";
-    static Name       SYMXY   = "SYMXY";
-    static Name       ROT_P   = "ROT_P";
-    static Name       ROT_M   = "ROT_M";
-    static Name       SY_RM   = "SY_RM";
-    static Name       SY_RP   = "SY_RP";
-    static string     padreal = "padreal";
-
-    vector<char*>  fields = _splitString ( _rawLine+2, ',' );
+                        orient  = Transformation::Orientation::ID;
+    static string       padreal = "padreal";
+
+    const vector<char*>& fields = _splitString ( _rawLine+2, ',' );
     if ( fields.size() < 5 )
       _printError ( false, "Malformed instance line." );
     else {
@@ -669,16 +730,16 @@ namespace {
       instanceName   = fields[3];
       orientName     = fields[4];
 
-      if      (orientName == "NOSYM") orient = Transformation::Orientation::ID;
-      else if (orientName == "ROT_P") orient = Transformation::Orientation::R1;
-      else if (orientName == "SYMXY") orient = Transformation::Orientation::R2;
-      else if (orientName == "ROT_M") orient = Transformation::Orientation::R3;
-      else if (orientName == "SYM_X") orient = Transformation::Orientation::MX;
-      else if (orientName == "SY_RM") orient = Transformation::Orientation::XR;
-      else if (orientName == "SYM_Y") orient = Transformation::Orientation::MY;
-      else if (orientName == "SY_RP") orient = Transformation::Orientation::YR;
+      if      (not strcmp(orientName,"NOSYM")) orient = Transformation::Orientation::ID;
+      else if (not strcmp(orientName,"ROT_P")) orient = Transformation::Orientation::R1;
+      else if (not strcmp(orientName,"SYMXY")) orient = Transformation::Orientation::R2;
+      else if (not strcmp(orientName,"ROT_M")) orient = Transformation::Orientation::R3;
+      else if (not strcmp(orientName,"SYM_X")) orient = Transformation::Orientation::MX;
+      else if (not strcmp(orientName,"SY_RM")) orient = Transformation::Orientation::XR;
+      else if (not strcmp(orientName,"SYM_Y")) orient = Transformation::Orientation::MY;
+      else if (not strcmp(orientName,"SY_RP")) orient = Transformation::Orientation::YR;
       else
-        _printError( false, "Unknown orientation (%s).", getString(orientName).c_str() );
+        _printError( false, "Unknown orientation (%s).", orientName );
 
       Instance* instance = _cell->getInstance( instanceName );
       if (instance) {
@@ -792,22 +853,23 @@ namespace {
     _state->setPhysical ( true );
     if ( _framework->isPad(_cell) ) _state->setPad ( true );
 
-    IoFile fileStream ( cellPath );
-    fileStream.open ( "r" );
+    _lineNumber  = 0;
+    _netsLookup.clear();
+    _fusedNet    = NULL;
+    if (not _readFile(cellPath))
+      throw Error ( "ApParser::loadFromFile(): Unable to read \"%s\".", cellPath.c_str() );
 
     UpdateSession::open();
 
     bool  materializationState = Go::autoMaterializationIsDisabled ();
     Go::disableAutoMaterialization ();
 
-    _lineNumber  = 0;
     _parserState = StateVersion;
     _scaleRatio  = 100.0;
 
     try {
-      while ( !fileStream.eof() ) {
-        fileStream.readLine ( _rawLine, LINE_SIZE );
-        _lineNumber++;
+      while ( true ) {
+        _readLine ();
 
         if ( _rawLine[0] == '\0' ) {
           if ( _parserState == StateEOF ) break;
@@ -860,7 +922,7 @@ namespace {
     if (materializationState) Go::disableAutoMaterialization ();
     _cell->updatePlacedFlag();
 
-    fileStream.close ();
+    vector<char>().swap( _buffer );
   }
 
 
@@ -876,7 +938,12 @@ void  apParser ( const string cellPath, Cell *cell )
 
   ApParser  parser ( AllianceFramework::get() );
 
+  auto start = std::chrono::steady_clock::now();
   parser.loadFromFile ( cellPath, cell );
+  double seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+
+  cinfo << "     " << tab << "  " << cellPath << ": " << parser.getLineNumber()
+        << " lines in " << (seconds*1000.0) << "ms." << endl;
 }
 
 
@@ -35,9 +35,11 @@ namespace CRL {
       static const uint32_t     Layer_0_IsBoundary = (1<<1);
       static const uint32_t     NoBlockages        = (1<<2);
       static const uint32_t     LefForeign         = (1<<3);
+      static const uint32_t     Deduplicate        = (1<<4);
+      static const uint32_t     GzipOutput         = (1<<5);
       static       std::string  _topCellName;
     public:
-             static bool         save           ( Cell* );
+             static bool         save           ( Cell*, uint32_t flags=0 );
              static bool         load           ( Library*, std::string gdsPath, uint32_t flags=0 );
       inline static void         setTopCellName ( std::string );
       inline static std::string  getTopCellName ();
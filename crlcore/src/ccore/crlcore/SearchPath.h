@@ -17,8 +17,11 @@
 #ifndef  CRL_SEARCH_PATH_H
 #define  CRL_SEARCH_PATH_H
 
+#include <ctime>
+#include <cstdint>
 #include <string>
 #include <vector>
+#include <unordered_set>
 #include "hurricane/Commons.h"
 #include "hurricane/Slot.h"
 
@@ -37,12 +40,32 @@ namespace CRL {
           inline bool               empty        () const;
           inline const std::string& getPath      () const;
           inline const std::string& getName      () const;
+                 bool               mayContain   ( const std::string& file, uint64_t pass=0 ) const;
+          inline void               invalidate   () const;
           inline std::string        _getTypeName () const;
                  std::string        _getString   () const;
                  Record*            _getRecord   () const;
         private:
-          std::string  _path;
-          std::string  _name;
+                 bool               _listFiles   ( time_t mtime ) const;
+        private:
+                  std::string                      _path;
+                  std::string                      _name;
+          mutable std::unordered_set<std::string>  _files;
+          mutable time_t                           _mtime;
+          mutable bool                             _listed;
+          mutable bool                             _exists;
+          mutable uint64_t                         _statPass;
+      };
+    public:
+      class Pass {
+        public:
+          inline            Pass      ( SearchPath& );
+          inline           ~Pass      ();
+        private:
+                            Pass      ( const Pass& ) = delete;
+                 Pass&      operator= ( const Pass& ) = delete;
+        private:
+          SearchPath& _searchPath;
       };
     public:
       static const size_t       npos;
@@ -59,6 +82,8 @@ namespace CRL {
                                                ,       int                 first=0
                                                ,       int                 last =64 );
              void               select         ( const std::string& );
+      inline void               beginPass      ();
+      inline void               endPass        ();
       inline size_t             getSize        () const;
       inline const std::string& getSelected    () const;
       inline size_t             getIndex       () const;
@@ -71,6 +96,8 @@ namespace CRL {
              std::vector<Element>      _paths;
              size_t                    _index;
              std::string               _selected;
+             uint64_t                  _pass;
+             uint32_t                  _passDepth;
     private:
                           SearchPath   ( const SearchPath& );
              bool         _canOpen     ( const Element&     directory
@@ -91,6 +118,11 @@ namespace CRL {
   inline size_t             SearchPath::getIndex     () const { return _index; }
   inline bool               SearchPath::hasSelected  () const { return _index != npos; }
   inline std::string        SearchPath::_getTypeName () const { return _TName("SearchPath"); }
+  inline void               SearchPath::beginPass    () { if (not _passDepth++) ++_pass; }
+  inline void               SearchPath::endPass      () { if (_passDepth) --_passDepth; }
+
+  inline SearchPath::Pass::Pass  ( SearchPath& searchPath ) : _searchPath(searchPath) { _searchPath.beginPass(); }
+  inline SearchPath::Pass::~Pass () { _searchPath.endPass(); }
 
   inline size_t  SearchPath::append ( const std::string& path, const std::string& name ) {
     _paths.push_back ( Element ( path, name.empty()?extractLibName(path):name ) );
@@ -98,13 +130,19 @@ namespace CRL {
   }
 
   inline SearchPath::Element::Element ( const std::string& path, const std::string& name )
-    : _path(path)
-    , _name(name.empty()?SearchPath::extractLibName(path):name)
+    : _path  (path)
+    , _name  (name.empty()?SearchPath::extractLibName(path):name)
+    , _files   ()
+    , _mtime   (0)
+    , _listed  (false)
+    , _exists  (false)
+    , _statPass(0)
   { }
 
   inline bool               SearchPath::Element::empty        () const { return _path.empty() and _name.empty(); }
   inline const std::string& SearchPath::Element::getPath      () const { return _path; }
   inline const std::string& SearchPath::Element::getName      () const { return _name; }
+  inline void               SearchPath::Element::invalidate   () const { _listed = false; _statPass = 0; }
   inline std::string        SearchPath::Element::_getTypeName () const { return "SearchPath::Element"; }
 
 
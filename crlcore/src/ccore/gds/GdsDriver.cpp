@@ -19,12 +19,17 @@
 #include <cstdio>
 #include <cfenv>
 #include <string>
+#include <string_view>
 #include <sstream>
 #include <fstream>
 #include <algorithm>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <zlib.h>
 using namespace std;
 
 #include "hurricane/configuration/Configuration.h"
@@ -44,6 +49,7 @@ using namespace std;
 #include "hurricane/Plug.h"
 #include "hurricane/Instance.h"
 #include "hurricane/Library.h"
+#include "hurricane/UpdateSession.h"
 using namespace Hurricane;
 
 #include "crlcore/Utilities.h"
@@ -73,6 +79,11 @@ namespace {
   } 
 
 
+// Error & Warning format into a static buffer, the reports issued by
+// the serializing threads must be done one at a time.
+  mutex  reportMutex;
+
+
   bool  isOnGrid ( Instance* instance )
   {
     bool      error   = false;
@@ -80,6 +91,7 @@ namespace {
     Point     position = instance->getTransformation().getTranslation();
     if (position.getX() % oneGrid) {
       error = true;
+      lock_guard<mutex> lock ( reportMutex );
       cerr << Error( "isOnGrid(): On %s of %s,\n"
                      "        Tx %s is not on grid (%s)"
                    , getString(instance).c_str()
@@ -90,6 +102,7 @@ namespace {
     }
     if (position.getY() % oneGrid) {
       error = true;
+      lock_guard<mutex> lock ( reportMutex );
       cerr << Error( "isOnGrid(): On %s of %s,\n"
                      "        Ty %s is not on grid (%s)"
                    , getString(instance).c_str()
@@ -107,6 +120,7 @@ namespace {
     bool error = false;
     if (bb.getXMin() % DbU::oneGrid) {
       error = true;
+      lock_guard<mutex> lock ( reportMutex );
       cerr << Error( "isOnGrid(): On %s of %s,\n"
                      "        X-Min %s is not on grid (%s)"
                    , getString(component).c_str()
@@ -117,6 +131,7 @@ namespace {
     }
     if (bb.getXMax() % DbU::oneGrid) {
       error = true;
+      lock_guard<mutex> lock ( reportMutex );
       cerr << Error( "isOnGrid(): On %s of %s,\n"
                      "        X-Max %s is not on grid (%s)"
                    , getString(component).c_str()
@@ -127,6 +142,7 @@ namespace {
     }
     if (bb.getYMin() % DbU::oneGrid) {
       error = true;
+      lock_guard<mutex> lock ( reportMutex );
       cerr << Error( "isOnGrid(): On %s of %s,\n"
                      "        Y-Min %s is not on grid (%s)"
                    , getString(component).c_str()
@@ -137,6 +153,7 @@ namespace {
     }
     if (bb.getYMax() % DbU::oneGrid) {
       error = true;
+      lock_guard<mutex> lock ( reportMutex );
       cerr << Error( "isOnGrid(): On %s of %s,\n"
                      "        Y-Max %s is not on grid (%s)"
                    , getString(component).c_str()
@@ -171,6 +188,7 @@ namespace {
     for ( size_t i=0 ; i<points.size() ; ++i ) {
       if (points[i].getX() % oneGrid) {
         error = true;
+        lock_guard<mutex> lock ( reportMutex );
         cerr << Error( "isOnGrid(): On %s of %s,\n"
                        "        Point [%d] X %s is not on grid (%s)"
                      , getString(component).c_str()
@@ -182,6 +200,7 @@ namespace {
       }
       if (points[i].getY() % oneGrid) {
         error = true;
+        lock_guard<mutex> lock ( reportMutex );
         cerr << Error( "isOnGrid(): On %s of %s,\n"
                        "        Point [%d] Y %s is not on grid (%s)"
                      , getString(component).c_str()
@@ -333,7 +352,7 @@ namespace {
                        GdsRecord  ( uint16_t type, int32_t );
                        GdsRecord  ( uint16_t type, string );
       inline uint16_t  getType    () const;
-             void      toStream   ( ostream& ) const;
+             void      toStream   ( vector<char>& ) const;
              void      push       ( uint16_t );
              void      push       ( int16_t );
              void      push       ( int32_t );
@@ -445,34 +464,88 @@ namespace {
   }
 
 
-  void  GdsRecord::toStream ( ostream& stream ) const
+  void  GdsRecord::toStream ( vector<char>& bytes ) const
   {
-    // static size_t count = 0;
-    
     uint16_t length = (uint16_t)( _bytes.size()+2 );
-    const unsigned char* bytearray = reinterpret_cast<const unsigned char*>( &length );
-
-    // char buffer[512];
-    // sprintf( buffer, "0x%02x", bytearray[1] );
-    // cerr << setw(6) << hex << count++ << " | " << buffer << endl; 
-    // sprintf( buffer, "0x%02x", bytearray[0] );
-    // cerr << setw(6) << hex << count++ << " | " << buffer << endl; 
-
-  // Little endian (x86).
-    stream.put( bytearray[1] );
-    stream.put( bytearray[0] );
-
-    for ( unsigned char byte : _bytes ) {
-      // uint32_t b = byte;
-      // sprintf( buffer, "0x%02x", b );
-      // cerr << setw(6) << hex << count++ << " | " << buffer << endl; 
-      stream.put( byte );
+    bytes.push_back( (char)(length >> 8  ) );
+    bytes.push_back( (char)(length & 0xff) );
+    bytes.insert( bytes.end(), _bytes.begin(), _bytes.end() );
+  }
+
+
+// -------------------------------------------------------------------
+// Class  :  "::GdsWriter".
+//
+// Output file of the GDSII stream, plain (stdio with a large buffer)
+// or gzip compressed. Only whole buffers are written to it.
+
+  class GdsWriter {
+    public:
+      static const size_t  BufferSize = 4 << 20;
+    public:
+                   GdsWriter ( const string& path, bool gzip );
+                  ~GdsWriter ();
+      inline bool  isOpen    () const;
+             void  write     ( const vector<char>& );
+             bool  close     ();
+    private:
+                   GdsWriter ( const GdsWriter& ) = delete;
+      GdsWriter&   operator= ( const GdsWriter& ) = delete;
+    private:
+      string  _path;
+      FILE*   _file;
+      gzFile  _gzfile;
+      bool    _error;
+  };
+
+
+  inline bool  GdsWriter::isOpen () const { return _file or _gzfile; }
+
+
+  GdsWriter::GdsWriter ( const string& path, bool gzip )
+    : _path  (path)
+    , _file  (NULL)
+    , _gzfile(NULL)
+    , _error (false)
+  {
+    if (gzip) {
+      _gzfile = gzopen( path.c_str(), "wb6" );
+      if (_gzfile) gzbuffer( _gzfile, BufferSize );
+    } else {
+      _file = fopen( path.c_str(), "wb" );
+      if (_file) setvbuf( _file, NULL, _IOFBF, BufferSize );
     }
   }
 
 
-  ostream& operator<< ( ostream& o, const GdsRecord& r ) { r .toStream( o ); return o; }
-//ostream& operator<< ( ostream& o, const GdsRecord* r ) { r->toStream( o ); return o; }
+  GdsWriter::~GdsWriter ()
+  { close(); }
+
+
+  void  GdsWriter::write ( const vector<char>& bytes )
+  {
+    if (bytes.empty()) return;
+    if (_file) {
+      if (fwrite( bytes.data(), 1, bytes.size(), _file ) != bytes.size()) _error = true;
+    } else if (_gzfile) {
+      if (gzwrite( _gzfile, bytes.data(), bytes.size() ) != (int)bytes.size()) _error = true;
+    }
+  }
+
+
+  bool  GdsWriter::close ()
+  {
+    if (_file  ) { if (fclose(_file)   != 0   ) _error = true; _file   = NULL; }
+    if (_gzfile) { if (gzclose(_gzfile) != Z_OK) _error = true; _gzfile = NULL; }
+    if (_error) {
+      cerr << Error( "GdsWriter::close(): Error while writing GDSII stream (disk full?).\n"
+                     "        \"%s\""
+                   , _path.c_str() ) << endl;
+      _error = false;
+      return false;
+    }
+    return true;
+  }
 
 
 // -------------------------------------------------------------------
@@ -487,8 +560,19 @@ namespace {
       static const  GdsRecord  SREF;
       static const  GdsRecord  TEXT;
     public:
-                               GdsStream    ( string filename );
+      typedef unordered_map<const Cell*,string>  StructureNames;
+    public:
+                               GdsStream    ( GdsWriter*, const StructureNames* );
                               ~GdsStream    ();
+             inline bool       isFlushed    () const;
+             inline const vector<char>&
+                               getBytes     () const;
+             inline size_t     getBodyStart () const;
+             inline void       clear        ();
+             inline void       flush        ();
+             inline void       swap         ( vector<char>& );
+             inline string     getStructureName
+                                            ( const Cell* ) const;
              inline Point      putOnGrid    ( const Point& ) const;
              inline int32_t    toGdsDbu     ( DbU::Unit ) const;
       static inline GdsRecord  PROPATTR     ( int16_t );
@@ -512,10 +596,19 @@ namespace {
                     GdsStream& operator<<   ( const Cell* );
                     GdsStream& operator<<   ( const Transformation& );
     private:
-      ofstream   _ostream;
-      double     _dbuPerUu;
-      double     _metricDbU;
-      DbU::Unit  _oneGrid;
+             inline size_t     _beginXY     ();
+             inline void       _put         ( DbU::Unit x, DbU::Unit y );
+             inline void       _endXY       ( size_t start );
+             inline void       _autoFlush   ();
+    private:
+      GdsWriter*             _writer;
+      const StructureNames*  _names;
+      vector<char>           _bytes;
+      size_t                 _bodyStart;
+      bool                   _flushed;
+      double                 _dbuPerUu;
+      double                 _metricDbU;
+      DbU::Unit              _oneGrid;
   };
 
   
@@ -540,9 +633,45 @@ namespace {
   inline GdsRecord  GdsStream::STRING       ( const Name& n )  { return GdsRecord(GdsRecord::STRING,getString(n)); }
   inline GdsRecord  GdsStream::STRING       ( const string s ) { return GdsRecord(GdsRecord::STRING,s); }
 
+  inline bool                 GdsStream::isFlushed    () const { return _flushed; }
+  inline const vector<char>&  GdsStream::getBytes     () const { return _bytes; }
+  inline size_t               GdsStream::getBodyStart () const { return _bodyStart; }
+  inline void                 GdsStream::clear        () { _bytes.clear(); _bodyStart = 0; _flushed = false; }
+  inline void                 GdsStream::swap         ( vector<char>& bytes ) { _bytes.swap( bytes ); _bodyStart = 0; _flushed = false; }
+
+
+  inline void  GdsStream::flush ()
+  {
+    if (not _writer) return;
+    _writer->write( _bytes );
+    _bytes.clear();
+  }
+
+
+// A structure too big to be deduplicated is streamed out as it is
+// built (only on the stream directly bound to the file).
+  inline void  GdsStream::_autoFlush ()
+  {
+    if (_writer and (_bytes.size() > GdsWriter::BufferSize)) {
+      flush();
+      _flushed = true;
+    }
+  }
+
+
+  inline string  GdsStream::getStructureName ( const Cell* cell ) const
+  {
+    if (_names) {
+      auto iname = _names->find( cell );
+      if (iname != _names->end()) return (*iname).second;
+    }
+    return getString( cell->getName() );
+  }
+
   inline int32_t    GdsStream::toGdsDbu     ( DbU::Unit v )   const
   {
     if (v % _oneGrid) {
+      lock_guard<mutex> lock ( reportMutex );
       cerr << getString( Error( "Offgrid value %s (DbU=%d), grid %s (DbU=%d)."
                               , DbU::getValueString(v).c_str(), v
                               , DbU::getValueString(_oneGrid).c_str(), _oneGrid ))
@@ -559,21 +688,29 @@ namespace {
   }
 
 
-  GdsStream::GdsStream ( string filename )
-    : _ostream  ()
+// Only the stream bound to a GdsWriter frames the library (HEADER to
+// UNITS and ENDLIB), the unbound ones just serialize STRUCTUREs.
+
+  GdsStream::GdsStream ( GdsWriter* writer, const StructureNames* names )
+    : _writer   (writer)
+    , _names    (names)
+    , _bytes    ()
+    , _bodyStart(0)
+    , _flushed  (false)
     , _dbuPerUu (Cfg::getParamDouble("gdsDriver.dbuPerUu" ,0.001)->asDouble())  // 1000
     , _metricDbU(Cfg::getParamDouble("gdsDriver.metricDbu",10e-9)->asDouble())  // 1um.
     , _oneGrid  (DbU::grid(1.0))
   {
     std::fesetround( FE_TONEAREST );
-    _ostream.open( filename, ios_base::out|ios_base::binary );
+    if (not _writer) return;
 
     GdsRecord record ( GdsRecord::HEADER );
     record.push( (uint16_t)600 );
-    _ostream << record;
+    (*this) << record;
 
     time_t t   = time( 0 );
-    tm*    now = localtime( &t );
+    tm     date;
+    tm*    now = localtime_r( &t, &date );
 
     record = GdsRecord( GdsRecord::BGNLIB );
   // Last modification time.
@@ -588,9 +725,9 @@ namespace {
     record.push( (uint16_t)now->tm_mday  );
     record.push( (uint16_t)now->tm_hour  );
     record.push( (uint16_t)now->tm_sec   );
-    _ostream << record;
+    (*this) << record;
 
-    _ostream << LIBNAME( "LIB" );
+    (*this) << LIBNAME( "LIB" );
 
   // Generate a GDSII which coordinates are relatives to the um.
   // Bug correction courtesy of M. Koefferlein (KLayout).
@@ -601,19 +738,52 @@ namespace {
     record.push( _metricDbU );
   //record.push( gridPerUu );
   //record.push( DbU::getPhysicalsPerGrid() );
-    _ostream << record;
+    (*this) << record;
+    flush();
   }
 
   
   GdsStream::~GdsStream ()
   {
-    _ostream << ENDLIB;
-    _ostream.close();
+    if (not _writer) return;
+    (*this) << ENDLIB;
+    flush();
   }
 
 
   GdsStream& GdsStream::operator<< ( const GdsRecord& record )
-  { _ostream << record; return *this; }
+  { record.toStream( _bytes ); return *this; }
+
+
+// XY records are directly written in the buffer, the length is set
+// once all the points are in.
+  inline size_t  GdsStream::_beginXY ()
+  {
+    size_t start = _bytes.size();
+    _bytes.push_back( 0 );
+    _bytes.push_back( 0 );
+    _bytes.push_back( (char)(GdsRecord::XY >> 8  ) );
+    _bytes.push_back( (char)(GdsRecord::XY & 0xff) );
+    return start;
+  }
+
+
+  inline void  GdsStream::_put ( DbU::Unit x, DbU::Unit y )
+  {
+    uint32_t gx = (uint32_t)toGdsDbu( x );
+    uint32_t gy = (uint32_t)toGdsDbu( y );
+    char bytes[8] = { (char)(gx >> 24), (char)(gx >> 16), (char)(gx >> 8), (char)gx
+                    , (char)(gy >> 24), (char)(gy >> 16), (char)(gy >> 8), (char)gy };
+    _bytes.insert( _bytes.end(), bytes, bytes+8 );
+  }
+
+
+  inline void  GdsStream::_endXY ( size_t start )
+  {
+    uint16_t length = (uint16_t)( _bytes.size() - start );
+    _bytes[start  ] = (char)(length >> 8  );
+    _bytes[start+1] = (char)(length & 0xff);
+  }
 
 
 #if 0
@@ -674,38 +844,30 @@ namespace {
     }
 
     record.push( flags );
-    _ostream << record;
+    (*this) << record;
 
     if (angle != 0.0) {
       record = GdsRecord( GdsRecord::ANGLE );
       record.push( angle );
-      _ostream << record;
+      (*this) << record;
     }
 
-    record = GdsRecord( GdsRecord::XY );
-    record.push( (int32_t)toGdsDbu(transf.getTx()) );
-    record.push( (int32_t)toGdsDbu(transf.getTy()) );
-
-    _ostream << record;
+    size_t start = _beginXY();
+    _put( transf.getTx(), transf.getTy() );
+    _endXY( start );
     return *this;
   }
 
 
   GdsStream& GdsStream::operator<< ( const Box& box )
   {
-    GdsRecord record ( GdsRecord::XY );
-    for ( size_t i=0 ; i<5 ; ++i ) {
-      Point p;
-      switch ( i%4 ) {
-        case 0: p = Point( box.getXMin(), box.getYMin() ); break;
-        case 1: p = Point( box.getXMin(), box.getYMax() ); break;
-        case 2: p = Point( box.getXMax(), box.getYMax() ); break;
-        case 3: p = Point( box.getXMax(), box.getYMin() ); break;
-      }
-      record.push( (int32_t)toGdsDbu(p.getX()) );
-      record.push( (int32_t)toGdsDbu(p.getY()) );
-    }
-    _ostream << record;
+    size_t start = _beginXY();
+    _put( box.getXMin(), box.getYMin() );
+    _put( box.getXMin(), box.getYMax() );
+    _put( box.getXMax(), box.getYMax() );
+    _put( box.getXMax(), box.getYMin() );
+    _put( box.getXMin(), box.getYMin() );
+    _endXY( start );
     return *this;
   }
 
@@ -713,25 +875,20 @@ namespace {
   GdsStream& GdsStream::operator<< ( Points points )
   {
   //cerr << "GdsStream::operator<<(Points&) " << points.getSize() << endl;
-    GdsRecord record ( GdsRecord::XY );
-    Point first = points.getFirst();
-    for ( Point p : points ) {
-      record.push( (int32_t)toGdsDbu(p.getX()) );
-      record.push( (int32_t)toGdsDbu(p.getY()) );
-    }
-    record.push( (int32_t)toGdsDbu(first.getX()) );
-    record.push( (int32_t)toGdsDbu(first.getY()) );
-    _ostream << record;
+    size_t start = _beginXY();
+    Point  first = points.getFirst();
+    for ( Point p : points ) _put( p.getX(), p.getY() );
+    _put( first.getX(), first.getY() );
+    _endXY( start );
     return *this;
   }
 
 
   GdsStream& GdsStream::operator<< ( const Point& point )
   {
-    GdsRecord record ( GdsRecord::XY );
-    record.push( (int32_t)toGdsDbu(point.getX()) );
-    record.push( (int32_t)toGdsDbu(point.getY()) );
-    _ostream << record;
+    size_t start = _beginXY();
+    _put( point.getX(), point.getY() );
+    _endXY( start );
     return *this;
   }
 
@@ -739,14 +896,10 @@ namespace {
   GdsStream& GdsStream::operator<< ( const vector<Point>& points )
   {
   //cerr << "GdsStream::operator<<(vector<Points>&) " << points.size() << endl;
-    GdsRecord record ( GdsRecord::XY );
-    for ( Point p : points ) {
-      record.push( (int32_t)toGdsDbu(p.getX()) );
-      record.push( (int32_t)toGdsDbu(p.getY()) );
-    }
-    record.push( (int32_t)toGdsDbu(points[0].getX()) );
-    record.push( (int32_t)toGdsDbu(points[0].getY()) );
-    _ostream << record;
+    size_t start = _beginXY();
+    for ( Point p : points ) _put( p.getX(), p.getY() );
+    _put( points[0].getX(), points[0].getY() );
+    _endXY( start );
     return *this;
   }
 
@@ -756,13 +909,13 @@ namespace {
   // Temporay patch for "amsOTA".
     if (cell->getName() == "control_r") return *this;
     if (not hasLayout(cell)) return *this;
-
-    cdebug_log(101,1) << "GdsStream::operator<<(Cell*): " << getString(cell) << endl;
+  // No cdebug trace here, it may run concurrently in _writeLevel().
 
     Technology* tech = DataBase::getDB()->getTechnology();
     
     time_t t   = time( 0 );
-    tm*    now = localtime( &t );
+    tm     date;
+    tm*    now = localtime_r( &t, &date );
 
     GdsRecord record ( GdsRecord::BGNSTR );
   // Last modification time.
@@ -777,9 +930,10 @@ namespace {
     record.push( (uint16_t)now->tm_mday);
     record.push( (uint16_t)now->tm_hour);
     record.push( (uint16_t)now->tm_sec );
-    _ostream << record;
+    (*this) << record;
 
-    _ostream << STRNAME(cell->getName());
+    (*this) << STRNAME(getStructureName(cell));
+    _bodyStart = _bytes.size();
 
     for ( Instance* instance : cell->getInstances() ) {
       if (instance->getMasterCell()->getName() == "control_r") continue;
@@ -788,16 +942,15 @@ namespace {
       if (instance->getPlacementStatus() == Instance::PlacementStatus::UNPLACED) continue;
 
       (*this) << SREF;
-      (*this) << SNAME( instance->getMasterCell()->getName() );
+      (*this) << SNAME( getStructureName(instance->getMasterCell()) );
       (*this) << instance->getTransformation();
       (*this) << ENDEL;
       isOnGrid( instance );
+      _autoFlush();
     }
 
     for ( Net* net : cell->getNets() ) {
-      cdebug_log(101,1) << "Writing net " << net << endl;
       for ( Component* component : net->getComponents() ) {
-        cdebug_log(101,0) << "Writing " << component << endl;
         Polygon* polygon  = dynamic_cast<Polygon*>(component);
         if (polygon) {
           if (polygon->isPolygon45()) {
@@ -881,6 +1034,7 @@ namespace {
                 if (NetExternalComponents::isExternal(component) or dynamic_cast<Pin*>(component)) {
                   string name = getString( component->getNet()->getName() );
                   if (name.size() > 511) {
+                    lock_guard<mutex> lock ( reportMutex );
                     cerr << getString(
                               Warning( "GdsStream::operator<<(): Truncate Net name to 511 first characters,\n"
                                        "           on \"%s\"."
@@ -896,33 +1050,234 @@ namespace {
                       break;
                     }
                   }
-                  cdebug_log(101,0) << "TEXT" << endl;
                   (*this) << TEXT;
                   (*this) << LAYER(textLayer->getGds2Layer());
-                  cdebug_log(101,0) << "TEXTTYPE" << endl;
                   (*this) << TEXTTYPE(textLayer->getGds2Datatype());
-                  cdebug_log(101,0) << "TEXTYPE end record" << endl;
                   (*this) << PRESENTATION( 5 );
                   (*this) << putOnGrid( bb.getCenter() );
                   (*this) << STRING( name );
                   (*this) << ENDEL;
-                  cdebug_log(101,0) << "TEXT ENDEL" << endl;
                 }
               }
             }
           }
         }
+        _autoFlush();
       }
-      cdebug_tabw(101,-1);
     }
 
     (*this) << ENDSTR;
-    cdebug_tabw(101,-1);
 
     return *this;
   }
 
 
+// -------------------------------------------------------------------
+// Class  :  "::GdsLibraryWriter".
+//
+// Writes the STRUCTUREs of a hierarchy bottom up, one depth level at
+// a time. With more than one thread, the Cells of a level are
+// serialized concurrently in separate buffers (the DataBase being
+// frozen), then written back in DepthOrder. Single Cell levels are
+// serialized on the stream bound to the file, so a huge top Cell is
+// streamed out instead of being held in memory.
+//
+// Deduplication: a Cell whose serialized body (all but the BGNSTR
+// timestamps and the STRNAME) is identical to an already written one
+// is not emitted, the SREFs to it are renamed to the written one.
+// As the levels are processed bottom up, identical sub-hierarchies
+// collapse as well. Only the small structures (via stacks, generated
+// cells) are candidates, as their bodies are kept for comparison.
+// Structures without any BOUNDARY or SREF (empty, or labels only) are
+// never merged, distinct placeholders must keep their own names. It
+// is only done when requested through Gds::Deduplicate.
+
+  class GdsLibraryWriter {
+    public:
+      static const size_t  DedupMaxSize = 1 << 16;
+    public:
+                    GdsLibraryWriter   ( GdsWriter*, bool deduplicate, unsigned int threads );
+             void   write              ( const Cell* top );
+      inline size_t getStructuresSize  () const;
+      inline size_t getDuplicatesSize  () const;
+    private:
+             void   _writeLevel        ( GdsStream&, const vector<const Cell*>& );
+             void   _writeStructure    ( GdsStream&, const Cell*, vector<char>&, size_t bodyStart );
+             bool   _isDuplicate       ( const Cell*, const vector<char>&, size_t bodyStart );
+      static bool   _hasGeometry       ( const vector<char>&, size_t bodyStart );
+    private:
+      struct Body {
+          const Cell*   _cell;
+          vector<char>  _bytes;
+      };
+    private:
+      GdsWriter*                        _writer;
+      bool                              _deduplicate;
+      unsigned int                      _threads;
+      GdsStream::StructureNames         _names;
+      unordered_map< size_t, vector<Body> >  _bodies;
+      size_t                            _structures;
+      size_t                            _duplicates;
+  };
+
+
+  inline size_t  GdsLibraryWriter::getStructuresSize () const { return _structures; }
+  inline size_t  GdsLibraryWriter::getDuplicatesSize () const { return _duplicates; }
+
+
+  GdsLibraryWriter::GdsLibraryWriter ( GdsWriter* writer, bool deduplicate, unsigned int threads )
+    : _writer     (writer)
+    , _deduplicate(deduplicate)
+    , _threads    ((threads) ? threads : 1)
+    , _names      ()
+    , _bodies     ()
+    , _structures (0)
+    , _duplicates (0)
+  { }
+
+
+// Keeps the DataBase frozen for the lifetime of the object, so it is
+// released even if the serialization throws.
+
+  class FreezeGuard {
+    public:
+      inline                FreezeGuard ( bool freeze );
+      inline               ~FreezeGuard ();
+    private:
+                            FreezeGuard ( const FreezeGuard& ) = delete;
+             FreezeGuard&   operator=   ( const FreezeGuard& ) = delete;
+    private:
+      bool  _frozen;
+  };
+
+
+  inline FreezeGuard::FreezeGuard ( bool freeze )
+    : _frozen(freeze)
+  { if (_frozen) DataBase::getDB()->freeze(); }
+
+
+  inline FreezeGuard::~FreezeGuard ()
+  { if (_frozen) DataBase::getDB()->unfreeze(); }
+
+
+  void  GdsLibraryWriter::write ( const Cell* top )
+  {
+  // Concurrent readers require a frozen DataBase, which cannot be done
+  // inside an UpdateSession.
+    if ((_threads > 1) and not DataBase::isFrozen() and UpdateSession::getStackSize())
+      _threads = 1;
+    FreezeGuard guard ( (_threads > 1) and not DataBase::isFrozen() );
+
+    GdsStream stream ( _writer, &_names );
+    DepthOrder cellOrder ( top );
+    vector<const Cell*> level;
+    size_t              depth = 0;
+    for ( auto element : cellOrder.getCellDepths() ) {
+      if ((element.second != depth) and not level.empty()) {
+        _writeLevel( stream, level );
+        level.clear();
+      }
+      depth = element.second;
+      level.push_back( element.first );
+    }
+    _writeLevel( stream, level );
+  }
+
+
+  void  GdsLibraryWriter::_writeLevel ( GdsStream& stream, const vector<const Cell*>& cells )
+  {
+    if ((_threads == 1) or (cells.size() < 2)) {
+      for ( const Cell* cell : cells ) {
+        stream.clear();
+        stream << cell;
+        if (stream.isFlushed()) {
+          stream.flush();
+          ++_structures;
+          continue;
+        }
+        vector<char> bytes;
+        size_t       bodyStart = stream.getBodyStart();
+        stream.swap( bytes );
+        _writeStructure( stream, cell, bytes, bodyStart );
+      }
+      return;
+    }
+
+    vector< vector<char> > buffers    ( cells.size() );
+    vector<size_t>         bodyStarts ( cells.size(), 0 );
+    atomic<size_t>         next       ( 0 );
+    auto serializer = [&]() {
+      GdsStream local ( NULL, &_names );
+      for ( size_t i=next++ ; i<cells.size() ; i=next++ ) {
+        local << cells[i];
+        bodyStarts[i] = local.getBodyStart();
+        local.swap( buffers[i] );
+      }
+    };
+
+    vector<std::thread> workers;
+    for ( size_t i=1 ; i<std::min( (size_t)_threads, cells.size() ) ; ++i )
+      workers.push_back( std::thread( serializer ));
+    serializer();
+    for ( std::thread& worker : workers ) worker.join();
+
+    for ( size_t i=0 ; i<cells.size() ; ++i ) {
+      _writeStructure( stream, cells[i], buffers[i], bodyStarts[i] );
+      vector<char>().swap( buffers[i] );
+    }
+  }
+
+
+  void  GdsLibraryWriter::_writeStructure ( GdsStream&    stream
+                                          , const Cell*   cell
+                                          , vector<char>& bytes
+                                          , size_t        bodyStart )
+  {
+    if (bytes.empty()) return;
+    if (    _deduplicate
+       and (bytes.size() - bodyStart <= DedupMaxSize)
+       and _hasGeometry(bytes,bodyStart)
+       and _isDuplicate(cell,bytes,bodyStart)) {
+      ++_duplicates;
+      return;
+    }
+    stream.swap( bytes );
+    stream.flush();
+    ++_structures;
+  }
+
+
+  bool  GdsLibraryWriter::_hasGeometry ( const vector<char>& bytes, size_t bodyStart )
+  {
+    for ( size_t i=bodyStart ; i+4 <= bytes.size() ; ) {
+      size_t   length = ((uint8_t)bytes[i  ] << 8) + (uint8_t)bytes[i+1];
+      uint16_t type   = ((uint8_t)bytes[i+2] << 8) + (uint8_t)bytes[i+3];
+      if ((type == GdsRecord::BOUNDARY) or (type == GdsRecord::SREF)) return true;
+      if (length < 4) break;
+      i += length;
+    }
+    return false;
+  }
+
+
+  bool  GdsLibraryWriter::_isDuplicate ( const Cell* cell, const vector<char>& bytes, size_t bodyStart )
+  {
+    size_t key = std::hash<string_view>()( string_view( bytes.data()+bodyStart, bytes.size()-bodyStart ));
+    vector<Body>& bodies = _bodies[ key ];
+    for ( const Body& body : bodies ) {
+      if (    (body._bytes.size() == bytes.size()-bodyStart)
+         and std::equal( body._bytes.begin(), body._bytes.end(), bytes.begin()+bodyStart )) {
+        cdebug_log(101,0) << "GdsLibraryWriter::_isDuplicate(): " << cell
+                          << " is identical to " << body._cell << endl;
+        _names[ cell ] = _names.count(body._cell) ? _names[body._cell] : getString( body._cell->getName() );
+        return true;
+      }
+    }
+    bodies.push_back( Body { cell, vector<char>( bytes.begin()+bodyStart, bytes.end() ) } );
+    return false;
+  }
+
+
 }  // Anonymous namespace.
 
 
@@ -932,18 +1287,30 @@ namespace CRL {
 // -------------------------------------------------------------------
 // Class  :  "CRL::Gds".
 
-  bool  Gds::save ( Cell* cell )
+  bool  Gds::save ( Cell* cell, uint32_t flags )
   {
-    string cellFile = getString(cell->getName()) + ".gds";
-
-    GdsStream gstream ( cellFile );
+    string cellFile = getString(cell->getName()) + ((flags & GzipOutput) ? ".gds.gz" : ".gds");
+
+    GdsWriter writer ( cellFile, (flags & GzipOutput) );
+    if (not writer.isOpen()) {
+      cerr << Error( "Gds::save(): Unable to open output file, check path & permissions.\n"
+                     "        \"%s\""
+                   , cellFile.c_str() ) << endl;
+      return false;
+    }
 
-    DepthOrder cellOrder ( cell );
-    for ( auto element : cellOrder.getCellDepths() ) {
-      gstream << element.first;
+    {
+      GdsLibraryWriter library ( &writer
+                               , (flags & Deduplicate)
+                               , std::max( 1, Cfg::getParamInt("gds.threads",1)->asInt() ));
+      library.write( cell );
+      if (flags & Deduplicate)
+        cmess2 << "     - GDS deduplication: " << library.getDuplicatesSize()
+               << " duplicate(s) of " << (library.getStructuresSize()+library.getDuplicatesSize())
+               << " structures." << endl;
     }
 
-    return true;
+    return writer.close();
   }
 
 
@@ -16,6 +16,7 @@
 
 #include <ctime>
 #include <cstdio>
+#include <cstring>
 #include <string>
 #include <bitset>
 #include <sstream>
@@ -24,6 +25,14 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
+#include <atomic>
+#include <thread>
+#include <type_traits>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <zlib.h>
 using namespace std;
 
 #include "hurricane/configuration/Configuration.h"
@@ -58,6 +67,132 @@ using namespace CRL;
 namespace {
 
 
+// GDSII is big endian, decode from raw bytes (compilers turn it into
+// a single load and byte swap).
+  template< typename IntType >
+  inline IntType  fromBigEndian ( const uint8_t* bytes )
+  {
+    typedef typename std::make_unsigned<IntType>::type  UIntType;
+    UIntType value = 0;
+    for ( size_t i=0 ; i<sizeof(IntType) ; ++i ) value = (UIntType)((value << 8) | bytes[i]);
+    return (IntType)value;
+  }
+
+
+// -------------------------------------------------------------------
+// Class  :  "::GdsBuffer".
+//
+// The whole GDSII stream in memory. A plain file is mapped read-only,
+// a gzip compressed one (detected by it's magic number, whatever the
+// extension) is inflated into an owned buffer.
+
+  class GdsBuffer {
+    public:
+                            GdsBuffer ();
+                           ~GdsBuffer ();
+             bool           open      ( const string& path );
+             void           close     ();
+      inline bool           isOpen    () const;
+      inline bool           isGzip    () const;
+      inline const uint8_t* getData   () const;
+      inline size_t         getSize   () const;
+    private:
+                            GdsBuffer ( const GdsBuffer& ) = delete;
+             GdsBuffer&     operator= ( const GdsBuffer& ) = delete;
+             bool           _inflate  ( const string& path );
+    private:
+      const uint8_t*   _data;
+      size_t           _size;
+      bool             _mapped;
+      vector<uint8_t>  _inflated;
+  };
+
+
+  inline bool            GdsBuffer::isOpen  () const { return (_data != NULL); }
+  inline bool            GdsBuffer::isGzip  () const { return isOpen() and not _mapped; }
+  inline const uint8_t*  GdsBuffer::getData () const { return _data; }
+  inline size_t          GdsBuffer::getSize () const { return _size; }
+
+
+  GdsBuffer::GdsBuffer ()
+    : _data    (NULL)
+    , _size    (0)
+    , _mapped  (false)
+    , _inflated()
+  { }
+
+
+  GdsBuffer::~GdsBuffer ()
+  { close(); }
+
+
+  void  GdsBuffer::close ()
+  {
+    if (_mapped) munmap( (void*)_data, _size );
+    vector<uint8_t>().swap( _inflated );
+    _data   = NULL;
+    _size   = 0;
+    _mapped = false;
+  }
+
+
+  bool  GdsBuffer::open ( const string& path )
+  {
+    close();
+
+    int fd = ::open( path.c_str(), O_RDONLY );
+    if (fd < 0) return false;
+
+    struct stat status;
+    if ((fstat(fd,&status) < 0) or (status.st_size < 2)) { ::close( fd ); return false; }
+
+    uint8_t magic[2];
+    if (::read(fd,magic,2) != 2) { ::close( fd ); return false; }
+    if ((magic[0] == 0x1f) and (magic[1] == 0x8b)) {
+      ::close( fd );
+      return _inflate( path );
+    }
+
+    void* data = mmap( NULL, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    ::close( fd );
+    if (data == MAP_FAILED) return false;
+    madvise( data, status.st_size, MADV_SEQUENTIAL );
+
+    _data   = (const uint8_t*)data;
+    _size   = status.st_size;
+    _mapped = true;
+    return true;
+  }
+
+
+  bool  GdsBuffer::_inflate ( const string& path )
+  {
+    gzFile gzfile = gzopen( path.c_str(), "rb" );
+    if (not gzfile) return false;
+    gzbuffer( gzfile, 1 << 20 );
+
+    const size_t chunk = 1 << 22;
+    size_t       size  = 0;
+    while ( true ) {
+      _inflated.resize( size + chunk );
+      int bytes = gzread( gzfile, _inflated.data()+size, chunk );
+      if (bytes <= 0) {
+        if (bytes < 0) size = 0;
+        break;
+      }
+      size += bytes;
+    }
+    gzclose( gzfile );
+
+    _inflated.resize( size );
+    _inflated.shrink_to_fit();
+    if (_inflated.empty()) return false;
+    _data = _inflated.data();
+    _size = size;
+    return true;
+  }
+
+
 // -------------------------------------------------------------------
 // Class  :  "::GdsRecord".
 
@@ -130,6 +265,8 @@ namespace {
       static const uint16_t  LIBDIRSIZE      = 0x3900 | TwoByteInteger;
       static const uint16_t  SRFNAME         = 0x3a00 | String;
       static const uint16_t  LIBSECUR        = 0x3b00 | TwoByteInteger;
+    // Truncated or corrupted stream.
+      static const uint16_t  NoRecord        = 0xffff;
     public:
                                      GdsRecord      ();
       inline       bool              isHEADER       () const;   
@@ -193,13 +330,14 @@ namespace {
       inline       bool              hasXReflection () const;
       inline       uint16_t          getType        () const;
       inline       uint16_t          getLength      () const;
+      inline       size_t            getOffset      () const;
       inline const vector<uint16_t>& getMasks       () const;
       inline const vector<int16_t >& getInt16s      () const;
       inline const vector<int32_t >& getInt32s      () const;
       inline const vector<double  >& getDoubles     () const;
       inline       string            getName        () const;
                    void              clear          ();
-                   void              read           ( istream* );
+                   void              read           ( const GdsBuffer&, size_t& offset );
                    void              readDummy      ( bool showError );
                    void              readStrans     ();
                    void              readString     ();
@@ -215,13 +353,14 @@ namespace {
                    void              readXy         ();
       static       string            toStrType      ( uint16_t );
                    GdsRecord&        operator=      ( const GdsRecord& );
+                   void              swap           ( GdsRecord& );
     private:
       template< typename IntType> IntType  _readInt    ();
                                   string   _readString ();
                                   double   _readDouble ();
     private:
-      istream*          _stream;
-      uint32_t          _offset;
+      const uint8_t*    _data;
+      size_t            _offset;
       uint16_t          _length;
       uint16_t          _count;
       uint16_t          _type;
@@ -231,7 +370,6 @@ namespace {
       vector<int16_t>   _int16s;
       vector<int32_t>   _int32s;
       vector<double>    _doubles;
-      char              _buffer[64];
   };
 
 
@@ -296,6 +434,7 @@ namespace {
   inline       bool              GdsRecord::hasXReflection () const { return _xReflection; }   
   inline       uint16_t          GdsRecord::getType        () const { return _type; }
   inline       uint16_t          GdsRecord::getLength      () const { return _length; }
+  inline       size_t            GdsRecord::getOffset      () const { return _offset; }
   inline const vector<uint16_t>& GdsRecord::getMasks       () const { return _masks; }
   inline const vector<int16_t >& GdsRecord::getInt16s      () const { return _int16s; }
   inline const vector<int32_t >& GdsRecord::getInt32s      () const { return _int32s; }
@@ -304,7 +443,7 @@ namespace {
 
 
   GdsRecord::GdsRecord ()
-    : _stream     (NULL)
+    : _data       (NULL)
     , _offset     (0)
     , _length     (0)
     , _count      (0)
@@ -319,7 +458,7 @@ namespace {
 
 
   void  GdsRecord::clear ()
-  { _stream      = NULL;
+  { _data        = NULL;
     _length      = 0;
     _count       = 0;
     _type        = 0;
@@ -332,13 +471,26 @@ namespace {
   }
 
 
-  void  GdsRecord::read ( istream* stream )
+  void  GdsRecord::read ( const GdsBuffer& buffer, size_t& offset )
   {
     clear();
 
-    _stream = stream;
-    _length = _readInt<uint16_t>();
-    _type   = _readInt<uint16_t>();
+    _offset = offset;
+    if (offset + 4 <= buffer.getSize()) {
+      _data   = buffer.getData() + offset;
+      _length = fromBigEndian<uint16_t>( _data   );
+      _type   = fromBigEndian<uint16_t>( _data+2 );
+      _count  = 4;
+    }
+    if ((_length < 4) or (offset + _length > buffer.getSize())) {
+      _data   = NULL;
+      _length = 0;
+      _count  = 0;
+      _type   = NoRecord;
+      offset  = buffer.getSize();
+      return;
+    }
+    offset += _length;
 
     switch ( _type ) {
       case HEADER:       readDummy( false ); break;
@@ -401,13 +553,15 @@ namespace {
       case LIBSECUR:     readDummy( false ); break;
     }
 
-    ostringstream s;
-    s << " (0x" << std::setfill('0') << std::setw(4) << std::hex << _type << ")";
-    cdebug_log(101,0) << "GdsRecord::read() " << toStrType(_type)
-                      << s.str()
-                      << " _bytes:"  <<  _length
-                      << " (offset:" << (_offset-4) << ")"
-                      << endl;
+    if (cdebug.enabled(101)) {
+      ostringstream s;
+      s << " (0x" << std::setfill('0') << std::setw(4) << std::hex << _type << ")";
+      cdebug_log(101,0) << "GdsRecord::read() " << toStrType(_type)
+                        << s.str()
+                        << " _bytes:"  <<  _length
+                        << " (offset:" << _offset << ")"
+                        << endl;
+    }
   }
 
 
@@ -425,55 +579,41 @@ namespace {
   }
 
 
-  template< typename IntType>
-  IntType  GdsRecord::_readInt ()
+  void  GdsRecord::swap ( GdsRecord& other )
   {
-    const size_t typeSize = sizeof(IntType);
-    
-    union UType {
-        IntType       integer;
-        unsigned char bytes[ typeSize ];
-    };
-
-    unsigned char bytes[typeSize];
-    _stream->read( (char*)(&bytes[0]), typeSize );
-    _count  += typeSize;
-
-    // cdebug_log(101,0) << "GdsRecord::_readInt() " << endl;
-    // for ( size_t i=0 ; i<typeSize ; ++i ) {
-    //   sprintf( _buffer, "0x%02x", bytes[i] );
-    //   cdebug(101,0) << setw(6) << hex << _offset++ << " | " << _buffer << endl; 
-    // }
+    std::swap( _data       , other._data        );
+    std::swap( _offset     , other._offset      );
+    std::swap( _length     , other._length      );
+    std::swap( _count      , other._count       );
+    std::swap( _type       , other._type        );
+    std::swap( _xReflection, other._xReflection );
+    _name   .swap( other._name    );
+    _masks  .swap( other._masks   );
+    _int16s .swap( other._int16s  );
+    _int32s .swap( other._int32s  );
+    _doubles.swap( other._doubles );
+  }
 
-    UType uvalue;
-  // Little endian (x86).
-    for ( size_t i=0 ; i<typeSize ; ++i ) uvalue.bytes[i] = bytes[typeSize-i-1];
 
-    return uvalue.integer;
+// Reading past the record length (malformed record) returns zeros.
+  template< typename IntType>
+  inline IntType  GdsRecord::_readInt ()
+  {
+    if (_count + sizeof(IntType) > _length) return 0;
+    IntType value = fromBigEndian<IntType>( _data+_count );
+    _count += sizeof(IntType);
+    return value;
   }
 
 
   double  GdsRecord::_readDouble ()
   {
-    union gdsUInt64 {
-        uint64_t      uint64;
-        unsigned char bytes[8];
-    };
-
-    char bytes[8];
-    _stream->read( bytes, 8 );
+    if (_count + 8 > _length) return 0.0;
+    const uint8_t* bytes = _data + _count;
     _count += 8;
 
-    // cdebug_log(101,0) << "GdsRecord::_readDouble() " << endl;
-    // for ( size_t i=0 ; i<8 ; ++i ) {
-    //   sprintf( _buffer, "0x%02x", bytes[i] );
-    //   cdebug(101,0) << setw(6) << hex << _offset++ << " | " << _buffer << endl; 
-    // }
-
-    gdsUInt64 mantisse;
-    for ( size_t i=0 ; i<7 ; ++i ) mantisse.bytes[i] = bytes[7-i];
-    mantisse.bytes[7] = 0;
-    double value = mantisse.uint64;
+  // Excess-64 base 16 exponent, 56 bits mantissa.
+    double value = (double)( fromBigEndian<uint64_t>(bytes) & 0x00ffffffffffffffULL );
 
     if (bytes[0] & 0x80) value = -value;
 
@@ -486,16 +626,10 @@ namespace {
 
   string  GdsRecord::_readString ()
   {
-    cdebug_log(101,0) << "GdsRecord::_readDouble() " << endl;
-    string s;
-    char c;
-    for ( ; _count<_length ; ++_count ) {
-      _stream->get( c );
-      // sprintf( _buffer, "0x%02x", c );
-      // cdebug_log(101,0) << setw(6) << hex << _offset++ << " | " << _buffer << endl; 
-
-      if (c != (char)0) s.push_back(c);
-    }
+  // Strings are padded with NUL to an even length.
+    string s ( (const char*)_data+_count, _length-_count );
+    s.erase( std::remove( s.begin(), s.end(), (char)0 ), s.end() );
+    _count = _length;
     cdebug_log(101,0) << "GdsRecord::_readString(): \"" << s << "\"" << endl;
     return s;
   }
@@ -504,12 +638,14 @@ namespace {
   void  GdsRecord::readDummy ( bool showError )
   {
     cdebug_log(101,0) << "GdsRecord::readDummy() " << endl;
-    char c;
-    for ( ; _count<_length ; ++_count ) {
-      _stream->get( c );   
-      sprintf( _buffer, "0x%02x", c );
-      cdebug_log(101,0) << tsetw(6) << hex << _offset++ << " | " << _buffer << endl; 
+    if (cdebug.enabled(101)) {
+      char buffer[8];
+      for ( size_t i=_count ; i<_length ; ++i ) {
+        snprintf( buffer, 8, "0x%02x", _data[i] );
+        cdebug_log(101,0) << tsetw(6) << hex << (_offset+i) << " | " << buffer << endl; 
+      }
     }
+    _count = _length;
     if (showError) {
       cdebug_log(101,0) << Error( "GdsRecord type %s unsupported.", toStrType(_type).c_str() ) << endl;
     }
@@ -573,7 +709,13 @@ namespace {
 
 
   void  GdsRecord::readXy ()
-  { while ( _count < _length ) _int32s.push_back( _readInt<int32_t>() ); }
+  {
+    size_t         size  = (_length - _count) / 4;
+    const uint8_t* bytes = _data + _count;
+    _int32s.resize( size );
+    for ( size_t i=0 ; i<size ; ++i, bytes += 4 ) _int32s[i] = fromBigEndian<int32_t>( bytes );
+    _count += size * 4;
+  }
 
 
   string  GdsRecord::toStrType ( uint16_t type )
@@ -637,6 +779,7 @@ namespace {
       case LIBDIRSIZE:  return "LIBDIRSIZE";
       case SRFNAME:     return "SRFNAME";
       case LIBSECUR:    return "LIBSECUR";
+      case NoRecord:    return "NoRecord (truncated stream)";
     }
 
     ostringstream error;
@@ -645,8 +788,154 @@ namespace {
   }
 
 
-  istream& operator>> ( istream& stream, GdsRecord& record )
-  { record.read( &stream ); return stream; }
+// -------------------------------------------------------------------
+// Class  :  "::GdsRecordStream".
+//
+// Sequential source of records over a GdsBuffer. A first pass, on the
+// record headers only, indexes the STRUCTUREs (BGNSTR to ENDSTR). When
+// the reading reaches an indexed STRUCTURE, a window of the following
+// ones is decoded in parallel into GdsRecord vectors, which are then
+// handed out in order. The creation of the Hurricane objects, done by
+// the consumer of the records, stays sequential. The window is bounded
+// in bytes of stream to keep the decoded records memory footprint low.
+
+  class GdsRecordStream {
+    public:
+      static const size_t  WindowSize = 16 << 20;
+    public:
+                            GdsRecordStream ( unsigned int threads );
+             bool           open            ( const string& path );
+      inline bool           isOpen          () const;
+      inline size_t         getSize         () const;
+      inline size_t         getStructuresSize () const;
+             void           read            ( GdsRecord& );
+    private:
+      struct Structure {
+          size_t  _begin;
+          size_t  _end;
+      };
+    private:
+             void           _index          ();
+             void           _decodeWindow   ();
+    private:
+      GdsBuffer                    _buffer;
+      unsigned int                 _threads;
+      size_t                       _offset;
+      vector<Structure>            _structures;
+      size_t                       _next;
+      size_t                       _windowStart;
+      vector< vector<GdsRecord> >  _window;
+      size_t                       _served;
+      size_t                       _record;
+  };
+
+
+  inline bool    GdsRecordStream::isOpen            () const { return _buffer.isOpen(); }
+  inline size_t  GdsRecordStream::getSize           () const { return _buffer.getSize(); }
+  inline size_t  GdsRecordStream::getStructuresSize () const { return _structures.size(); }
+
+
+  GdsRecordStream::GdsRecordStream ( unsigned int threads )
+    : _buffer     ()
+    , _threads    ((threads) ? threads : 1)
+    , _offset     (0)
+    , _structures ()
+    , _next       (0)
+    , _windowStart(0)
+    , _window     ()
+    , _served     (0)
+    , _record     (0)
+  { }
+
+
+  bool  GdsRecordStream::open ( const string& path )
+  {
+    if (not _buffer.open(path)) return false;
+    _index();
+    return true;
+  }
+
+
+  void  GdsRecordStream::_index ()
+  {
+    const uint8_t* data  = _buffer.getData();
+    size_t         size  = _buffer.getSize();
+    size_t         begin = size;
+    for ( size_t offset=0 ; offset+4 <= size ; ) {
+      uint16_t length = fromBigEndian<uint16_t>( data+offset   );
+      uint16_t type   = fromBigEndian<uint16_t>( data+offset+2 );
+      if ((length < 4) or (offset+length > size)) break;
+      if (type == GdsRecord::BGNSTR) begin = offset;
+      offset += length;
+      if ((type == GdsRecord::ENDSTR) and (begin < size)) {
+        _structures.push_back( { begin, offset } );
+        begin = size;
+      }
+      if (type == GdsRecord::ENDLIB) break;
+    }
+    cdebug_log(101,0) << "GdsRecordStream::_index(): " << _structures.size() << " STRUCTUREs." << endl;
+  }
+
+
+  void  GdsRecordStream::_decodeWindow ()
+  {
+    size_t first = _next;
+    size_t last  = _next + 1;
+    while ( (last < _structures.size())
+          and (_structures[last]._end - _structures[first]._begin <= WindowSize) ) ++last;
+
+    _window.clear();
+    _window.resize( last - first );
+    _windowStart = first;
+    _next        = last;
+    _served      = 0;
+    _record      = 0;
+
+    atomic<size_t> nextStructure ( first );
+    auto decoder = [&]() {
+      for ( size_t i=nextStructure++ ; i<last ; i=nextStructure++ ) {
+        vector<GdsRecord>& records = _window[ i-first ];
+        size_t             offset  = _structures[i]._begin;
+        while ( offset < _structures[i]._end ) {
+          records.emplace_back();
+          records.back().read( _buffer, offset );
+        }
+      }
+    };
+
+    vector<std::thread> workers;
+    for ( size_t i=1 ; i<std::min( (size_t)_threads, last-first ) ; ++i )
+      workers.push_back( std::thread( decoder ));
+    decoder();
+    for ( std::thread& worker : workers ) worker.join();
+  }
+
+
+  void  GdsRecordStream::read ( GdsRecord& record )
+  {
+    if (    (_served == _window.size())
+       and  (_next   <  _structures.size())
+       and  (_offset == _structures[_next]._begin) )
+      _decodeWindow();
+
+    if (    (_served <  _window.size())
+       and  (_offset >= _structures[_windowStart+_served]._begin) ) {
+      vector<GdsRecord>& records = _window[ _served ];
+      record.swap( records[_record] );
+      _offset = record.getOffset() + record.getLength();
+      if (++_record == records.size()) {
+        vector<GdsRecord>().swap( records );
+        _record = 0;
+        ++_served;
+      }
+      return;
+    }
+    record.read( _buffer, _offset );
+  }
+
+
+  GdsRecordStream& operator>> ( GdsRecordStream& stream, GdsRecord& record )
+  { stream.read( record ); return stream; }
 
 
 // -------------------------------------------------------------------
@@ -710,7 +999,7 @@ namespace {
              vector<Cell*>               _cells;
              uint32_t                    _flags;
              string                      _gdsPath;
-             ifstream                    _stream;
+             GdsRecordStream             _stream;
              GdsRecord                   _record;
              double                      _angle;
              bool                        _xReflection;
@@ -778,7 +1067,7 @@ namespace {
     , _cells           ()
     , _flags           (flags)
     , _gdsPath         (gdsPath)
-    , _stream          ()
+    , _stream          ( std::max( 1, Cfg::getParamInt("gds.threads",1)->asInt() ))
     , _record          ()
     , _angle           (0.0)
     , _xReflection     (false)
@@ -793,8 +1082,7 @@ namespace {
   {
     if (_gdsLayerTable.empty()) _staticInit();
     
-    _stream.open( gdsPath, ios_base::in|ios_base::binary );
-    if (not _stream.is_open()) {
+    if (not _stream.open(gdsPath)) {
       cerr << Error( "GdsStream::GdsStream(): Unable to open stream, check path.\n"
                      "        \"%s\""
                    , _gdsPath.c_str() ) << endl;
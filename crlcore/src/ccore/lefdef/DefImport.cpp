@@ -17,6 +17,7 @@
 #include <cstdio>
 #include <cstring>
 #include <memory>
+#include <unordered_map>
 #include <boost/algorithm/string.hpp>
 #if defined(HAVE_LEFDEF)
 #  include "lefrReader.hpp"
@@ -69,16 +70,67 @@ namespace {
   typedef  tuple<Cell*,uint32_t>  ViaDatas;
 
 
+// -------------------------------------------------------------------
+// Flat buffers of the parsed DEF sections. In BulkLoad mode they are
+// filled by the callbacks and the Hurricane objects are built only
+// at the end of each section (or by batches for the nets, to bound
+// the memory used by the wiring). Otherwise they hold one item only.
+
+  struct ComponentEntry {
+    Cell*                      _masterCell;
+    string                     _id;
+    Transformation             _placement;
+    Instance::PlacementStatus  _state;
+  };
+
+
+  struct PinEntry {
+    string                _netName;
+    string                _pinName;
+    Net::Direction::Code  _direction;
+    Net::Type::Code       _type;
+    bool                  _special;
+    bool                  _placed;
+    string                _layerName;
+    Layer*                _layer;
+    Point                 _position;
+    Box                   _shape;
+  };
+
+
+  struct NetEntry {
+    string  _name;
+    bool    _special;
+    size_t  _connectionsBegin;
+    size_t  _connectionsEnd;
+    size_t  _pathsBegin;
+    size_t  _pathsEnd;
+  };
+
+
+// Path elements are stored with the current layer, width & position
+// already resolved. A DEFIPATH_DONE entry closes each path.
+  struct PathEntry {
+    int           _type;
+    const Layer*  _layer;
+    ViaDatas*     _via;
+    DbU::Unit     _width;
+    DbU::Unit     _x;
+    DbU::Unit     _y;
+  };
+
+
   class DefParser {
     public:
       const uint32_t NoPatch =  0;
       const uint32_t Sky130  = (1 << 10);
+      static const size_t  NetsBatchSize = 1 << 20;
     public:
       static AllianceFramework* getFramework             ();
       static Cell*              getLefCell               ( string name );
       static void               setUnits                 ( double );
       static DbU::Unit          fromDefUnits             ( int );
-      static Transformation::Orientation                 
+      static Transformation::Orientation
                                 fromDefOrientation       ( int orient );
       static Transformation     getTransformation        ( const Box&
                                                          , const DbU::Unit x
@@ -90,61 +142,81 @@ namespace {
                                ~DefParser                ();
       inline bool               hasErrors                ();
       inline bool               isSky130                 () const;
+      inline bool               isBulkLoad               () const;
       inline unsigned int       getFlags                 () const;
       inline AllianceLibrary*   getLibrary               ();
       inline Cell*              getCell                  ();
       inline size_t             getPitchs                () const;
       inline size_t             getSlices                () const;
       inline const Box&         getFitOnCellsDieArea     () const;
-             Net*               getPrebuildNet           ( bool create=true );
       inline string             getBusBits               () const;
-             NetDatas*          lookupNet                ( string );
-             ViaDatas*          lookupVia                ( string );
+             NetDatas*          lookupNet                ( const string& );
+             ViaDatas*          lookupVia                ( const string& );
              Layer*             lookupLayer              ( string );
+             Cell*              lookupMaster             ( const string& );
+             Instance*          lookupInstance           ( const string& );
       inline vector<string>&    getErrors                ();
       inline void               pushError                ( string );
              int                flushErrors              ();
       inline void               clearErrors              ();
       inline void               setPitchs                ( size_t );
       inline void               setSlices                ( size_t );
-      inline void               setPrebuildNet           ( Net* );
       inline void               setBusBits               ( string );
-             NetDatas*          addNetLookup             ( string netName, Net* );
-             ViaDatas*          addViaLookup             ( string viaName, Cell* );
+             NetDatas*          addNetLookup             ( const string& netName, Net* );
+             ViaDatas*          addViaLookup             ( const string& viaName, Cell* );
              void               toHurricaneName          ( string& );
       inline void               mergeToFitOnCellsDieArea ( const Box& );
-             Contact*           createVia                ( string viaName, Net*, DbU::Unit x, DbU::Unit y );
-    private:                                         
+             Contact*           createVia                ( ViaDatas*, Net*, DbU::Unit x, DbU::Unit y );
+    private:
       static int                _unitsCbk                ( defrCallbackType_e, double        , defiUserData );
       static int                _busBitCbk               ( defrCallbackType_e, const char*   , defiUserData );
       static int                _designEndCbk            ( defrCallbackType_e, void*         , defiUserData );
       static int                _dieAreaCbk              ( defrCallbackType_e, defiBox*      , defiUserData );
+      static int                _pinStartCbk             ( defrCallbackType_e, int           , defiUserData );
       static int                _pinCbk                  ( defrCallbackType_e, defiPin*      , defiUserData );
+      static int                _pinEndCbk               ( defrCallbackType_e, void*         , defiUserData );
       static int                _viaCbk                  ( defrCallbackType_e, defiVia*      , defiUserData );
+      static int                _componentStartCbk       ( defrCallbackType_e, int           , defiUserData );
       static int                _componentCbk            ( defrCallbackType_e, defiComponent*, defiUserData );
       static int                _componentEndCbk         ( defrCallbackType_e, void*         , defiUserData );
+      static int                _netStartCbk             ( defrCallbackType_e, int           , defiUserData );
       static int                _netCbk                  ( defrCallbackType_e, defiNet*      , defiUserData );
       static int                _netEndCbk               ( defrCallbackType_e, void*         , defiUserData );
       static int                _snetCbk                 ( defrCallbackType_e, defiNet*      , defiUserData );
       static int                _pathCbk                 ( defrCallbackType_e, defiPath*     , defiUserData );
              Cell*              _createCell              ( const char* name );
+             void               _reserveNets             ( size_t );
+             void               _addNet                  ( defiNet*, bool special );
+             void               _buildComponent          ( const ComponentEntry& );
+             void               _buildPin                ( const PinEntry& );
+             void               _buildNet                ( const NetEntry& );
+             void               _buildPath               ( Net*, size_t begin, size_t end );
+             void               _flushComponents         ();
+             void               _flushPins               ();
+             void               _flushNets               ();
     private:
-      static double                _defUnits;
-      static AllianceFramework*    _framework;
-      static Technology*           _technology;
-      static Library*              _lefRootLibrary;
-             uint32_t              _flags;
-             string                _file;
-             AllianceLibrary*      _library;
-             string                _busBits;
-             Cell*                 _cell;
-             size_t                _pitchs;
-             size_t                _slices;
-             Box                   _fitOnCellsDieArea;
-             Net*                  _prebuildNet;
-             map<string,NetDatas>  _netsLookup;
-             map<string,ViaDatas>  _viasLookup;
-             vector<string>        _errors;
+      static double                          _defUnits;
+      static AllianceFramework*              _framework;
+      static Technology*                     _technology;
+      static Library*                        _lefRootLibrary;
+             uint32_t                        _flags;
+             string                          _file;
+             AllianceLibrary*                _library;
+             string                          _busBits;
+             Cell*                           _cell;
+             size_t                          _pitchs;
+             size_t                          _slices;
+             Box                             _fitOnCellsDieArea;
+             unordered_map<string,NetDatas>  _netsLookup;
+             unordered_map<string,ViaDatas>  _viasLookup;
+             unordered_map<string,Cell*>     _mastersLookup;
+             unordered_map<string,Instance*> _instancesLookup;
+             vector<ComponentEntry>          _components;
+             vector<PinEntry>                _pins;
+             vector<NetEntry>                _nets;
+             vector< pair<string,string> >   _connections;
+             vector<PathEntry>               _paths;
+             vector<string>                  _errors;
   };
 
 
@@ -163,9 +235,15 @@ namespace {
     , _pitchs           (0)
     , _slices           (0)
     , _fitOnCellsDieArea()
-    , _prebuildNet      (NULL)
     , _netsLookup       ()
     , _viasLookup       ()
+    , _mastersLookup    ()
+    , _instancesLookup  ()
+    , _components       ()
+    , _pins             ()
+    , _nets             ()
+    , _connections      ()
+    , _paths            ()
     , _errors           ()
   {
     defrInit               ();
@@ -174,12 +252,18 @@ namespace {
     defrSetDesignEndCbk    ( _designEndCbk );
     defrSetDieAreaCbk      ( _dieAreaCbk );
     defrSetViaCbk          ( _viaCbk );
+    defrSetStartPinsCbk    ( _pinStartCbk );
     defrSetPinCbk          ( _pinCbk );
+    defrSetPinEndCbk       ( _pinEndCbk );
+    defrSetComponentStartCbk( _componentStartCbk );
     defrSetComponentCbk    ( _componentCbk );
     defrSetComponentEndCbk ( _componentEndCbk );
+    defrSetNetStartCbk     ( _netStartCbk );
     defrSetNetCbk          ( _netCbk );
     defrSetNetEndCbk       ( _netEndCbk );
+    defrSetSNetStartCbk    ( _netStartCbk );
     defrSetSNetCbk         ( _snetCbk );
+    defrSetSNetEndCbk      ( _netEndCbk );
     defrSetPathCbk         ( _pathCbk );
 
     if (DataBase::getDB()->getTechnology()->getName() == "Sky130") {
@@ -199,6 +283,7 @@ namespace {
   inline void               DefParser::setUnits                 ( double units ) { _defUnits = 1/units; }
   inline DbU::Unit          DefParser::fromDefUnits             ( int u ) { return DbU::fromPhysical(_defUnits*(double)u,DbU::UnitPower::Micro); }
   inline bool               DefParser::isSky130                 () const { return _flags & Sky130; }
+  inline bool               DefParser::isBulkLoad               () const { return _flags & DefImport::BulkLoad; }
   inline bool               DefParser::hasErrors                () { return not _errors.empty(); }
   inline unsigned int       DefParser::getFlags                 () const { return _flags; }
   inline string             DefParser::getBusBits               () const { return _busBits; }
@@ -212,19 +297,9 @@ namespace {
   inline void               DefParser::clearErrors              () { return _errors.clear(); }
   inline void               DefParser::setPitchs                ( size_t pitchs ) { _pitchs=pitchs; }
   inline void               DefParser::setSlices                ( size_t slices ) { _slices=slices; }
-  inline void               DefParser::setPrebuildNet           ( Net* net ) { _prebuildNet=net; }
   inline void               DefParser::setBusBits               ( string busbits ) { _busBits = busbits; }
   inline void               DefParser::mergeToFitOnCellsDieArea ( const Box& box ) { _fitOnCellsDieArea.merge(box); }
 
-  
-  Net* DefParser::getPrebuildNet ( bool create )
-  {
-    if (create and not _prebuildNet) {
-      _prebuildNet = Net::create( getCell(), "__prebuildnet__" );
-    }
-    return _prebuildNet;
-  }
-
 
   Cell* DefParser::getLefCell ( string name )
   {
@@ -328,16 +403,16 @@ namespace {
   }
 
 
-  NetDatas* DefParser::lookupNet ( string netName )
+  NetDatas* DefParser::lookupNet ( const string& netName )
   {
-    map<string,NetDatas>::iterator imap = _netsLookup.find(netName);
+    unordered_map<string,NetDatas>::iterator imap = _netsLookup.find(netName);
     if ( imap == _netsLookup.end() ) return NULL;
 
     return &( (*imap).second );
   }
 
 
-  NetDatas* DefParser::addNetLookup ( string netName, Net* net )
+  NetDatas* DefParser::addNetLookup ( const string& netName, Net* net )
   {
     NetDatas* netDatas = lookupNet( netName );
     if (not netDatas) {
@@ -348,16 +423,16 @@ namespace {
   }
 
 
-  ViaDatas* DefParser::lookupVia ( string viaName )
+  ViaDatas* DefParser::lookupVia ( const string& viaName )
   {
-    map<string,ViaDatas>::iterator imap = _viasLookup.find(viaName);
+    unordered_map<string,ViaDatas>::iterator imap = _viasLookup.find(viaName);
     if (imap == _viasLookup.end() ) return NULL;
 
     return &( (*imap).second );
   }
 
 
-  ViaDatas* DefParser::addViaLookup ( string viaName, Cell* via )
+  ViaDatas* DefParser::addViaLookup ( const string& viaName, Cell* via )
   {
     ViaDatas* viaDatas = lookupVia( viaName );
     if (not viaDatas) {
@@ -368,13 +443,31 @@ namespace {
   }
 
 
-  Contact* DefParser::createVia ( string viaName, Net* net, DbU::Unit x, DbU::Unit y )
+  Cell* DefParser::lookupMaster ( const string& name )
   {
-    ViaDatas* viaDatas = lookupVia( viaName );
-    if (not viaDatas) return NULL;
+  // Unknown masters are cached too (as NULL), so every faulty
+  // component will still be reported.
+    auto imaster = _mastersLookup.find( name );
+    if (imaster != _mastersLookup.end()) return (*imaster).second;
 
-    string instName = viaName + "_" + getString( get<1>(*viaDatas)++ );
-    Cell*     viaCell = get<0>( *viaDatas );
+    Cell* masterCell = getLefCell( name );
+    _mastersLookup.insert( make_pair( name, masterCell ));
+    return masterCell;
+  }
+
+
+  Instance* DefParser::lookupInstance ( const string& name )
+  {
+    auto iinstance = _instancesLookup.find( name );
+    if (iinstance != _instancesLookup.end()) return (*iinstance).second;
+    return getCell()->getInstance( name );
+  }
+
+
+  Contact* DefParser::createVia ( ViaDatas* viaDatas, Net* net, DbU::Unit x, DbU::Unit y )
+  {
+    Cell*  viaCell  = get<0>( *viaDatas );
+    string instName = getString( viaCell->getName() ) + "_" + getString( get<1>(*viaDatas)++ );
     Instance::create( getCell()
                     , instName
                     , viaCell
@@ -395,6 +488,237 @@ namespace {
   }
 
 
+  void  DefParser::_reserveNets ( size_t count )
+  {
+    _netsLookup.reserve( _netsLookup.size() + count );
+    if (isBulkLoad()) {
+      _nets.reserve( std::min( count, NetsBatchSize ) );
+    // Standard cells netlists average a little under four pins per net.
+      _connections.reserve( 4*std::min( count, NetsBatchSize ) );
+    }
+  }
+
+
+  void  DefParser::_buildComponent ( const ComponentEntry& entry )
+  {
+    Instance* instance = Instance::create ( getCell()
+                                          , entry._id
+                                          , entry._masterCell
+                                          , entry._placement
+                                          , entry._state
+                                          );
+    _instancesLookup.insert( make_pair( entry._id, instance ));
+    if ( entry._state != Instance::PlacementStatus::UNPLACED ) {
+      mergeToFitOnCellsDieArea ( instance->getAbutmentBox() );
+    }
+
+  //cerr << "Create " << entry._id << " of " << entry._masterCell
+  //      << " ab:" << entry._masterCell->getAbutmentBox() << " @" << entry._placement << endl;
+  }
+
+
+  void  DefParser::_buildPin ( const PinEntry& entry )
+  {
+    const string& netName  = entry._netName;
+    NetDatas*     netDatas = lookupNet( netName );
+    Net*          hnet     = NULL;
+    if (not netDatas) {
+      hnet     = Net::create( getCell(), netName );
+      netDatas = addNetLookup( netName, hnet );
+    //if (not netName.compare(pin->pinName()))
+    //   parser->addNetLookup( pin->pinName(), hnet );
+    } else
+      hnet = get<0>( *netDatas );
+    string pinName = entry._pinName + '.' + getString( get<1>(*netDatas)++ );
+
+    if (entry._direction != Net::Direction::UNDEFINED) hnet->setDirection( entry._direction );
+    if (entry._type      != Net::Type::UNDEFINED     ) hnet->setType     ( entry._type );
+
+    if (entry._special and (hnet->isSupply() or hnet->isClock()))
+       hnet->setGlobal( true );
+
+    if (entry._placed) {
+      if (not entry._layer) {
+        ostringstream message;
+        message << "PIN \"" << pinName << "\" of net \"" << netName << "\" use an unkwown layer \""
+                << entry._layerName << "\".";
+        pushError( message.str() );
+        return;
+      }
+
+      Pin* pin = Pin::create( hnet
+                            , pinName
+                            , Pin::AccessDirection::UNDEFINED
+                            , Pin::PlacementStatus::FIXED
+                            , entry._layer
+                            , entry._position.getX()
+                            , entry._position.getY()
+                            , entry._shape.getWidth()
+                            , entry._shape.getHeight()
+                            );
+      if (not hnet->isExternal()) hnet->setExternal( true );
+      NetExternalComponents::setExternal( pin );
+    }
+  }
+
+
+  void  DefParser::_buildNet ( const NetEntry& entry )
+  {
+    static size_t netCount  = 0;
+    static size_t snetCount = 0;
+
+    NetDatas* netDatas = lookupNet( entry._name );
+    Net*      hnet     = NULL;
+    if (not netDatas) {
+      hnet = Net::create( getCell(), entry._name );
+      addNetLookup( entry._name, hnet );
+    } else
+      hnet = get<0>( *netDatas );
+
+    if (tty::enabled()) {
+      string name = entry._name;
+      if (name.size() > 78) {
+        name.erase ( 0, name.size()-75 );
+        name.insert( 0, 3, '.' );
+      }
+      name.insert( 0, "\"" );
+      name.insert( name.size(), "\"" );
+      if (name.size() < 80) name.insert( name.size(), 80-name.size(), ' ' );
+
+      cmess2 << "     <net:"
+             << tty::bold  << setw(7)  << setfill('0') << ++(entry._special ? snetCount : netCount)
+             << "> " << setfill(' ')
+             << tty::reset << setw(80) << name << tty::cr;
+      cmess2.flush ();
+    }
+
+    for ( size_t icon=entry._connectionsBegin ; icon<entry._connectionsEnd ; ++icon ) {
+      const string& instanceName = _connections[icon].first;
+      const string& pinName      = _connections[icon].second;
+
+      Instance* instance = lookupInstance( instanceName );
+      if ( instance == NULL ) {
+        ostringstream message;
+        message << "Unknown instance (DEF COMPONENT) <" << instanceName << "> in <%s>.";
+        pushError( message.str() );
+        continue;
+      }
+
+      Net* masterNet = instance->getMasterCell()->getNet( pinName );
+      if (not masterNet) {
+        ostringstream message;
+        message << "Unknown PIN <" << pinName << "> in instance <"
+                << instanceName << "> (LEF MACRO) in <%s>.";
+        pushError( message.str() );
+        continue;
+      }
+
+      instance->getPlug( masterNet )->setNet( hnet );
+    }
+
+    _buildPath( hnet, entry._pathsBegin, entry._pathsEnd );
+  }
+
+
+  void  DefParser::_buildPath ( Net* hnet, size_t begin, size_t end )
+  {
+    Contact* source = NULL;
+    Contact* target = NULL;
+
+    for ( size_t ientry=begin ; ientry<end ; ++ientry ) {
+      const PathEntry& entry = _paths[ientry];
+
+      switch ( entry._type ) {
+        case DEFIPATH_DONE:
+          source = NULL;
+          target = NULL;
+          break;
+        case DEFIPATH_FLUSHPOINT:
+          target = NULL;
+        // Fall through.
+        case DEFIPATH_POINT:
+          source = target;
+          target = Contact::create( hnet, entry._layer, entry._x, entry._y );
+          if (source) {
+            if (source->getX() == entry._x) {
+              Vertical::create( source, target, entry._layer, entry._x, entry._width );
+            } else if (source->getY() == entry._y) {
+              Horizontal::create( source, target, entry._layer, entry._y, entry._width );
+            } else {
+              ostringstream message;
+              message << "Non-manhattan segment in net <" << hnet->getName() << ">.";
+              pushError ( message.str() );
+            }
+          }
+          break;
+        case DEFIPATH_VIA:
+          if (entry._via) {
+            target = createVia( entry._via, hnet, entry._x, entry._y );
+          } else if (target) {
+            target = Contact::create( target, entry._layer, 0, 0 );
+          } else {
+            target = Contact::create( hnet, entry._layer, entry._x, entry._y, 0, 0 );
+          }
+          break;
+      }
+    }
+  }
+
+
+  void  DefParser::_flushComponents ()
+  {
+    for ( const ComponentEntry& entry : _components ) _buildComponent( entry );
+    _components.clear();
+  }
+
+
+  void  DefParser::_flushPins ()
+  {
+    for ( const PinEntry& entry : _pins ) _buildPin( entry );
+    _pins.clear();
+  }
+
+
+  void  DefParser::_flushNets ()
+  {
+    for ( const NetEntry& entry : _nets ) _buildNet( entry );
+    _nets       .clear();
+    _connections.clear();
+    _paths      .clear();
+  }
+
+
+  void  DefParser::_addNet ( defiNet* net, bool special )
+  {
+    NetEntry entry;
+    entry._name    = net->name();
+    entry._special = special;
+    toHurricaneName( entry._name );
+
+    entry._connectionsBegin = _connections.size();
+    int numConnections = net->numConnections();
+    for ( int icon=0 ; icon<numConnections ; ++icon ) {
+      string instanceName = net->instance(icon);
+      string pinName      = net->pin(icon);
+
+    // Connect to an external pin.
+      if (instanceName.compare("PIN") == 0) continue;
+      toHurricaneName( pinName );
+      _connections.push_back( make_pair( instanceName, pinName ));
+    }
+    entry._connectionsEnd = _connections.size();
+
+  // The paths of a net are delivered by _pathCbk() *before* the net
+  // itself, so they are the ones following the previous net.
+    entry._pathsBegin = (_nets.empty()) ? 0 : _nets.back()._pathsEnd;
+    entry._pathsEnd   = _paths.size();
+    _nets.push_back( entry );
+
+    if (not isBulkLoad() or (_nets.size() >= NetsBatchSize) or (_paths.size() >= NetsBatchSize))
+      _flushNets();
+  }
+
+
   Layer* DefParser::lookupLayer ( string layerName )
   {
     if (_flags & Sky130) {
@@ -432,6 +756,11 @@ namespace {
   {
     DefParser* parser = (DefParser*)ud;
 
+  // Should a section end have been missed, build what remains.
+    parser->_flushComponents();
+    parser->_flushPins();
+    parser->_flushNets();
+
     if (      (parser->getFlags() & DefImport::FitAbOnCells)
        and not parser->getFitOnCellsDieArea().isEmpty() ) {
       parser->getCell()->setAbutmentBox ( parser->getFitOnCellsDieArea() );
@@ -531,7 +860,15 @@ namespace {
 
     return 0;
   }
-  
+
+  int  DefParser::_pinStartCbk ( defrCallbackType_e c, int count, lefiUserData ud )
+  {
+    DefParser* parser = (DefParser*)ud;
+    parser->_netsLookup.reserve( parser->_netsLookup.size() + count );
+    if (parser->isBulkLoad()) parser->_pins.reserve( count );
+    return 0;
+  }
+
 
   int  DefParser::_pinCbk ( defrCallbackType_e c, defiPin* pin, lefiUserData ud )
   {
@@ -539,82 +876,73 @@ namespace {
 
   //cerr << "     - Pin " << pin->pinName() << ":" << pin->netName() << endl;
 
-    string netName = pin->netName();
-    string pinName = pin->pinName();
-    parser->toHurricaneName( netName );
-    parser->toHurricaneName( pinName );
-    if (parser->isSky130() and (pinName.substr(0,3) == "io_" ))
-      netName = pinName;
-
-    NetDatas* netDatas = parser->lookupNet( netName );
-    Net*      hnet     = NULL;
-    if (not netDatas) {
-      hnet     = Net::create( parser->getCell(), netName );
-      netDatas = parser->addNetLookup( netName, hnet );
-    //if (not netName.compare(pin->pinName()))
-    //   parser->addNetLookup( pin->pinName(), hnet );
-    } else
-      hnet = get<0>( *netDatas );
-    pinName += '.' + getString( get<1>(*netDatas)++ );
+    PinEntry entry;
+    entry._netName   = pin->netName();
+    entry._pinName   = pin->pinName();
+    entry._direction = Net::Direction::UNDEFINED;
+    entry._type      = Net::Type::UNDEFINED;
+    entry._special   = pin->hasSpecial();
+    entry._placed    = pin->isPlaced() or pin->isFixed();
+    entry._layer     = NULL;
+    parser->toHurricaneName( entry._netName );
+    parser->toHurricaneName( entry._pinName );
+    if (parser->isSky130() and (entry._pinName.substr(0,3) == "io_" ))
+      entry._netName = entry._pinName;
 
     if (pin->hasDirection()) {
       string defDir = pin->direction();
       boost::to_upper( defDir );
-      if (defDir == "INPUT"          ) hnet->setDirection( Net::Direction::IN       );
-      if (defDir == "OUTPUT"         ) hnet->setDirection( Net::Direction::OUT      );
-      if (defDir == "OUTPUT TRISTATE") hnet->setDirection( Net::Direction::TRISTATE );
-      if (defDir == "INOUT"          ) hnet->setDirection( Net::Direction::INOUT    );
+      if (defDir == "INPUT"          ) entry._direction = Net::Direction::IN;
+      if (defDir == "OUTPUT"         ) entry._direction = Net::Direction::OUT;
+      if (defDir == "OUTPUT TRISTATE") entry._direction = Net::Direction::TRISTATE;
+      if (defDir == "INOUT"          ) entry._direction = Net::Direction::INOUT;
     }
 
     if (pin->hasUse()) {
       string defUse = pin->use();
       boost::to_upper( defUse );
-      if (defUse == "SIGNAL") hnet->setType( Net::Type::LOGICAL );
-    //if (defUse == "ANALOG") hnet->setType( Net::Type::ANALOG  );
-      if (defUse == "CLOCK" ) hnet->setType( Net::Type::CLOCK   );
-      if (defUse == "POWER" ) hnet->setType( Net::Type::POWER   );
-      if (defUse == "GROUND") hnet->setType( Net::Type::GROUND  );
+      if (defUse == "SIGNAL") entry._type = Net::Type::LOGICAL;
+    //if (defUse == "ANALOG") entry._type = Net::Type::ANALOG;
+      if (defUse == "CLOCK" ) entry._type = Net::Type::CLOCK;
+      if (defUse == "POWER" ) entry._type = Net::Type::POWER;
+      if (defUse == "GROUND") entry._type = Net::Type::GROUND;
     }
 
-    if (pin->hasSpecial() and (hnet->isSupply() or hnet->isClock()))
-       hnet->setGlobal( true );
-
-    if (pin->isPlaced() or pin->isFixed()) {
-      Point position ( fromDefUnits(pin->placementX()), fromDefUnits(pin->placementY()) );
-      string layerName = pin->layer(0);
-      Layer* layer     = parser->lookupLayer( layerName );
-      int    x1        = 0;
-      int    y1        = 0;
-      int    x2        = 0;
-      int    y2        = 0;
+    if (entry._placed) {
+      int x1 = 0;
+      int y1 = 0;
+      int x2 = 0;
+      int y2 = 0;
       pin->bounds( 0, &x1, &y1, &x2, &y2 );
-      Box shape ( fromDefUnits(x1)
-                , fromDefUnits(y1)
-                , fromDefUnits(x2)
-                , fromDefUnits(y2) );
+      entry._layerName = pin->layer(0);
+      entry._layer     = parser->lookupLayer( entry._layerName );
+      entry._position  = Point( fromDefUnits(pin->placementX()), fromDefUnits(pin->placementY()) );
+      entry._shape     = Box  ( fromDefUnits(x1)
+                              , fromDefUnits(y1)
+                              , fromDefUnits(x2)
+                              , fromDefUnits(y2) );
+    }
 
-      if (not layer) {
-        ostringstream message;
-        message << "PIN \"" << pinName << "\" of net \"" << netName << "\" use an unkwown layer \""
-                << layerName << "\".";
-        parser->pushError( message.str() );
-        return 0;
-      }
+    parser->_pins.push_back( entry );
+    if (not parser->isBulkLoad()) parser->_flushPins();
+
+    return 0;
+  }
+
+
+  int  DefParser::_pinEndCbk ( defrCallbackType_e c, void*, lefiUserData ud )
+  {
+    DefParser* parser = (DefParser*)ud;
+    parser->_flushPins();
+    return parser->flushErrors ();
+  }
 
-      Pin* pin = Pin::create( hnet
-                            , pinName
-                            , Pin::AccessDirection::UNDEFINED
-                            , Pin::PlacementStatus::FIXED
-                            , layer
-                            , position.getX()
-                            , position.getY()
-                            , shape.getWidth()
-                            , shape.getHeight()
-                            );
-      if (not hnet->isExternal()) hnet->setExternal( true );
-      NetExternalComponents::setExternal( pin );
-    }
 
+  int  DefParser::_componentStartCbk ( defrCallbackType_e c, int count, lefiUserData ud )
+  {
+    DefParser* parser = (DefParser*)ud;
+    parser->_instancesLookup.reserve( count );
+    if (parser->isBulkLoad()) parser->_components.reserve( count );
     return 0;
   }
 
@@ -624,8 +952,7 @@ namespace {
     DefParser* parser = (DefParser*)ud;
 
     string componentName = component->name();
-    string componentId   = component->id();
-    Cell*  masterCell    = getLefCell( componentName );
+    Cell*  masterCell    = parser->lookupMaster( componentName );
 
     if ( masterCell == NULL ) {
       ostringstream message;
@@ -634,31 +961,24 @@ namespace {
       return 0;
     }
 
-    Transformation            placement;
-    Instance::PlacementStatus state     ( Instance::PlacementStatus::UNPLACED );
+    ComponentEntry entry { masterCell
+                         , component->id()
+                         , Transformation()
+                         , Instance::PlacementStatus( Instance::PlacementStatus::UNPLACED )
+                         };
     if ( component->isPlaced() or component->isFixed() ) {
-      state = (component->isPlaced()) ? Instance::PlacementStatus::PLACED
-                                      : Instance::PlacementStatus::FIXED;
-
-      placement = getTransformation ( masterCell->getAbutmentBox()
-                                    , fromDefUnits(component->placementX())
-                                    , fromDefUnits(component->placementY())
-                                    , fromDefOrientation ( component->placementOrient() )
-                                    );
-    }
-
-    Instance* instance = Instance::create ( parser->getCell()
-                                          , componentId
-                                          , masterCell
-                                          , placement
-                                          , state
-                                          );
-    if ( state != Instance::PlacementStatus::UNPLACED ) {
-      parser->mergeToFitOnCellsDieArea ( instance->getAbutmentBox() );
+      entry._state = (component->isPlaced()) ? Instance::PlacementStatus::PLACED
+                                             : Instance::PlacementStatus::FIXED;
+
+      entry._placement = getTransformation ( masterCell->getAbutmentBox()
+                                           , fromDefUnits(component->placementX())
+                                           , fromDefUnits(component->placementY())
+                                           , fromDefOrientation ( component->placementOrient() )
+                                           );
     }
 
-  //cerr << "Create " << componentId << " of " << masterCell
-  //      << " ab:" << masterCell->getAbutmentBox() << " @" << placement << endl;
+    parser->_components.push_back( entry );
+    if (not parser->isBulkLoad()) parser->_flushComponents();
 
     return 0;
   }
@@ -667,153 +987,33 @@ namespace {
   int  DefParser::_componentEndCbk ( defrCallbackType_e c, void*, lefiUserData ud )
   {
     DefParser* parser = (DefParser*)ud;
+    parser->_flushComponents();
     return parser->flushErrors ();
   }
 
 
-  int  DefParser::_netCbk ( defrCallbackType_e c, defiNet* net, lefiUserData ud )
+  int  DefParser::_netStartCbk ( defrCallbackType_e c, int count, lefiUserData ud )
   {
-    static size_t netCount = 0;
-
     DefParser* parser = (DefParser*)ud;
+    parser->_reserveNets( count );
+    return 0;
+  }
 
-  //cerr << "     - Net " << net->name() << endl;
-
-    string name = net->name();
-    parser->toHurricaneName( name );
-    
-    NetDatas* netDatas = parser->lookupNet( name );
-    Net*      hnet     = NULL;
-    if (not netDatas) {
-      hnet = Net::create( parser->getCell(), name );
-      parser->addNetLookup( name, hnet );
-    } else
-      hnet = get<0>( *netDatas );
-
-    if (parser->getPrebuildNet(false)) {
-      Name prebuildAlias = parser->getPrebuildNet()->getName();
-      hnet->merge( parser->getPrebuildNet() );
-      hnet->removeAlias( prebuildAlias );
-      parser->setPrebuildNet( NULL );
-    }
-
-    if (name.size() > 78) {
-      name.erase ( 0, name.size()-75 );
-      name.insert( 0, 3, '.' );
-    }
-    name.insert( 0, "\"" );
-    name.insert( name.size(), "\"" );
-    if (name.size() < 80) name.insert( name.size(), 80-name.size(), ' ' );
-
-    if (tty::enabled()) {
-      cmess2 << "     <net:"
-             << tty::bold  << setw(7)  << setfill('0') << ++netCount << "> " << setfill(' ')
-             << tty::reset << setw(80) << name << tty::cr;
-      cmess2.flush ();
-    }
-
-    int numConnections = net->numConnections();
-    for ( int icon=0 ; icon<numConnections ; ++icon ) {
-      string instanceName = net->instance(icon);
-      string pinName      = net->pin(icon);
-
-    // Connect to an external pin.
-      if (instanceName.compare("PIN") == 0) continue;
-      parser->toHurricaneName( pinName );
-
-      Instance* instance = parser->getCell()->getInstance( instanceName );
-      if ( instance == NULL ) {
-        ostringstream message;
-        message << "Unknown instance (DEF COMPONENT) <" << instanceName << "> in <%s>.";
-        parser->pushError( message.str() );
-        continue;
-      }
-
-      Net* masterNet = instance->getMasterCell()->getNet( pinName );
-      if (not masterNet) {
-        ostringstream message;
-        message << "Unknown PIN <" << pinName << "> in instance <"
-                << instanceName << "> (LEF MACRO) in <%s>.";
-        parser->pushError( message.str() );
-        continue;
-      }
-
-      instance->getPlug( masterNet )->setNet( hnet );
-    }
 
+  int  DefParser::_netCbk ( defrCallbackType_e c, defiNet* net, lefiUserData ud )
+  {
+    DefParser* parser = (DefParser*)ud;
+  //cerr << "     - Net " << net->name() << endl;
+    parser->_addNet( net, false );
     return 0;
   }
 
 
   int  DefParser::_snetCbk ( defrCallbackType_e c, defiNet* net, lefiUserData ud )
   {
-    static size_t netCount = 0;
-
     DefParser* parser = (DefParser*)ud;
   //cerr << "     - Special Net " << net->name() << endl;
-    
-    string name = net->name();
-    parser->toHurricaneName( name );
-    
-    NetDatas* netDatas = parser->lookupNet( name );
-    Net*      hnet     = NULL;
-    if (not netDatas) {
-      hnet = Net::create( parser->getCell(), name );
-      parser->addNetLookup( name, hnet );
-    } else
-      hnet = get<0>( *netDatas );
-
-    if (parser->getPrebuildNet(false)) {
-      Name prebuildAlias = parser->getPrebuildNet()->getName();
-      hnet->merge( parser->getPrebuildNet() );
-      hnet->removeAlias( prebuildAlias );
-      parser->setPrebuildNet( NULL );
-    }
-
-    if (name.size() > 78) {
-      name.erase ( 0, name.size()-75 );
-      name.insert( 0, 3, '.' );
-    }
-    name.insert( 0, "\"" );
-    name.insert( name.size(), "\"" );
-    if (name.size() < 80) name.insert( name.size(), 80-name.size(), ' ' );
-
-    if (tty::enabled()) {
-      cmess2 << "     <net:"
-             << tty::bold  << setw(7)  << setfill('0') << ++netCount << "> " << setfill(' ')
-             << tty::reset << setw(80) << name << tty::cr;
-      cmess2.flush ();
-    }
-
-    int numConnections = net->numConnections();
-    for ( int icon=0 ; icon<numConnections ; ++icon ) {
-      string instanceName = net->instance(icon);
-      string pinName      = net->pin(icon);
-
-    // Connect to an external pin.
-      if (instanceName.compare("PIN") == 0) continue;
-      parser->toHurricaneName( pinName );
-
-      Instance* instance = parser->getCell()->getInstance( instanceName );
-      if ( instance == NULL ) {
-        ostringstream message;
-        message << "Unknown instance (DEF COMPONENT) <" << instanceName << "> in <%s>.";
-        parser->pushError( message.str() );
-        continue;
-      }
-
-      Net* masterNet = instance->getMasterCell()->getNet( pinName );
-      if (not masterNet) {
-        ostringstream message;
-        message << "Unknown PIN <" << pinName << "> in instance <"
-                << instanceName << "> (LEF MACRO) in <%s>.";
-        parser->pushError( message.str() );
-        continue;
-      }
-
-      instance->getPlug( masterNet )->setNet( hnet );
-    }
-
+    parser->_addNet( net, true );
     return 0;
   }
 
@@ -821,6 +1021,7 @@ namespace {
   int  DefParser::_netEndCbk ( defrCallbackType_e c, void*, lefiUserData ud )
   {
     DefParser* parser = (DefParser*)ud;
+    parser->_flushNets();
     if (tty::enabled()) cmess2 << endl;
     return parser->flushErrors ();
   }
@@ -828,25 +1029,17 @@ namespace {
 
   int  DefParser::_pathCbk ( defrCallbackType_e c, defiPath* path, lefiUserData ud )
   {
-    DefParser*  parser       = (DefParser*)ud;
-    Technology* technology   = DataBase::getDB()->getTechnology();
-    Net*        hnet         = parser->getPrebuildNet();
-
-    Contact*     source   = NULL;
-    Contact*     target   = NULL;
-    const Layer* layer    = NULL;
-    const Layer* viaLayer = NULL;
-    DbU::Unit    width    = DbU::lambda(2.0);
-    DbU::Unit    x, y;
+    DefParser*   parser     = (DefParser*)ud;
+    Technology*  technology = DataBase::getDB()->getTechnology();
+    const Layer* layer      = NULL;
+    DbU::Unit    width      = DbU::lambda(2.0);
+    DbU::Unit    x          = 0;
+    DbU::Unit    y          = 0;
     int          defx, defy, defext;
     int          elementType;
 
     path->initTraverse ();
     while ( (elementType = path->next()) != DEFIPATH_DONE ) {
-      bool createSegment = false;
-      bool createVia     = false;
-      bool createViaInst = false;
-
       switch ( elementType ) {
         case DEFIPATH_LAYER:
           layer = parser->lookupLayer( path->getLayer() );
@@ -858,53 +1051,24 @@ namespace {
           path->getPoint( &defx, &defy );
           x = fromDefUnits( defx );
           y = fromDefUnits( defy );
-          createSegment = true;
+          parser->_paths.push_back( { DEFIPATH_POINT, layer, NULL, width, x, y } );
           break;
         case DEFIPATH_FLUSHPOINT:
           path->getFlushPoint( &defx, &defy, &defext );
           x = fromDefUnits( defx );
           y = fromDefUnits( defy );
-          target = NULL;
-          createSegment = true;
+          parser->_paths.push_back( { DEFIPATH_FLUSHPOINT, layer, NULL, width, x, y } );
           break;
-        case DEFIPATH_VIA:
-          viaLayer = technology->getLayer( path->getVia() );
-          if (not viaLayer) {
-            createViaInst = parser->lookupVia( path->getVia() );
-          } else {
-            createVia = true;
+        case DEFIPATH_VIA: {
+            const Layer* viaLayer = technology->getLayer( path->getVia() );
+            ViaDatas*    viaDatas = (viaLayer) ? NULL : parser->lookupVia( path->getVia() );
+            if (viaLayer or viaDatas)
+              parser->_paths.push_back( { DEFIPATH_VIA, viaLayer, viaDatas, width, x, y } );
           }
           break;
       }
-
-      if (createSegment) {
-        source = target;
-        target = Contact::create( hnet, layer, x, y );
-        if (source) {
-          if (source->getX() == x) {
-            Vertical::create( source, target, layer, x, width );
-          } else if (source->getY() == y) {
-            Horizontal::create( source, target, layer, y, width );
-          } else {
-            ostringstream message;
-            message << "Non-manhattan segment in net <" << hnet->getName() << ">.";
-            parser->pushError ( message.str() );
-          }
-        }
-      }
-      
-      if (createVia) {
-        if (target) {
-          target = Contact::create( target, viaLayer, 0, 0 );
-        } else {
-          target = Contact::create( hnet, viaLayer, x, y, 0, 0 );
-        }
-      }
-
-      if (createViaInst) {
-        target = parser->createVia( path->getVia(), hnet, x, y );
-      }
     }
+    parser->_paths.push_back( { DEFIPATH_DONE, NULL, NULL, 0, 0, 0 } );
 
     return 0;
   }
@@ -960,7 +1124,7 @@ namespace CRL {
 
   Cell* DefImport::load ( string design, unsigned int flags )
   {
-    UpdateSession::open ();
+    UpdateSession::open( (flags & BulkLoad) ? UpdateSession::Bulk : UpdateSession::NoFlags );
 
     Cell* cell = NULL;
 #if defined(HAVE_LEFDEF)
@@ -974,7 +1138,7 @@ namespace CRL {
          << endl;
 #endif
 
-    UpdateSession::close ();
+    UpdateSession::close();
 
     return cell;
   }
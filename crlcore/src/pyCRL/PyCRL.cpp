@@ -233,6 +233,7 @@ extern "C" {
     PyGds_postModuleInit ();
     PyLefImport_postModuleInit ();
     PyDefExport_postModuleInit ();
+    PyDefImport_postModuleInit ();
     
   //PyObject* dictionnary = PyModule_GetDict ( module );
   //DbULoadConstants ( dictionnary );
@@ -92,7 +92,7 @@ extern "C" {
 
   PyMethodDef PyDefImport_Methods[] =
     { { "load"                , (PyCFunction)PyDefImport_load     , METH_VARARGS|METH_STATIC
-                              , "Load a complete Cadence LEF library." }
+                              , "Load a DEF design (flags: FitAbOnCells, BulkLoad)." }
     , { "reset"               , (PyCFunction)PyDefImport_reset    , METH_NOARGS|METH_STATIC
                               , "Reset the Cadence LEF parser (clear technology)." }
   //, { "destroy"             , (PyCFunction)PyDefImport_destroy  , METH_VARARGS
@@ -116,6 +116,14 @@ extern "C" {
   PyTypeObjectDefinitionsOfModule(CRL,DefImport)
 
 
+  extern  void  PyDefImport_postModuleInit ()
+  {
+    PyObject* constant;
+    LoadObjectConstant(PyTypeDefImport.tp_dict,DefImport::FitAbOnCells,"FitAbOnCells");
+    LoadObjectConstant(PyTypeDefImport.tp_dict,DefImport::BulkLoad    ,"BulkLoad");
+  }
+
+
 #endif  // End of Shared Library Code Part.
 
 }  // extern "C".
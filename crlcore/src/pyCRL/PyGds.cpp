@@ -63,11 +63,12 @@ extern "C" {
   static PyObject* PyGds_save ( PyObject*, PyObject* args )
   {
     cdebug_log(30,0) << "PyGds_save()" << endl;
+    uint32_t  flags = 0;
     HTRY
       PyObject* pyCell = NULL;
-      if (PyArg_ParseTuple( args, "O:Gds.save", &pyCell )) {
+      if (PyArg_ParseTuple( args, "O|I:Gds.save", &pyCell, &flags )) {
         if (IsPyCell(pyCell)) {
-          Gds::save( PYCELL_O(pyCell) );
+          Gds::save( PYCELL_O(pyCell), flags );
         } else {
           PyErr_SetString( ConstructorError, "Gds.save(): Bad parameter type (not a Cell)." );
           return NULL;
@@ -157,6 +158,8 @@ extern "C" {
     LoadObjectConstant(PyTypeGds.tp_dict,Gds::NoBlockages       ,"NoBlockages");
     LoadObjectConstant(PyTypeGds.tp_dict,Gds::LefForeign        ,"LefForeign");
     LoadObjectConstant(PyTypeGds.tp_dict,Gds::Layer_0_IsBoundary,"Layer_0_IsBoundary");
+    LoadObjectConstant(PyTypeGds.tp_dict,Gds::Deduplicate       ,"Deduplicate");
+    LoadObjectConstant(PyTypeGds.tp_dict,Gds::GzipOutput        ,"GzipOutput");
   }
 
 
@@ -306,7 +306,7 @@ namespace Etesian {
     , _placementLB  (NULL)
     , _placementUB  (NULL)
     , _instsToIds   ()
-    , _idsToInsts   ()
+    , _flatNetlist  ()
     , _viewer       (NULL)
     , _diodeCell    (NULL)
     , _feedCells    (this)
@@ -442,11 +442,9 @@ namespace Etesian {
     delete _placementLB;
     delete _placementUB;
 
-    InstancesToIds emptyInstsToIds;
-    _instsToIds.swap( emptyInstsToIds );
+    _instsToIds.clear();
 
-    vector<InstanceInfos> emptyIdsToInsts;
-    _idsToInsts.swap( emptyIdsToInsts );
+    _flatNetlist.clear();
 
     _surface       = NULL;
     _circuit       = NULL;
@@ -764,10 +762,16 @@ namespace Etesian {
                                         , (int)(topAb.getYMax() / vpitch)
                                         );
 
+  // The hierarchy is walked only once, the occurrences and their bloated
+  // abutment boxes are kept for the translation pass.
+    vector<Occurrence> leafOccurrences;
+    vector<Box>        leafAbs;
     for ( Occurrence occurrence : getCell()->getTerminalNetlistInstanceOccurrences(getBlockInstance()) ) {
       ++instancesNb;
       Instance* instance   = static_cast<Instance*>(occurrence.getEntity());
       Box       instanceAb = _bloatCells.getAb( occurrence );
+      leafOccurrences.push_back( occurrence );
+      leafAbs        .push_back( instanceAb );
       string    masterName = getString( instance->getMasterCell()->getName() );
       DbU::Unit length = (instanceAb.getHeight() / sliceHeight) * instanceAb.getWidth();
       if (af->isRegister(masterName)) {
@@ -842,6 +846,25 @@ namespace Etesian {
   //getCell()->flattenNets( getBlockInstance(), Cell::Flags::NoClockFlatten );
     getCell()->flattenNets( NULL, _excludedNets, Cell::Flags::NoClockFlatten );
 
+    vector<Net*> routableNets;
+    for ( Net* net : getCell()->getNetRange() )
+    {
+      const char* excludedType = NULL;
+      if (net->getType() == Net::Type::POWER )   excludedType = "POWER";
+      if (net->getType() == Net::Type::GROUND)   excludedType = "GROUND";
+      if (net->getType() == Net::Type::CLOCK )   excludedType = "CLOCK";
+      if (isExcluded(getString(net->getName()))) excludedType = "USER_EXCLUDED";
+      if (excludedType) {
+        cparanoid << Warning( "%s is not a routable net (%s,excluded)."
+                            , getString(net).c_str(), excludedType ) << endl;
+        continue;
+      }
+      if (af->isBLOCKAGE(net->getName())) continue;
+
+      routableNets.push_back( net );
+    }
+    _flatNetlist.reserve( instancesNb+1, routableNets.size() );
+
     int instanceId       = 0;
     if (getBlockInstance()) {
       // Translate the fixed instances
@@ -864,8 +887,8 @@ namespace Etesian {
             cellIsFixed[instanceId] = true;
             cellIsObstruction[instanceId] = true;
 
-            _instsToIds.insert( make_pair(instance,instanceId) );
-            _idsToInsts.push_back( make_tuple(instance,vector<RoutingPad*>()) );
+            _instsToIds[ Path(instance) ] = instanceId;
+            _flatNetlist.addCell( Occurrence(instance), FlatNetlist::Fixed|FlatNetlist::TopLevel );
             ++instanceId;
             dots.dot();
           }
@@ -873,25 +896,30 @@ namespace Etesian {
       }
     }
 
-    // Translate the placeable instances
-    for ( Occurrence occurrence : getCell()->getTerminalNetlistInstanceOccurrences(getBlockInstance()) )
+    // Translate the placeable instances. The leaves are grouped under a
+    // few paths, their transformation is computed only once per path.
+    PathIdVector<Transformation> pathTransfs;
+    for ( size_t ileaf=0 ; ileaf<leafOccurrences.size() ; ++ileaf )
     {
       if (instanceId >= (int) instancesNb) {
         // This will be an error
         ++instanceId;
         continue;
       }
+      const Occurrence& occurrence = leafOccurrences[ileaf];
       _checkNotAFeed(occurrence);
 
       Instance* instance     = static_cast<Instance*>(occurrence.getEntity());
       Cell*     masterCell   = instance->getMasterCell();
 
       stdCellSizes.addSample( (float)(masterCell->getAbutmentBox().getWidth() / hpitch), 0 );
-      Box instanceAb = _bloatCells.getAb( occurrence );
+      Box instanceAb = leafAbs[ileaf];
       stdCellSizes.addSample( (float)(instanceAb.getWidth() / hpitch), 1 );
 
+      Path path = occurrence.getPath();
+      if (not pathTransfs.has(path)) pathTransfs[ path ] = path.getTransformation();
       Transformation instanceTransf = instance->getTransformation();
-      occurrence.getPath().getTransformation().applyOn( instanceTransf );
+      pathTransfs.get( path ).applyOn( instanceTransf );
       instanceTransf.applyOn( instanceAb );
 
       // Upper rounded
@@ -916,16 +944,18 @@ namespace Etesian {
         cellRowPolarity[instanceId] = CellRowPolarity::NW;
       }
 
+      uint32_t cellFlags = FlatNetlist::NoFlags;
       if ( not instance->isFixed() and instance->isTerminalNetlist() ) {
         cellIsFixed[instanceId] = false;
         cellIsObstruction[instanceId] = false;
       } else {
         cellIsFixed[instanceId] = true;
         cellIsObstruction[instanceId] = true;
+        cellFlags = FlatNetlist::Fixed;
       }
 
-      _instsToIds.insert( make_pair(instance,instanceId) );
-      _idsToInsts.push_back( make_tuple(instance,vector<RoutingPad*>()) );
+      _instsToIds[ Path(occurrence.getPath(),instance) ] = instanceId;
+      _flatNetlist.addCell( occurrence, cellFlags );
       ++instanceId;
       dots.dot();
     }
@@ -944,26 +974,9 @@ namespace Etesian {
     cellHeight[instanceId] = 0;
     cellIsFixed[instanceId] = true;
     cellIsObstruction[instanceId] = true;
+    _flatNetlist.addCell( Occurrence(), FlatNetlist::Fixed|FlatNetlist::TopLevel );
 
     dots.finish( Dots::Reset|Dots::FirstDot );
-
-    size_t netsNb = 0;
-    for ( Net* net : getCell()->getNets() )
-    {
-      const char* excludedType = NULL;
-      if (net->getType() == Net::Type::POWER )   excludedType = "POWER";
-      if (net->getType() == Net::Type::GROUND)   excludedType = "GROUND";
-      if (net->getType() == Net::Type::CLOCK )   excludedType = "CLOCK";
-      if (isExcluded(getString(net->getName()))) excludedType = "USER_EXCLUDED";
-      if (excludedType) {
-        cparanoid << Warning( "%s is not a routable net (%s,excluded)."
-                            , getString(net).c_str(), excludedType ) << endl;
-        continue;
-      }
-      if (af->isBLOCKAGE(net->getName())) continue;
-
-      ++netsNb;
-    }
     _circuit->setCellX(cellX);
     _circuit->setCellY(cellY);
     _circuit->setCellOrientation(orient);
@@ -973,24 +986,14 @@ namespace Etesian {
     _circuit->setCellIsObstruction(cellIsObstruction);
     _circuit->setCellRowPolarity(cellRowPolarity);
 
-    cmess1 << "     - Converting " << netsNb << " nets" << endl;
+    cmess1 << "     - Converting " << routableNets.size() << " nets" << endl;
 
-    for ( Net* net : getCell()->getNets() )
+    for ( Net* net : routableNets )
     {
-      const char* excludedType = NULL;
-      if (net->getType() == Net::Type::POWER )   excludedType = "POWER";
-      if (net->getType() == Net::Type::GROUND)   excludedType = "GROUND";
-      if (net->getType() == Net::Type::CLOCK )   excludedType = "CLOCK";
-      if (isExcluded(getString(net->getName()))) excludedType = "USER_EXCLUDED";
-      if (excludedType) continue;
-      if (af->isBLOCKAGE(net->getName())) continue;
-
       dots.dot();
-      
-      string topCellInstancePin = getString(getCell()->getName()) + ":C";
-      vector<int> netCells, pinX, pinY;
+      _flatNetlist.addNet( net );
 
-      for ( RoutingPad* rp : net->getRoutingPads() ) {
+      for ( RoutingPad* rp : net->getRoutingPadRange() ) {
         Path path = rp->getOccurrence().getPath();
         Pin* pin  = dynamic_cast<Pin*>( rp->getOccurrence().getEntity() ); 
         if (pin) {
@@ -999,9 +1002,7 @@ namespace Etesian {
             int xpin = pt.getX() / hpitch;
             int ypin = pt.getY() / vpitch;
           // Dummy last instance
-            pinX.push_back(xpin);
-            pinY.push_back(ypin);
-            netCells.push_back(instanceId);
+            _flatNetlist.addPin( instanceId, xpin, ypin );
           }
           continue;
         }
@@ -1029,21 +1030,34 @@ namespace Etesian {
         int xpin    = offset.getX() / hpitch;
         int ypin    = offset.getY() / vpitch;
 
-        auto  iid = _instsToIds.find( instance );
-        if (iid == _instsToIds.end()) {
+      // The RoutingPad path is the one of it's instance occurrence.
+        if (not _instsToIds.has(path)) {
           if (not instance) {
             string    insName  = extractInstanceName( rp );
             cerr << Error( "Unable to lookup instance \"%s\".", insName.c_str() ) << endl;
           }
         } else {
-          pinX.push_back(xpin);
-          pinY.push_back(ypin);
-          netCells.push_back((*iid).second);
+          _flatNetlist.addPin( _instsToIds.get(path), xpin, ypin );
         }
       }
-      _circuit->addNet(netCells, pinX, pinY);
     }
     dots.finish( Dots::Reset );
+    _flatNetlist.freeze();
+
+  // Coloquinte wants one vector per net, the buffers are reused so no
+  // allocation occurs once they have grown to the biggest net.
+    vector<int> netCells, pinX, pinY;
+    const vector<int>& pinCells = _flatNetlist.getPinCells();
+    const vector<int>& pinXs    = _flatNetlist.getPinXs();
+    const vector<int>& pinYs    = _flatNetlist.getPinYs();
+    for ( uint32_t inet=0 ; inet<_flatNetlist.getNetsSize() ; ++inet ) {
+      uint32_t begin = _flatNetlist.getNetPinsBegin( inet );
+      uint32_t end   = _flatNetlist.getNetPinsEnd  ( inet );
+      netCells.assign( pinCells.begin()+begin, pinCells.begin()+end );
+      pinX    .assign( pinXs   .begin()+begin, pinXs   .begin()+end );
+      pinY    .assign( pinYs   .begin()+begin, pinYs   .begin()+end );
+      _circuit->addNet( netCells, pinX, pinY );
+    }
 
     cmess1 << "     - Standard cells widths:" << endl;
     cmess2 << stdCellSizes.toString(0) << endl;
@@ -1214,63 +1228,72 @@ namespace Etesian {
 
   void  EtesianEngine::_updatePlacement ( const coloquinte::PlacementSolution* placement, uint32_t flags )
   {
-    UpdateSession::open();
+    UpdateSession::open( UpdateSession::Bulk );
 
     Transformation topTransformation;
     if (getBlockInstance()) topTransformation = getBlockInstance()->getTransformation();
     topTransformation.invert();
 
-    DbU::Unit diodeWidth = (_diodeCell) ? _diodeCell->getAbutmentBox().getWidth() : 0;
-    vector< tuple<RoutingPad*,Transformation> > diodeInsts;
+    DbU::Unit hpitch      = getSliceHStep();
+    DbU::Unit vpitch      = getSliceVStep();
+    DbU::Unit sliceHeight = getSliceHeight();
 
-    for ( Occurrence occurrence : getCell()->getTerminalNetlistInstanceOccurrences(getBlockInstance()) )
-    {
-      DbU::Unit hpitch          = getSliceHStep();
-      DbU::Unit vpitch          = getSliceVStep();
-      DbU::Unit sliceHeight     = getSliceHeight();
-      Point     instancePosition;
-      Instance* instance        = static_cast<Instance*>(occurrence.getEntity());
-      string    instanceName    = occurrence.getCompactString();
-    // Remove the enclosing brackets...
-    //instanceName.erase( 0, 1 );
-    //instanceName.erase( instanceName.size()-1 );
-
-      auto iid = _instsToIds.find( instance );
-      if (iid == _instsToIds.end() ) {
-        cerr << Error( "Unable to lookup instance <%s>.", instanceName.c_str() ) << endl;
-      } else {
-        if (instance->getPlacementStatus() == Instance::PlacementStatus::FIXED) {
-          auto ab = instance->getAbutmentBox();
-          if ( ab.getXMin() % hpitch ) {
-            cerr << Error( "Instance <%s> fixed placed out of the hpitch.", instanceName.c_str() ) << endl;
-          }
-          if ( ab.getYMin() % sliceHeight ) {
-            cerr << Error( "Instance <%s> fixed placed out of the slice height.", instanceName.c_str() ) << endl;
-          }
+  // 1. Lookup the instances with their Coloquinte ids. While it is valid, the
+  //    flat netlist built by toColoquinte() already holds the occurrences in
+  //    Coloquinte order, no hierarchy walk nor id lookup is needed.
+    vector< pair<Occurrence,size_t> > placeds;
+    if (_flatNetlist.isValid()) {
+      placeds.reserve( _flatNetlist.getCellsSize() );
+      for ( uint32_t icell=0 ; icell<_flatNetlist.getCellsSize() ; ++icell ) {
+        if (_flatNetlist.getCellFlags(icell) & FlatNetlist::TopLevel) continue;
+        placeds.push_back( make_pair(_flatNetlist.getOccurrence(icell),icell) );
+      }
+    } else {
+      for ( Occurrence occurrence : getCell()->getTerminalNetlistInstanceOccurrences(getBlockInstance()) ) {
+        Path instancePath ( occurrence.getPath(), static_cast<Instance*>(occurrence.getEntity()) );
+        if (not _instsToIds.has(instancePath)) {
+          cerr << Error( "Unable to lookup instance <%s>.", occurrence.getCompactString().c_str() ) << endl;
           continue;
         }
-      //uint32_t       outputSide = getOutputSide( instance->getMasterCell() );
-        auto place = (*placement)[(*iid).second];
-        Transformation cellTrans  = toTransformation( place.position
-                                                    , place.orientation
-                                                    , instance->getMasterCell()
-                                                    , hpitch
-                                                    , vpitch
-                                                    );
-        topTransformation.applyOn( cellTrans );
-
-      // This is temporary as it's not trans-hierarchic: we ignore the positions
-      // of all the intermediary instances.
-        instance->setTransformation( cellTrans );
-        instance->setPlacementStatus( Instance::PlacementStatus::PLACED );
-        if (flags & CheckOngrid) {
-          auto ab = instance->getAbutmentBox();
-          if ( ab.getXMin() % hpitch ) {
-            cerr << Error( "Instance <%s> placed out of the hpitch.", instanceName.c_str() ) << endl;
-          }
-          if ( ab.getYMin() % sliceHeight ) {
-            cerr << Error( "Instance <%s> placed out of the slice height.", instanceName.c_str() ) << endl;
-          }
+        placeds.push_back( make_pair(occurrence,_instsToIds.get(instancePath)) );
+      }
+    }
+
+  // 2. Compute the transformations & update the Hurricane database (the fixed
+  //    instances are only checked).
+    for ( const auto& placed : placeds ) {
+      Instance* instance = static_cast<Instance*>( placed.first.getEntity() );
+
+      if (instance->getPlacementStatus() == Instance::PlacementStatus::FIXED) {
+        auto ab = instance->getAbutmentBox();
+        if ( ab.getXMin() % hpitch ) {
+          cerr << Error( "Instance <%s> fixed placed out of the hpitch.", placed.first.getCompactString().c_str() ) << endl;
+        }
+        if ( ab.getYMin() % sliceHeight ) {
+          cerr << Error( "Instance <%s> fixed placed out of the slice height.", placed.first.getCompactString().c_str() ) << endl;
+        }
+        continue;
+      }
+
+    // This is temporary as it's not trans-hierarchic: we ignore the positions
+    // of all the intermediary instances.
+      auto           place = (*placement)[ placed.second ];
+      Transformation trans = toTransformation( place.position
+                                             , place.orientation
+                                             , instance->getMasterCell()
+                                             , hpitch
+                                             , vpitch
+                                             );
+      topTransformation.applyOn( trans );
+      instance->setTransformation( trans );
+      instance->setPlacementStatus( Instance::PlacementStatus::PLACED );
+      if (flags & CheckOngrid) {
+        auto ab = instance->getAbutmentBox();
+        if ( ab.getXMin() % hpitch ) {
+          cerr << Error( "Instance <%s> placed out of the hpitch.", placed.first.getCompactString().c_str() ) << endl;
+        }
+        if ( ab.getYMin() % sliceHeight ) {
+          cerr << Error( "Instance <%s> placed out of the slice height.", placed.first.getCompactString().c_str() ) << endl;
         }
       }
     }
@@ -1284,6 +1307,7 @@ namespace Etesian {
   Instance* EtesianEngine::_createDiode ( Cell* owner )
   {
     if (not _diodeCell) return NULL;
+    _flatNetlist.invalidate();
     return Instance::create( owner, getUniqueDiodeName(), _diodeCell );
   }
 
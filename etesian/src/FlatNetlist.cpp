@@ -0,0 +1,107 @@
+// -*- C++ -*-
+//
+// This file is part of the Coriolis Software.
+// Copyright (c) Sorbonne Université 2024-2024, All Rights Reserved
+//
+// +-----------------------------------------------------------------+
+// |                   C O R I O L I S                               |
+// |   E t e s i a n  -  A n a l y t i c   P l a c e r               |
+// |                                                                 |
+// |  Author      :                    Jean-Paul CHAPUT              |
+// |  E-mail      :            Jean-Paul.Chaput@lip6.fr              |
+// | =============================================================== |
+// |  C++ Module  :       "./FlatNetlist.cpp"                        |
+// +-----------------------------------------------------------------+
+
+
+#include "hurricane/Instance.h"
+#include "etesian/FlatNetlist.h"
+
+
+namespace Etesian {
+
+  using std::vector;
+
+
+// -------------------------------------------------------------------
+// Class  :  "Etesian::FlatNetlist".
+
+
+  FlatNetlist::FlatNetlist ()
+    : _cells     ()
+    , _cellFlags ()
+    , _nets      ()
+    , _netStarts ()
+    , _pinCells  ()
+    , _pinXs     ()
+    , _pinYs     ()
+    , _cellStarts()
+    , _cellPins  ()
+    , _valid     (false)
+  { }
+
+
+  void  FlatNetlist::clear ()
+  {
+  // Swap with empties to really give back the memory.
+    vector<Occurrence>().swap( _cells );
+    vector<uint32_t>  ().swap( _cellFlags );
+    vector<Net*>      ().swap( _nets );
+    vector<uint32_t>  ().swap( _netStarts );
+    vector<int>       ().swap( _pinCells );
+    vector<int>       ().swap( _pinXs );
+    vector<int>       ().swap( _pinYs );
+    vector<uint32_t>  ().swap( _cellStarts );
+    vector<uint32_t>  ().swap( _cellPins );
+    _valid = false;
+  }
+
+
+  void  FlatNetlist::reserve ( size_t cells, size_t nets )
+  {
+    _cells    .reserve( cells );
+    _cellFlags.reserve( cells );
+    _nets     .reserve( nets );
+    _netStarts.reserve( nets );
+  // Standard cells netlists average a little under four pins per net.
+    _pinCells .reserve( 4*nets );
+    _pinXs    .reserve( 4*nets );
+    _pinYs    .reserve( 4*nets );
+  }
+
+
+  uint32_t  FlatNetlist::addCell ( const Occurrence& occurrence, uint32_t flags )
+  {
+    _valid = false;
+    _cells    .push_back( occurrence );
+    _cellFlags.push_back( flags );
+    return _cells.size() - 1;
+  }
+
+
+  uint32_t  FlatNetlist::addNet ( Net* net )
+  {
+    _valid = false;
+    _nets     .push_back( net );
+    _netStarts.push_back( _pinCells.size() );
+    return _nets.size() - 1;
+  }
+
+
+  void  FlatNetlist::freeze ()
+  {
+  // Build the cell -> pins CSR by counting sort over the net -> pins one.
+    _cellStarts.assign( _cells.size()+1, 0 );
+    for ( int cell : _pinCells ) ++_cellStarts[ cell+1 ];
+    for ( size_t i=1 ; i<_cellStarts.size() ; ++i ) _cellStarts[i] += _cellStarts[i-1];
+
+    vector<uint32_t> fill ( _cellStarts.begin(), _cellStarts.end()-1 );
+    _cellPins.resize( _pinCells.size() );
+    for ( size_t pin=0 ; pin<_pinCells.size() ; ++pin )
+      _cellPins[ fill[_pinCells[pin]]++ ] = pin;
+
+    _valid = true;
+  }
+
+
+}  // Etesian namespace.
@@ -489,11 +489,11 @@ namespace Etesian {
     }
     
     vector< tuple<Net*,uint32_t> > netDatas;
-    for ( Net* net : getCell()->getNets() ) {
+    for ( Net* net : getCell()->getNetRange() ) {
       if (isExcluded(getString(net->getName()))) continue;
       
       uint32_t rpCount = 0;
-      for ( RoutingPad* rp : net->getRoutingPads() ) {
+      for ( RoutingPad* rp : net->getRoutingPadRange() ) {
         Occurrence rpOcc = rp->getPlugOccurrence();
         Pin*       pin   = dynamic_cast<Pin*>( rpOcc.getEntity() ); 
         if (pin) {
@@ -543,6 +543,7 @@ namespace Etesian {
     // }
     Go::enableAutoMaterialization();
     UpdateSession::close();
+    if (_bufferCount) _flatNetlist.invalidate();
   //DebugSession::close();
 
     stopMeasures();
@@ -1019,9 +1019,23 @@ namespace Etesian {
       }
     }
 
-    for ( Occurrence occurrence : getBlockCell()->getTerminalNetlistInstanceOccurrences() )
+  // Reuse the flat netlist of the last conversion to Coloquinte when it is
+  // still around, otherwise walk the hierarchy of the block.
+    vector<Occurrence> cellOccurrences;
+    if (_flatNetlist.isValid()) {
+      cellOccurrences.reserve( _flatNetlist.getCellsSize() );
+      for ( uint32_t icell=0 ; icell<_flatNetlist.getCellsSize() ; ++icell ) {
+        if (_flatNetlist.getCellFlags(icell) & FlatNetlist::TopLevel) continue;
+        cellOccurrences.push_back( _flatNetlist.getOccurrence(icell) );
+      }
+    } else {
+      for ( Occurrence occurrence : getBlockCell()->getTerminalNetlistInstanceOccurrences() )
+        cellOccurrences.push_back( toCell(occurrence) );
+    }
+
+    for ( const Occurrence& cellOccurrence : cellOccurrences )
     {
-      Instance* instance     = static_cast<Instance*>( occurrence.getEntity() );
+      Instance* instance     = static_cast<Instance*>( cellOccurrence.getEntity() );
       Cell*     masterCell   = instance->getMasterCell();
 
       if (CatalogExtension::isFeed(masterCell)) {
@@ -1030,7 +1044,6 @@ namespace Etesian {
       }
 
       Box instanceAb = instance->getAbutmentBox();
-      Occurrence cellOccurrence = toCell( occurrence );
       cellOccurrence.getPath().getTransformation().applyOn( instanceAb );
 
       if (not topPlaceArea.intersect(instanceAb)) {
@@ -1082,6 +1095,7 @@ namespace Etesian {
       }
     }
     _area->addFeeds();
+    _flatNetlist.invalidate();
 
     UpdateSession::close();
   //DebugSession::close();
@@ -22,6 +22,7 @@
 
 #include "hurricane/Timer.h"
 #include "hurricane/Name.h"
+#include "hurricane/PathIdVector.h"
 namespace Hurricane {
   class Layer;
   class Net;
@@ -37,6 +38,7 @@ namespace Hurricane {
 #include "etesian/FeedCells.h"
 #include "etesian/BufferCells.h"
 #include "etesian/BloatCells.h"
+#include "etesian/FlatNetlist.h"
 #include "etesian/Placement.h"
 
 
@@ -51,6 +53,7 @@ namespace Etesian {
   using Hurricane::Cell;
   using Hurricane::Record;
   using Hurricane::Instance;
+  using Hurricane::PathIdVector;
   using Hurricane::Point;
   using Hurricane::Path;
   using Hurricane::Transformation;
@@ -70,8 +73,7 @@ namespace Etesian {
     public:
       typedef ToolEngine  Super;
       typedef std::tuple<Net*,int32_t,uint32_t>                NetInfos;
-      typedef std::tuple<Instance*, std::vector<RoutingPad*> > InstanceInfos;
-      typedef std::map<Instance*,size_t,DBo::CompareById>      InstancesToIds;
+      typedef PathIdVector<size_t>                             InstancesToIds;
       typedef std::set<std::string>                            NetNameSet;
     public:
       static  const Name&             staticGetName             ();
@@ -101,6 +103,7 @@ namespace Etesian {
       inline  DbU::Unit               getLatchUpDistance        () const;
       inline  const FeedCells&        getFeedCells              () const;
       inline  const BufferCells&      getBufferCells            () const;
+      inline  const FlatNetlist&      getFlatNetlist            () const;
       inline  Cell*                   getDiodeCell              () const;
               std::string             getUniqueDiodeName        ();
       inline  const Box&              getPlaceArea              () const;
@@ -163,7 +166,7 @@ namespace Etesian {
              coloquinte::PlacementSolution*       _placementLB;
              coloquinte::PlacementSolution*        _placementUB;
              InstancesToIds                       _instsToIds;
-             std::vector<InstanceInfos>           _idsToInsts;
+             FlatNetlist                          _flatNetlist;
              Hurricane::CellViewer*               _viewer;
              Cell*                                _diodeCell;
              FeedCells                            _feedCells;
@@ -223,6 +226,7 @@ namespace Etesian {
   inline  void                   EtesianEngine::useFeed                   ( Cell* cell ) { _feedCells.useFeed(cell); }
   inline  const FeedCells&       EtesianEngine::getFeedCells              () const { return _feedCells; }
   inline  const BufferCells&     EtesianEngine::getBufferCells            () const { return _bufferCells; }
+  inline  const FlatNetlist&     EtesianEngine::getFlatNetlist            () const { return _flatNetlist; }
   inline  Cell*                  EtesianEngine::getDiodeCell              () const { return _diodeCell; }
   inline  void                   EtesianEngine::selectBloat               ( std::string profile ) { _bloatCells.select(profile); }
                                                                           
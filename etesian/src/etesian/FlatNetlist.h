@@ -0,0 +1,120 @@
+// -*- C++ -*-
+//
+// This file is part of the Coriolis Software.
+// Copyright (c) Sorbonne Université 2024-2024, All Rights Reserved
+//
+// +-----------------------------------------------------------------+
+// |                   C O R I O L I S                               |
+// |   E t e s i a n  -  A n a l y t i c   P l a c e r               |
+// |                                                                 |
+// |  Author      :                    Jean-Paul CHAPUT              |
+// |  E-mail      :            Jean-Paul.Chaput@lip6.fr              |
+// | =============================================================== |
+// |  C++ Header  :  "./etesian/FlatNetlist.h"                       |
+// +-----------------------------------------------------------------+
+
+
+#pragma  once
+#include <cstdint>
+#include <vector>
+#include "hurricane/Occurrence.h"
+namespace Hurricane {
+  class Net;
+  class Instance;
+}
+
+
+namespace Etesian {
+
+  using Hurricane::Occurrence;
+  using Hurricane::Net;
+  using Hurricane::Instance;
+
+
+// -------------------------------------------------------------------
+// Class  :  "Etesian::FlatNetlist".
+//
+// Flattened view of the netlist as seen by the placer, built once
+// by EtesianEngine::toColoquinte(). Cells are numbered in the order
+// given to Coloquinte, pins are stored in CSR form, both from the
+// nets (net -> pins) and from the cells (cell -> pins). Terminal
+// pins of the top cell are bound to the last (dummy) cell id.
+
+  class FlatNetlist {
+    public:
+      static const uint32_t  NoFlags  = 0;
+      static const uint32_t  Fixed    = (1 << 0);
+      static const uint32_t  TopLevel = (1 << 1);
+    public:
+                                      FlatNetlist     ();
+             void                     clear           ();
+             void                     reserve         ( size_t cells, size_t nets );
+      inline void                     invalidate      ();
+      inline bool                     isValid         () const;
+      inline size_t                   getCellsSize    () const;
+      inline size_t                   getNetsSize     () const;
+      inline size_t                   getPinsSize     () const;
+      inline const Occurrence&        getOccurrence   ( uint32_t cell ) const;
+      inline Instance*                getInstance     ( uint32_t cell ) const;
+      inline uint32_t                 getCellFlags    ( uint32_t cell ) const;
+      inline Net*                     getNet          ( uint32_t net ) const;
+      inline uint32_t                 getNetPinsBegin ( uint32_t net ) const;
+      inline uint32_t                 getNetPinsEnd   ( uint32_t net ) const;
+      inline uint32_t                 getCellPinsBegin( uint32_t cell ) const;
+      inline uint32_t                 getCellPinsEnd  ( uint32_t cell ) const;
+      inline uint32_t                 getCellPin      ( uint32_t index ) const;
+      inline uint32_t                 getPinCell      ( uint32_t pin ) const;
+      inline int                      getPinX         ( uint32_t pin ) const;
+      inline int                      getPinY         ( uint32_t pin ) const;
+      inline const std::vector<int>&  getPinCells     () const;
+      inline const std::vector<int>&  getPinXs        () const;
+      inline const std::vector<int>&  getPinYs        () const;
+             uint32_t                 addCell         ( const Occurrence&, uint32_t flags );
+             uint32_t                 addNet          ( Net* );
+      inline void                     addPin          ( uint32_t cell, int x, int y );
+             void                     freeze          ();
+    private:
+      std::vector<Occurrence>  _cells;
+      std::vector<uint32_t>    _cellFlags;
+      std::vector<Net*>        _nets;
+      std::vector<uint32_t>    _netStarts;
+      std::vector<int>         _pinCells;
+      std::vector<int>         _pinXs;
+      std::vector<int>         _pinYs;
+      std::vector<uint32_t>    _cellStarts;
+      std::vector<uint32_t>    _cellPins;
+      bool                     _valid;
+  };
+
+
+  inline bool                    FlatNetlist::isValid          () const { return _valid; }
+  inline void                    FlatNetlist::invalidate       () { _valid = false; }
+  inline size_t                  FlatNetlist::getCellsSize     () const { return _cells.size(); }
+  inline size_t                  FlatNetlist::getNetsSize      () const { return _nets.size(); }
+  inline size_t                  FlatNetlist::getPinsSize      () const { return _pinCells.size(); }
+  inline const Occurrence&       FlatNetlist::getOccurrence    ( uint32_t cell ) const { return _cells[cell]; }
+  inline Instance*               FlatNetlist::getInstance      ( uint32_t cell ) const { return static_cast<Instance*>( _cells[cell].getEntity() ); }
+  inline uint32_t                FlatNetlist::getCellFlags     ( uint32_t cell ) const { return _cellFlags[cell]; }
+  inline Net*                    FlatNetlist::getNet           ( uint32_t net ) const { return _nets[net]; }
+  inline uint32_t                FlatNetlist::getNetPinsBegin  ( uint32_t net ) const { return _netStarts[net]; }
+  inline uint32_t                FlatNetlist::getNetPinsEnd    ( uint32_t net ) const { return (net+1 < _netStarts.size()) ? _netStarts[net+1] : _pinCells.size(); }
+  inline uint32_t                FlatNetlist::getCellPinsBegin ( uint32_t cell ) const { return _cellStarts[cell]; }
+  inline uint32_t                FlatNetlist::getCellPinsEnd   ( uint32_t cell ) const { return _cellStarts[cell+1]; }
+  inline uint32_t                FlatNetlist::getCellPin       ( uint32_t index ) const { return _cellPins[index]; }
+  inline uint32_t                FlatNetlist::getPinCell       ( uint32_t pin ) const { return _pinCells[pin]; }
+  inline int                     FlatNetlist::getPinX          ( uint32_t pin ) const { return _pinXs[pin]; }
+  inline int                     FlatNetlist::getPinY          ( uint32_t pin ) const { return _pinYs[pin]; }
+  inline const std::vector<int>& FlatNetlist::getPinCells      () const { return _pinCells; }
+  inline const std::vector<int>& FlatNetlist::getPinXs         () const { return _pinXs; }
+  inline const std::vector<int>& FlatNetlist::getPinYs         () const { return _pinYs; }
+
+
+  inline void  FlatNetlist::addPin ( uint32_t cell, int x, int y )
+  {
+    _pinCells.push_back( cell );
+    _pinXs   .push_back( x );
+    _pinYs   .push_back( y );
+  }
+
+
+}  // Etesian namespace.
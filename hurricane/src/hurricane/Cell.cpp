@@ -38,6 +38,8 @@
 #include "hurricane/Slice.h"
 #include "hurricane/Rubber.h"
 #include "hurricane/Marker.h"
+#include "hurricane/HyperNetIndex.h"
+#include "hurricane/Snapshot.h"
 #include "hurricane/Component.h"
 #include "hurricane/UpdateSession.h"
 #include "hurricane/Error.h"
@@ -548,6 +550,7 @@ Cell::Cell(Library* library, const Name& name)
     _nextOfSymbolCellSet(NULL),
     _slaveEntityMap(),
     _observers(),
+    _hyperNetIndex(NULL),
     _flags(Flags::NoFlags)
 {
   if (!_library)
@@ -558,6 +561,10 @@ Cell::Cell(Library* library, const Name& name)
 
   if (_library->getCell(_name))
     throw Error("Can't create " + _TName("Cell") + " " + getString(_name) + " : already exists");
+
+#ifdef HURRICANE_RTREE_INDEX
+  setRTreeIndex(true);
+#endif
 }
 
 Cell* Cell::create(Library* library, const Name& name)
@@ -570,6 +577,25 @@ Cell* Cell::create(Library* library, const Name& name)
     return cell;
 }
 
+void Cell::setRTreeIndex(bool state)
+// *********************************
+{
+  _flags.set(Flags::RTreeIndex,state);
+  _quadTree->setRTree(state);
+  for ( Slice* slice : getSlices() ) slice->_getQuadTree()->setRTree(state);
+}
+
+void Cell::setHyperNetIndex(bool state)
+// ************************************
+{
+  if (state == isHyperNetIndexed()) return;
+  if (state) _hyperNetIndex = new HyperNetIndex( this );
+  else {
+    delete _hyperNetIndex;
+    _hyperNetIndex = NULL;
+  }
+}
+
 Cell* Cell::fromJson(const string& filename)
 // *****************************************
 {
@@ -590,13 +616,15 @@ Box Cell::getBoundingBox() const
 // *****************************
 {
     if (_boundingBox.isEmpty()) {
-        Box& boundingBox = (Box&)_boundingBox;
-        boundingBox = _abutmentBox;
+        Box boundingBox = _abutmentBox;
         boundingBox.merge(_quadTree->getBoundingBox());
         for_each_slice(slice, getSlices()) {
             boundingBox.merge(slice->getBoundingBox());
             end_for;
         }
+    // Shared between threads, do not cache.
+        if (DataBase::isFrozen()) return boundingBox;
+        (Box&)_boundingBox = boundingBox;
     }
     
     return _boundingBox;
@@ -830,6 +858,12 @@ void Cell::flattenNets ( const Instance* instance, const std::set<string>& exclu
 
   _flags |= Flags::FlattenedNets;
 
+// All the hyper nets are walked, build the flattened connectivity once
+// instead of walking the hierarchy for each of them. Only new DeepNets
+// and RoutingPads are created, the index stays valid all along.
+  bool indexed = isHyperNetIndexed();
+  if (not indexed) setHyperNetIndex( true );
+
   vector<HyperNet>  hyperNets;
   vector<HyperNet>  topHyperNets;
 
@@ -912,6 +946,8 @@ void Cell::flattenNets ( const Instance* instance, const std::set<string>& exclu
     DebugSession::close();
   }
 
+  if (not indexed) setHyperNetIndex( false );
+
   cdebug_log(18,0) << "Before closing UpdateSession" << endl;
   UpdateSession::close();
   cdebug_log(18,-1) << "Cell::flattenNets() Done" << endl;
@@ -1117,6 +1153,7 @@ void Cell::uniquify(unsigned int depth)
 void Cell::materialize()
 // *********************
 {
+  Snapshot::complete( this );
   if (_flags.isset(Flags::Materialized)) return;
 
   cdebug_log(18,1) << "Cell::materialize() " << this << endl;
@@ -1215,6 +1252,8 @@ void Cell::_preDestroy()
 // ********************
 {
   notify( Flags::CellDestroyed );
+  setHyperNetIndex( false );
+  Snapshot::forget( this );
 
   while ( _slaveEntityMap.size() ) {
     _slaveEntityMap.begin()->second->destroy();
@@ -1275,6 +1314,7 @@ Record* Cell::_getRecord() const
         record->add( getSlot("_slaveEntityMap" , &_slaveEntityMap  ) );
         record->add( getSlot("_abutmentBox"    , &_abutmentBox     ) );
         record->add( getSlot("_boundingBox"    , &_boundingBox     ) );
+        record->add( getSlot("_hyperNetIndex"  ,  _hyperNetIndex   ) );
         record->add( getSlot("_flags"          , &_flags           ) );
     }
     return record;
@@ -1407,6 +1447,7 @@ void Cell::_toJsonCollections(JsonWriter* writer) const
     if (_flags & FlattenedNets   ) { if (s.size() > 1) s += "|"; s += "FlattenedNets"; }
     if (_flags & Placed          ) { if (s.size() > 1) s += "|"; s += "Placed"; }
     if (_flags & Routed          ) { if (s.size() > 1) s += "|"; s += "Routed"; }
+    if (_flags & RTreeIndex      ) { if (s.size() > 1) s += "|"; s += "RTreeIndex"; }
     if (_flags & AbstractedSupply) { if (s.size() > 1) s += "|"; s += "AbstractedSupply"; }
     if (_flags & SlavedAb        ) { if (s.size() > 1) s += "|"; s += "SlavedAb"; }
     if (_flags & Materialized    ) { if (s.size() > 1) s += "|"; s += "Materialized"; }
@@ -99,11 +99,11 @@ namespace Hurricane {
   void  CellsSort::_computeDepth ( Cell* cell )
   {
     size_t         depth           = 0;
-    DepthProperty* parentDepthProp = dynamic_cast<DepthProperty*>( cell->getProperty( DepthProperty::staticGetName() ));
+    DepthProperty* parentDepthProp = Property::cast<DepthProperty>( cell->getProperty( DepthProperty::staticGetName() ));
 
     for ( Instance* instance : cell->getInstances() ) {
       Cell*          masterCell     = instance->getMasterCell();
-      DepthProperty* childDepthProp = dynamic_cast<DepthProperty*>( masterCell->getProperty(DepthProperty::staticGetName()) );
+      DepthProperty* childDepthProp = Property::cast<DepthProperty>( masterCell->getProperty(DepthProperty::staticGetName()) );
 
       if (not childDepthProp) continue;
       if (childDepthProp->getValue() == 0) {
@@ -398,6 +398,18 @@ void Component::materialize()
   }
 }
 
+QuadTree* Component::_getMaterializationQuadTree()
+// ***********************************************
+{
+  Cell*        cell  = getCell();
+  const Layer* layer = getLayer();
+  if (not cell or not layer) return NULL;
+
+  Slice* slice = cell->getSlice(layer);
+  if (!slice) slice = Slice::_create(cell, layer);
+  return slice->_getQuadTree();
+}
+
 void Component::unmaterialize()
 // ****************************
 {
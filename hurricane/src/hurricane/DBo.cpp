@@ -32,6 +32,7 @@
 #include "hurricane/Initializer.h"
 #include "hurricane/Timer.h"
 #include "hurricane/DBo.h"
+#include "hurricane/DataBase.h"
 #include "hurricane/Entity.h"
 #include "hurricane/Property.h"
 #include "hurricane/Quark.h"
@@ -133,6 +134,8 @@ namespace Hurricane {
     : _id         (getNextId())
     , _propertySet()
   {
+    if (DataBase::isFrozen())
+      throw Error( "DBo::DBo(): Cannot create an object while the DataBase is frozen." );
     if (_idCounterLimit and (_id > _idCounterLimit)) {
       throw Error( "DBo::DBo(): Identifier counter has reached user's limit (%d)."
                  , _idCounterLimit );
@@ -181,6 +184,9 @@ namespace Hurricane {
 
   void DBo::destroy ()
   {
+    if (DataBase::isFrozen())
+      throw Error( "DBo::destroy(): Cannot destroy %s while the DataBase is frozen."
+                 , getString(this).c_str() );
     cdebug_log(0,1) << "DBo::destroy() " << getId() << " " << this << endl;
     _preDestroy();
     cdebug_tabw(0,-1);
@@ -188,21 +194,9 @@ namespace Hurricane {
   }
 
 
-  Property* DBo::getProperty ( const Name& name ) const
-  {
-    set<Property*>::const_iterator iterator = _propertySet.begin();
-    while ( iterator != _propertySet.end() ) {
-      Property* property = *iterator;
-      if (property->getName() == name) return property;
-      ++iterator;
-    }
-    return NULL;
-  }
-
-
   Properties  DBo::getProperties () const
   {
-    return getCollection(_propertySet);
+    return _propertySet.getCollection();
   }
 
 
@@ -228,7 +222,7 @@ namespace Hurricane {
         _propertySet.erase ( oldProperty );
         oldProperty->onReleasedBy ( this );
       }
-      _propertySet.insert ( property );
+      _propertySet.push_back ( property );
       property->onCapturedBy ( this );
     }
   }
@@ -239,8 +233,7 @@ namespace Hurricane {
     if ( !property )
       throw Error("DBo::remove(): Can't remove property : NULL property.");
 
-    if ( _propertySet.find(property) != _propertySet.end() ) {
-      _propertySet.erase ( property );
+    if ( _propertySet.erase(property) ) {
       property->onReleasedBy ( this );
       if ( dynamic_cast<Quark*>(this) && _propertySet.empty() )
         destroy();
@@ -262,8 +255,7 @@ namespace Hurricane {
 
   void  DBo::_onDestroyed ( Property* property )
   {
-    if ( property && ( _propertySet.find(property) != _propertySet.end() ) ) {
-      _propertySet.erase ( property );
+    if ( property && _propertySet.erase(property) ) {
       if ( dynamic_cast<Quark*>(this) && _propertySet.empty() )
         destroy();
     }
@@ -273,8 +265,8 @@ namespace Hurricane {
   void  DBo::clearProperties ()
   {
     while ( !_propertySet.empty() ) {
-      Property* property = *_propertySet.begin();
-      _propertySet.erase ( property );
+      Property* property = _propertySet.back();
+      _propertySet.pop_back ();
       property->onReleasedBy ( this );
     }
   }
@@ -29,6 +29,11 @@
 #include "hurricane/Technology.h"
 #include "hurricane/Library.h"
 #include "hurricane/CellsSort.h"
+#include "hurricane/Cell.h"
+#include "hurricane/Slice.h"
+#include "hurricane/ExtensionSlice.h"
+#include "hurricane/QuadTree.h"
+#include "hurricane/HyperNetIndex.h"
 
 
 namespace {
@@ -116,13 +121,15 @@ namespace Hurricane {
 // ****************************************************************************************************
 
 DataBase* DataBase::_db = NULL;
+bool      DataBase::_frozen = false;
 
 
 DataBase::DataBase()
 // *****************
 :    Inherit(),
     _technology(NULL),
-    _rootLibrary(NULL)
+    _rootLibrary(NULL),
+    _sharedNameConcurrent(false)
 {
     if (_db)
         throw Error("Can't create " + _TName("DataBase") + " : already exists");
@@ -193,6 +200,55 @@ DataBase* DataBase::getDB()
     return _db;
 }
 
+// Frozen mode: the database becomes read-only, so it can be accessed
+// by several threads at once (Query, collections, Path & Occurrence
+// building and properties lookup). The lazily computed data is forced
+// here (Cell & QuadTree bounding boxes, packed R-trees, HyperNet
+// indexes), the Name and SharedPath creation are switched to their
+// concurrent modes. Creating or destroying a DBo, or opening an
+// UpdateSession, throws an Error until unfreeze(). Both functions
+// must be called while only one thread is running.
+void DataBase::freeze()
+// ********************
+{
+    if (_frozen) return;
+    if (UpdateSession::getStackSize())
+        throw Error("DataBase::freeze(): Cannot freeze while an UpdateSession is open.");
+
+    QuadTree::buildRTrees();
+    vector<Library*> libraries;
+    if (_rootLibrary) libraries.push_back(_rootLibrary);
+    while (!libraries.empty()) {
+        Library* library = libraries.back();
+        libraries.pop_back();
+        for (Library* child : library->getLibraries()) libraries.push_back(child);
+        for (Cell* cell : library->getCells()) {
+            cell->_getQuadTree()->_updateBoundingBoxes();
+            for (Slice* slice : cell->getSlices())
+                slice->_getQuadTree()->_updateBoundingBoxes();
+            for (ExtensionSlice* slice : cell->getExtensionSlices())
+                slice->_getQuadTree()->_updateBoundingBoxes();
+            cell->getBoundingBox();
+            if (cell->isHyperNetIndexed() && !cell->getHyperNetIndex()->isUpToDate())
+                cell->getHyperNetIndex()->update();
+        }
+    }
+
+    _sharedNameConcurrent = SharedName::isConcurrent();
+    SharedName::setConcurrent(true);
+    SharedPath::setConcurrent(true);
+    _frozen = true;
+}
+
+void DataBase::unfreeze()
+// **********************
+{
+    if (!_frozen) return;
+    _frozen = false;
+    SharedPath::setConcurrent(false);
+    SharedName::setConcurrent(_sharedNameConcurrent);
+}
+
 Library* DataBase::getLibrary(string rpath, unsigned int flags)
 // ************************************************************
 {
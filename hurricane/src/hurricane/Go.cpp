@@ -59,6 +59,12 @@ void Go::disableAutoMaterialization()
     AUTO_MATERIALIZATION_IS_ENABLED = false;
 }
 
+QuadTree* Go::_getMaterializationQuadTree()
+// ****************************************
+{
+    return NULL;
+}
+
 void Go::_postCreate()
 // *******************
 {
@@ -23,6 +23,7 @@
 #include "hurricane/Instance.h"
 #include "hurricane/Rubber.h"
 #include "hurricane/Plug.h"
+#include "hurricane/HyperNetIndex.h"
 #include "hurricane/BasicLayer.h"
 #include "hurricane/Error.h"
 
@@ -330,6 +331,17 @@ class HyperNet_ComponentOccurrences : public Collection<Occurrence> {
 // HyperNet implementation
 // ****************************************************************************************************
 
+static HyperNetIndex* getHyperNetIndex(const Occurrence& netOccurrence, uint32_t& id)
+// **********************************************************************************
+// Returns the connectivity index of the owner cell, if any, when it knows the net occurrence.
+{
+    if (not netOccurrence.isValid()) return NULL;
+    HyperNetIndex* index = netOccurrence.getOwnerCell()->getHyperNetIndex();
+    if (not index) return NULL;
+    id = index->getHyperNetId(netOccurrence);
+    return (id != HyperNetIndex::NoId) ? index : NULL;
+}
+
 HyperNet::HyperNet(const Occurrence& occurrence)
 // *********************************************
   : _netOccurrence(occurrence.getNetOccurrence())
@@ -349,6 +361,11 @@ HyperNet::HyperNet(const HyperNet& other)
 Occurrences HyperNet::getNetOccurrences(bool doExtraction, bool allowInterruption) const
 // ***********************************************************************************
 {
+    if (not doExtraction) {
+        uint32_t       id    = HyperNetIndex::NoId;
+        HyperNetIndex* index = getHyperNetIndex(_netOccurrence, id);
+        if (index) return index->getNetOccurrences(id);
+    }
     return HyperNet_NetOccurrences(this, doExtraction, allowInterruption);
 }
 
@@ -361,6 +378,11 @@ Occurrences HyperNet::getNetOccurrencesUnder(Box area, bool doExtraction, bool a
 Occurrences HyperNet::getTerminalNetlistPlugOccurrences(bool doExtraction, bool allowInterruption) const
 // ********************************************************************************************
 {
+    if (not doExtraction) {
+        uint32_t       id    = HyperNetIndex::NoId;
+        HyperNetIndex* index = getHyperNetIndex(_netOccurrence, id);
+        if (index) return index->getTerminalNetlistPlugOccurrences(id);
+    }
     return HyperNet_TerminalNetlistPlugOccurrences(this, doExtraction, allowInterruption);
 }
 
@@ -0,0 +1,527 @@
+// -*- C++ -*-
+//
+// Copyright (c) Sorbonne Université 2024-2024, All Rights Reserved
+//
+// This file is part of Hurricane.
+//
+// Hurricane is free software: you can redistribute it  and/or  modify
+// it under the terms of the GNU  Lesser  General  Public  License  as
+// published by the Free Software Foundation, either version 3 of  the
+// License, or (at your option) any later version.
+//
+// Hurricane is distributed in the hope that it will  be  useful,  but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHAN-
+// TABILITY or FITNESS FOR A PARTICULAR PURPOSE. See  the  Lesser  GNU
+// General Public License for more details.
+//
+// You should have received a copy of the Lesser  GNU  General  Public
+// License along with Hurricane. If not, see
+//                                     <http://www.gnu.org/licenses/>.
+//
+// +-----------------------------------------------------------------+
+// |                  H U R R I C A N E                              |
+// |     V L S I   B a c k e n d   D a t a - B a s e                 |
+// |                                                                 |
+// |  Author      :                    Jean-Paul Chaput              |
+// |  E-mail      :            Jean-Paul.Chaput@lip6.fr              |
+// | =============================================================== |
+// |  C++ Module  :  "./HyperNetIndex.cpp"                           |
+// +-----------------------------------------------------------------+
+
+
+#include <algorithm>
+#include "hurricane/Error.h"
+#include "hurricane/Cell.h"
+#include "hurricane/Net.h"
+#include "hurricane/Instance.h"
+#include "hurricane/Plug.h"
+#include "hurricane/HyperNetIndex.h"
+
+
+namespace Hurricane {
+
+  using std::string;
+  using std::vector;
+  using std::pair;
+  using std::make_pair;
+  using std::unordered_set;
+
+
+// -------------------------------------------------------------------
+// Class  :  "Hurricane::HyperNetIndex::Slice".
+
+
+  Occurrence  HyperNetIndex::Slice::Locator::getElement () const
+  { return (_current != _end) ? *_current : Occurrence(); }
+
+
+  Locator<Occurrence>* HyperNetIndex::Slice::Locator::getClone () const
+  { return new Locator( _current, _end ); }
+
+
+  bool  HyperNetIndex::Slice::Locator::isValid () const
+  { return (_current != _end); }
+
+
+  void  HyperNetIndex::Slice::Locator::progress ()
+  { if (_current != _end) ++_current; }
+
+
+  string  HyperNetIndex::Slice::Locator::_getString () const
+  { return "<HyperNetIndex::Slice::Locator " + getString(_end - _current) + ">"; }
+
+
+  Collection<Occurrence>* HyperNetIndex::Slice::getClone () const
+  { return new Slice( _begin, _end ); }
+
+
+  Locator<Occurrence>* HyperNetIndex::Slice::getLocator () const
+  { return new Locator( _begin, _end ); }
+
+
+  unsigned  HyperNetIndex::Slice::getSize () const
+  { return _end - _begin; }
+
+
+  string  HyperNetIndex::Slice::_getString () const
+  { return "<HyperNetIndex::Slice " + getString(getSize()) + ">"; }
+
+
+// -------------------------------------------------------------------
+// Class  :  "Hurricane::HyperNetIndex::CellWatch".
+
+
+  void  HyperNetIndex::CellWatch::notify ( unsigned int flags )
+  {
+    if (flags & Cell::Flags::CellDestroyed)
+      _index->invalidate();
+    else if (flags & Cell::Flags::NetlistChanged)
+      _index->_onEvent( _cell, _event, _eventEntity );
+
+  // The Cell owning the index deletes it *after* this notification,
+  // the watch must then still be detached from it.
+    if ((flags & Cell::Flags::CellDestroyed) and (_cell != _index->getCell()))
+      _cell = NULL;
+  }
+
+
+// -------------------------------------------------------------------
+// Class  :  "Hurricane::HyperNetIndex".
+
+
+  HyperNetIndex::Event  HyperNetIndex::_event       = HyperNetIndex::NoEvent;
+  Entity*               HyperNetIndex::_eventEntity = NULL;
+
+
+  void  HyperNetIndex::notify ( Cell* cell, Event event, Entity* entity )
+  {
+  // The Cell observers only get flags, the details of the event are
+  // given aside to the watches. Events may be nested (Net::merge()).
+    Event   previousEvent  = _event;
+    Entity* previousEntity = _eventEntity;
+    _event       = event;
+    _eventEntity = entity;
+    cell->notify( Cell::Flags::NetlistChanged );
+    _event       = previousEvent;
+    _eventEntity = previousEntity;
+  }
+
+
+  HyperNetIndex::HyperNetIndex ( Cell* cell )
+    : _cell           (cell)
+    , _watches        ()
+    , _cellPaths      ()
+    , _netIds         ()
+    , _netOccurrences ()
+    , _plugOccurrences()
+    , _ranges         ()
+    , _seeds          ()
+    , _garbage        (0)
+    , _valid          (false)
+  {
+    if (not _cell)
+      throw Error( "HyperNetIndex::HyperNetIndex(): NULL Cell argument." );
+    _watch( _cell );
+  }
+
+
+  HyperNetIndex::~HyperNetIndex ()
+  {
+    for ( auto item : _watches ) {
+      if (item.second->getCell()) item.second->getCell()->removeObserver( item.second );
+      delete item.second;
+    }
+  }
+
+
+  void  HyperNetIndex::_watch ( Cell* cell )
+  {
+    if (_watches.find(cell) != _watches.end()) return;
+    CellWatch* watch = new CellWatch( this, cell );
+    _watches.insert( make_pair(cell,watch) );
+    cell->addObserver( watch );
+  }
+
+
+  void  HyperNetIndex::_clear ()
+  {
+    _cellPaths      .clear();
+    _netIds         .clear();
+    _netOccurrences .clear();
+    _plugOccurrences.clear();
+    _ranges         .clear();
+    _seeds          .clear();
+    _garbage = 0;
+    _valid   = false;
+  }
+
+
+  void  HyperNetIndex::update ()
+  {
+    if (not _valid) _rebuild();
+    if (_seeds.empty()) return;
+
+  // Dead slices are only reclaimed by a full rebuild.
+    if (_garbage > _netOccurrences.size()/2) {
+      _rebuild();
+      return;
+    }
+
+    cdebug_log(18,1) << "HyperNetIndex::update() " << _cell << " " << _seeds.size() << " seeds." << endl;
+    vector<Occurrence> seeds ( _seeds.begin(), _seeds.end() );
+    _seeds.clear();
+    size_t hyperNets = _ranges.size();
+    for ( const Occurrence& seed : seeds ) {
+      if (_netIds.find(seed) == _netIds.end()) _flood( seed );
+    }
+    cdebug_log(18,0) << "Flooded " << (_ranges.size() - hyperNets) << " hyper nets." << endl;
+    cdebug_tabw(18,-1);
+  }
+
+
+  void  HyperNetIndex::_rebuild ()
+  {
+    cdebug_log(18,1) << "HyperNetIndex::_rebuild() " << _cell << endl;
+    _clear();
+
+  // Watches on destroyed Cells are no longer attached, and their
+  // address may have been reused by a new Cell.
+    for ( auto iwatch=_watches.begin() ; iwatch!=_watches.end() ; ) {
+      if (iwatch->second->getCell()) { ++iwatch; continue; }
+      delete iwatch->second;
+      iwatch = _watches.erase( iwatch );
+    }
+
+    vector<Occurrence>                nodes;
+    vector<uint32_t>                  parents;
+    vector< pair<uint32_t,Occurrence> > plugs;
+
+    auto addNode = [&]( Net* net, const Path& path ) -> uint32_t
+      {
+        auto inserted = _netIds.insert( make_pair(Occurrence(net,path),(uint32_t)nodes.size()) );
+        if (inserted.second) {
+          nodes  .push_back( inserted.first->first );
+          parents.push_back( inserted.first->second );
+        }
+        return inserted.first->second;
+      };
+
+  // Union-find with path halving, the root of a class is always it's
+  // smallest node, that is, the first one met during the walk.
+    auto findRoot = [&]( uint32_t node ) -> uint32_t
+      {
+        while ( parents[node] != node ) {
+          parents[node] = parents[ parents[node] ];
+          node = parents[node];
+        }
+        return node;
+      };
+
+    auto unite = [&]( uint32_t node1, uint32_t node2 )
+      {
+        node1 = findRoot( node1 );
+        node2 = findRoot( node2 );
+        if (node1 == node2) return;
+        if (node1 < node2) parents[node2] = node1;
+        else               parents[node1] = node2;
+      };
+
+    vector< pair<Cell*,Path> > stack;
+    stack.push_back( make_pair(_cell,Path()) );
+    while ( not stack.empty() ) {
+      Cell* cell = stack.back().first;
+      Path  path = stack.back().second;
+      stack.pop_back();
+
+      _watch( cell );
+      _cellPaths[ cell ].push_back( path );
+      for ( Net* net : cell->getNets() ) addNode( net, path );
+      if (cell->isTerminalNetlist()) continue;
+
+      for ( Instance* instance : cell->getInstances() ) {
+        Cell* master     = instance->getMasterCell();
+        bool  isTerminal = master->isTerminalNetlist();
+        Path  childPath  = Path( path, instance );
+
+        for ( Plug* plug : instance->getPlugs() ) {
+          uint32_t node = addNode( plug->getMasterNet(), childPath );
+          if (isTerminal) plugs.push_back( make_pair(node,Occurrence(plug,path)) );
+          if (plug->getNet()) unite( node, addNode(plug->getNet(),path) );
+        }
+        if (not isTerminal) stack.push_back( make_pair(master,childPath) );
+        else {
+        // Terminal masters are watched too, for their external nets.
+          _watch( master );
+          _cellPaths[ master ].push_back( childPath );
+        }
+      }
+    }
+
+  // Number the classes in walk order, then bucket (counting sort) the
+  // net and plug occurrences.
+    vector<uint32_t> classIds ( nodes.size(), NoId );
+    uint32_t         classes  = 0;
+    for ( uint32_t node=0 ; node<nodes.size() ; ++node ) {
+      uint32_t root = findRoot( node );
+      if (root == node) classIds[node] = classes++;
+      else              classIds[node] = classIds[root];
+    }
+
+    vector<uint32_t> netStarts  ( classes+1, 0 );
+    vector<uint32_t> plugStarts ( classes+1, 0 );
+    for ( uint32_t classId : classIds ) ++netStarts [ classId+1 ];
+    for ( auto&    plug    : plugs    ) ++plugStarts[ classIds[plug.first]+1 ];
+    for ( size_t i=1 ; i<=classes ; ++i ) {
+      netStarts [i] += netStarts [i-1];
+      plugStarts[i] += plugStarts[i-1];
+    }
+
+    _ranges.resize( classes );
+    for ( size_t i=0 ; i<classes ; ++i )
+      _ranges[i] = { netStarts[i], netStarts[i+1], plugStarts[i], plugStarts[i+1] };
+
+    vector<uint32_t> fill ( netStarts.begin(), netStarts.end()-1 );
+    _netOccurrences.resize( nodes.size() );
+    for ( uint32_t node=0 ; node<nodes.size() ; ++node )
+      _netOccurrences[ fill[classIds[node]]++ ] = nodes[node];
+
+    fill.assign( plugStarts.begin(), plugStarts.end()-1 );
+    _plugOccurrences.resize( plugs.size() );
+    for ( auto& plug : plugs )
+      _plugOccurrences[ fill[classIds[plug.first]]++ ] = plug.second;
+
+    for ( auto& item : _netIds ) item.second = classIds[ item.second ];
+
+    _valid = true;
+    cdebug_log(18,0) << "Indexed " << nodes.size() << " net occurrences in "
+                     << classes << " hyper nets." << endl;
+    cdebug_tabw(18,-1);
+  }
+
+
+  void  HyperNetIndex::_flood ( const Occurrence& seed )
+  {
+  // Same connectivity as the walk of _rebuild(), but followed from one
+  // net occurrence, downward through the plugs of the net and upward
+  // through the plug of the tail instance.
+    uint32_t           id    = _ranges.size();
+    Range              range = { (uint32_t)_netOccurrences.size(), 0, (uint32_t)_plugOccurrences.size(), 0 };
+    vector<Occurrence> stack;
+
+    auto push = [&]( Net* net, const Path& path )
+      {
+        Occurrence occurrence ( net, path );
+        if (_netIds.insert( make_pair(occurrence,id) ).second) stack.push_back( occurrence );
+      };
+
+    push( static_cast<Net*>(seed.getEntity()), seed.getPath() );
+    while ( not stack.empty() ) {
+      Occurrence occurrence = stack.back();
+      stack.pop_back();
+      _netOccurrences.push_back( occurrence );
+
+      Net*  net  = static_cast<Net*>( occurrence.getEntity() );
+      Path  path = occurrence.getPath();
+      Cell* cell = net->getCell();
+
+      if (not cell->isTerminalNetlist()) {
+        for ( Plug* plug : net->getPlugs() )
+          push( plug->getMasterNet(), Path(path,plug->getInstance()) );
+      }
+      if (net->isExternal() and not path.isEmpty()) {
+        Plug* plug = path.getTailInstance()->getPlug( net );
+        if (plug) {
+          Path headPath = path.getHeadPath();
+          if (cell->isTerminalNetlist()) _plugOccurrences.push_back( Occurrence(plug,headPath) );
+          if (plug->getNet()) push( plug->getNet(), headPath );
+        }
+      }
+    }
+
+    range.netEnd  = _netOccurrences .size();
+    range.plugEnd = _plugOccurrences.size();
+    _ranges.push_back( range );
+  }
+
+
+  void  HyperNetIndex::_kill ( const Occurrence& netOccurrence )
+  {
+  // The whole hyper net is dropped, it's net occurrences becoming seeds
+  // for the next update.
+    auto iid = _netIds.find( netOccurrence );
+    if (iid == _netIds.end()) return;
+
+    Range& range = _ranges[ iid->second ];
+    for ( uint32_t i=range.netBegin ; i<range.netEnd ; ++i ) {
+      _netIds.erase ( _netOccurrences[i] );
+      _seeds .insert( _netOccurrences[i] );
+    }
+    _garbage += range.netEnd - range.netBegin;
+    range = { 0, 0, 0, 0 };
+  }
+
+
+  void  HyperNetIndex::_getSubTree ( Cell* cell, const Path& path, vector< pair<Cell*,Path> >& subTree )
+  {
+    size_t i = subTree.size();
+    subTree.push_back( make_pair(cell,path) );
+    for ( ; i<subTree.size() ; ++i ) {
+      if (subTree[i].first->isTerminalNetlist()) continue;
+      Path parentPath = subTree[i].second;
+      for ( Instance* instance : subTree[i].first->getInstances() )
+        subTree.push_back( make_pair(instance->getMasterCell(),Path(parentPath,instance)) );
+    }
+  }
+
+
+  void  HyperNetIndex::_onEvent ( Cell* cell, Event event, Entity* entity )
+  {
+    if (not _valid) return;
+    if (event == NoEvent) {
+      cdebug_log(18,0) << "HyperNetIndex::_onEvent() " << cell << " full invalidation." << endl;
+      invalidate();
+      return;
+    }
+
+    auto ipaths = _cellPaths.find( cell );
+    if (ipaths == _cellPaths.end()) return;
+    vector<Path> paths = ipaths->second;
+
+    switch ( event ) {
+      case NetChanged: {
+        Net* net = static_cast<Net*>( entity );
+        for ( const Path& path : paths ) {
+          _kill( Occurrence(net,path) );
+          _seeds.insert( Occurrence(net,path) );
+        }
+        break;
+      }
+      case NetDestroyed: {
+        Net* net = static_cast<Net*>( entity );
+        for ( const Path& path : paths ) {
+          _kill( Occurrence(net,path) );
+          _seeds.erase( Occurrence(net,path) );
+        }
+        break;
+      }
+      case PlugChanged: {
+        Plug* plug = static_cast<Plug*>( entity );
+        for ( const Path& path : paths ) {
+          Occurrence masterNetOccurrence ( plug->getMasterNet(), Path(path,plug->getInstance()) );
+          _kill( masterNetOccurrence );
+          _seeds.insert( masterNetOccurrence );
+          if (plug->getNet()) {
+            _kill( Occurrence(plug->getNet(),path) );
+            _seeds.insert( Occurrence(plug->getNet(),path) );
+          }
+        }
+        break;
+      }
+      case InstanceCreated: {
+        Instance* instance = static_cast<Instance*>( entity );
+        vector< pair<Cell*,Path> > subTree;
+        for ( const Path& path : paths )
+          _getSubTree( instance->getMasterCell(), Path(path,instance), subTree );
+        for ( auto& item : subTree ) {
+          _watch( item.first );
+          _cellPaths[ item.first ].push_back( item.second );
+          bool isTerminal = item.first->isTerminalNetlist();
+          for ( Net* net : item.first->getNets() ) {
+            if (not isTerminal or net->isExternal())
+              _seeds.insert( Occurrence(net,item.second) );
+          }
+        }
+        break;
+      }
+      case InstanceDestroyed: {
+      // The paths going through the instance are about to be destroyed,
+      // nothing must be left referring to them.
+        Instance* instance = static_cast<Instance*>( entity );
+        vector< pair<Cell*,Path> > subTree;
+        for ( const Path& path : paths )
+          _getSubTree( instance->getMasterCell(), Path(path,instance), subTree );
+
+        unordered_set<uint32_t> removedIds;
+        for ( auto& item : subTree ) {
+          removedIds.insert( item.second.getId() );
+          for ( Net* net : item.first->getNets() ) _kill( Occurrence(net,item.second) );
+        }
+        for ( auto iseed=_seeds.begin() ; iseed!=_seeds.end() ; ) {
+          if (removedIds.count(iseed->getPathId())) iseed = _seeds.erase( iseed );
+          else ++iseed;
+        }
+        for ( auto& item : subTree ) {
+          auto icellPaths = _cellPaths.find( item.first );
+          if (icellPaths == _cellPaths.end()) continue;
+          vector<Path>& cellPaths = icellPaths->second;
+          cellPaths.erase( std::remove_if( cellPaths.begin(), cellPaths.end()
+                                         , [&]( const Path& path ) { return removedIds.count(path.getId()); } )
+                         , cellPaths.end() );
+        }
+        break;
+      }
+      default:
+        invalidate();
+    }
+  }
+
+
+  uint32_t  HyperNetIndex::getHyperNetId ( const Occurrence& netOccurrence )
+  {
+    if (not isUpToDate()) update();
+    auto iid = _netIds.find( netOccurrence );
+    return (iid != _netIds.end()) ? iid->second : NoId;
+  }
+
+
+  string  HyperNetIndex::_getTypeName () const
+  { return "HyperNetIndex"; }
+
+
+  string  HyperNetIndex::_getString () const
+  {
+    string s = "<" + _getTypeName() + " " + getString(_cell->getName());
+    if (_valid) s += " " + getString(getHyperNetsSize()) + " hyper nets";
+    else        s += " invalid";
+    s += ">";
+    return s;
+  }
+
+
+  Record* HyperNetIndex::_getRecord () const
+  {
+    Record* record = new Record ( _getString() );
+    record->add( getSlot("_cell"           , _cell                  ) );
+    record->add( getSlot("_valid"          , _valid                 ) );
+    record->add( getSlot("_watches"        , _watches.size()        ) );
+    record->add( getSlot("_cellPaths"      , _cellPaths.size()      ) );
+    record->add( getSlot("_netOccurrences" , _netOccurrences.size() ) );
+    record->add( getSlot("_plugOccurrences", _plugOccurrences.size()) );
+    record->add( getSlot("_ranges"         , _ranges.size()         ) );
+    record->add( getSlot("_seeds"          , _seeds.size()          ) );
+    record->add( getSlot("_garbage"        , _garbage               ) );
+    return record;
+  }
+
+
+}  // Hurricane namespace.
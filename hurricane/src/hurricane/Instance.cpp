@@ -26,6 +26,7 @@
 #include "hurricane/Net.h"
 #include "hurricane/Plug.h"
 #include "hurricane/SharedPath.h"
+#include "hurricane/HyperNetIndex.h"
 #include "hurricane/Error.h"
 
 namespace Hurricane {
@@ -380,6 +381,13 @@ void Instance::materialize()
   }
 }
 
+QuadTree* Instance::_getMaterializationQuadTree()
+// **********************************************
+{
+  if (getBoundingBox().isEmpty()) return NULL;
+  return _cell->_getQuadTree();
+}
+
 void Instance::unmaterialize()
 // ***************************
 {
@@ -488,6 +496,7 @@ void Instance::setMasterCell(Cell* masterCell, bool secureFlag)
     }
 
     invalidate(true);
+    _cell->notify(Cell::Flags::NetlistChanged);
 
     for_each_plug(plug, getUnconnectedPlugs()) {
       plug->_destroy();
@@ -613,11 +622,15 @@ void Instance::_postCreate()
     Inherit::_postCreate();
 
     if ( autoMaterialization ) enableAutoMaterialization();
+
+    HyperNetIndex::notify(_cell, HyperNetIndex::InstanceCreated, this);
 }
 
 void Instance::_preDestroy()
 // ************************
 {
+  HyperNetIndex::notify( _cell, HyperNetIndex::InstanceDestroyed, this );
+
   SharedPathes pathes = _getSharedPathes();
   while ( pathes.getFirst() ) delete pathes.getFirst();
 
@@ -17,6 +17,7 @@
 // not, see <http://www.gnu.org/licenses/>.
 // ****************************************************************************************************
 
+#include <cstring>
 #include "hurricane/Name.h"
 #include "hurricane/SharedName.h"
 
@@ -34,64 +35,26 @@ namespace Hurricane {
 
 Name::Name()
 // *********
-:  _sharedName(NULL)
-{
-    string s = "";
-    if (!SharedName::_SHARED_NAME_MAP)
-        _sharedName = new SharedName(s);
-    else {
-        SharedName::SharedNameMap::iterator iterator =
-            SharedName::_SHARED_NAME_MAP->find(&(string&)s);
-        if (iterator != SharedName::_SHARED_NAME_MAP->end())
-            _sharedName = (*iterator).second;
-        else
-            _sharedName = new SharedName(s);
-    }
-
-    assert(_sharedName);
-
-    _sharedName->capture();
+:  _sharedName(SharedName::_intern("", 0))
+{
 }
 
 Name::Name(const char* c)
 // **********************
-:  _sharedName(NULL)
-{
-    string s = c;
-    if (!SharedName::_SHARED_NAME_MAP)
-        _sharedName = new SharedName(s);
-    else {
-        SharedName::SharedNameMap::iterator iterator =
-            SharedName::_SHARED_NAME_MAP->find(&(string&)s);
-        if (iterator != SharedName::_SHARED_NAME_MAP->end())
-            _sharedName = (*iterator).second;
-        else
-            _sharedName = new SharedName(s);
-    }
-
-    assert(_sharedName);
+:  _sharedName(SharedName::_intern(c, strlen(c)))
+{
+}
 
-    _sharedName->capture();
+Name::Name(const char* c, size_t length)
+// *************************************
+:  _sharedName(SharedName::_intern(c, length))
+{
 }
 
 Name::Name(const string& s)
 // ************************
-:  _sharedName(NULL)
-{
-    if (!SharedName::_SHARED_NAME_MAP)
-        _sharedName = new SharedName(s);
-    else {
-        SharedName::SharedNameMap::iterator iterator =
-            SharedName::_SHARED_NAME_MAP->find(&(string&)s);
-        if (iterator != SharedName::_SHARED_NAME_MAP->end())
-            _sharedName = (*iterator).second;
-        else
-            _sharedName = new SharedName(s);
-    }
-
-    assert(_sharedName);
-
-    _sharedName->capture();
+:  _sharedName(SharedName::_intern(s.data(), s.size()))
+{
 }
 
 Name::Name(const Name& name)
@@ -119,18 +82,6 @@ Name& Name::operator=(const Name& name)
     return *this;
 }
 
-bool Name::operator==(const Name& name) const
-// ******************************************
-{
-    return (_sharedName == name._sharedName);
-}
-
-bool Name::operator!=(const Name& name) const
-// ******************************************
-{
-    return (_sharedName != name._sharedName);
-}
-
 bool Name::operator<(const Name& name) const
 // *****************************************
 {
@@ -33,6 +33,7 @@
 #include "hurricane/UpdateSession.h"
 #include "hurricane/NetExternalComponents.h"
 #include "hurricane/NetRoutingProperty.h"
+#include "hurricane/HyperNetIndex.h"
 
 namespace Hurricane {
 
@@ -663,6 +664,9 @@ void Net::merge ( Net* net )
                  , getString(getName()).c_str()
                  );
     
+    HyperNetIndex::notify( _cell, HyperNetIndex::NetChanged, this );
+    HyperNetIndex::notify( _cell, HyperNetIndex::NetChanged, net  );
+
     vector<Rubber*> rubbers;
     net->getRubbers().fill( rubbers );
     for ( Rubber* rubber : rubbers ) rubber->_setNet( this );
@@ -740,6 +744,7 @@ void Net::_preDestroy()
 // *******************
 {
   cdebug_log(18,1) << "entering Net::_preDestroy: " << this << endl;
+  HyperNetIndex::notify( _cell, HyperNetIndex::NetDestroyed, this );
   Inherit::_preDestroy();
 
   cdebug_log(18,0) << "Net::_preDestroy: " << this << " slave Plugs..." << endl;
@@ -118,12 +118,29 @@ bool Occurrence::operator<(const Occurrence& occurrence) const
   // if (_entity->getId() < occurrence._entity->getId()) return true;
   // if (_entity->getId() > occurrence._entity->getId()) return false;
 
-  return _sharedPath->getHash() < occurrence._sharedPath->getHash();
+  if (_sharedPath->getHash() != occurrence._sharedPath->getHash())
+    return _sharedPath->getHash() < occurrence._sharedPath->getHash();
+// Different paths may share the same hash.
+  return _sharedPath->getId() < occurrence._sharedPath->getId();
   
 //return ((_entity  < occurrence._entity) or 
 //       ((_entity == occurrence._entity) and (_sharedPath < occurrence._sharedPath)));
 }
 
+uint32_t Occurrence::getPathId() const
+// ***********************************
+{
+  return (_sharedPath) ? _sharedPath->getId() : 0;
+}
+
+size_t Occurrence::getHash() const
+// *******************************
+{
+// Entity & path identifiers are both dense 32 bits integers.
+  uint64_t key = ((uint64_t)((_entity) ? _entity->getId() : 0) << 32) | getPathId();
+  return std::hash<uint64_t>()( key * 0x9e3779b97f4a7c15ULL );
+}
+
 bool Occurrence::isBelowTerminalNetlist() const
 // ********************************************
 {
@@ -0,0 +1,254 @@
+// -*- C++ -*-
+//
+// Copyright (c) Sorbonne Université 2024-2024, All Rights Reserved
+//
+// This file is part of Hurricane.
+//
+// Hurricane is free software: you can redistribute it  and/or  modify
+// it under the terms of the GNU  Lesser  General  Public  License  as
+// published by the Free Software Foundation, either version 3 of  the
+// License, or (at your option) any later version.
+//
+// Hurricane is distributed in the hope that it will  be  useful,  but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHAN-
+// TABILITY or FITNESS FOR A PARTICULAR PURPOSE. See  the  Lesser  GNU
+// General Public License for more details.
+//
+// You should have received a copy of the Lesser  GNU  General  Public
+// License along with Hurricane. If not, see
+//                                     <http://www.gnu.org/licenses/>.
+//
+// +-----------------------------------------------------------------+
+// |                  H U R R I C A N E                              |
+// |     V L S I   B a c k e n d   D a t a - B a s e                 |
+// |                                                                 |
+// |  Author      :                    Jean-Paul Chaput              |
+// |  E-mail      :            Jean-Paul.Chaput@lip6.fr              |
+// | =============================================================== |
+// |  C++ Module  :  "./PackedRTree.cpp"                             |
+// +-----------------------------------------------------------------+
+
+
+#include <cmath>
+#include "hurricane/Go.h"
+#include "hurricane/Error.h"
+#include "hurricane/PackedRTree.h"
+
+
+namespace {
+
+  using namespace std;
+  using Hurricane::Box;
+  using Hurricane::DbU;
+  using Hurricane::Go;
+
+
+  struct Entry {
+    Box        _box;
+    DbU::Unit  _xcenter;
+    DbU::Unit  _ycenter;
+    Go*        _go;
+  };
+
+
+  struct CompareXCenter {
+    inline bool operator() ( const Entry& lhs, const Entry& rhs ) const
+    { return lhs._xcenter < rhs._xcenter; }
+  };
+
+
+  struct CompareYCenter {
+    inline bool operator() ( const Entry& lhs, const Entry& rhs ) const
+    { return lhs._ycenter < rhs._ycenter; }
+  };
+
+
+} // Anonymous namespace.
+
+
+namespace Hurricane {
+
+  using std::vector;
+
+
+// -------------------------------------------------------------------
+// Class  :  "Hurricane::PackedRTree".
+
+
+  PackedRTree::PackedRTree ()
+    : _boxes      ()
+    , _levelStarts()
+    , _items      ()
+    , _pendings   ()
+    , _indexes    ()
+    , _deads      (0)
+    , _valid      (false)
+  { }
+
+
+  void  PackedRTree::clear ()
+  {
+    _boxes      .clear();
+    _levelStarts.clear();
+    _items      .clear();
+    _pendings   .clear();
+    _indexes    .clear();
+    _deads = 0;
+    _valid = false;
+  }
+
+
+  void  PackedRTree::build ( vector<Go*>& gos )
+  {
+    clear();
+    if (gos.empty()) { _valid = true; return; }
+
+  // Sort-Tile-Recursive: sort by X center, cut into vertical slabs of
+  // S*Fanout entries, then sort each slab by Y center. Upper levels
+  // simply group consecutive nodes, which keeps the STR locality.
+    vector<Entry> entries ( gos.size() );
+    for ( size_t i=0 ; i<gos.size() ; ++i ) {
+      Box bb = gos[i]->getBoundingBox();
+      entries[i] = { bb, bb.getXCenter(), bb.getYCenter(), gos[i] };
+    }
+
+    size_t leafs     = (entries.size() + Fanout - 1) / Fanout;
+    size_t slabs     = (size_t)std::ceil( std::sqrt( (double)leafs ) );
+    size_t slabSize  = ((leafs + slabs - 1) / slabs) * Fanout;
+    std::sort( entries.begin(), entries.end(), CompareXCenter() );
+    for ( size_t start=0 ; start<entries.size() ; start+=slabSize ) {
+      size_t end = std::min( start+slabSize, entries.size() );
+      std::sort( entries.begin()+start, entries.begin()+end, CompareYCenter() );
+    }
+
+  // Count the nodes of all the levels to allocate only once.
+    size_t total = entries.size();
+    for ( size_t size=entries.size() ; size > 1 ; ) {
+      size   = (size + Fanout - 1) / Fanout;
+      total += size;
+    }
+    _boxes.reserve( total );
+    _items.reserve( entries.size() );
+    _indexes.reserve( entries.size() );
+    _levelStarts.push_back( 0 );
+    for ( const Entry& entry : entries ) {
+      _indexes.insert( std::make_pair( entry._go, _items.size() ));
+      _boxes.push_back( entry._box );
+      _items.push_back( entry._go );
+    }
+    _levelStarts.push_back( _boxes.size() );
+
+    while ( getLevelSize(getLevelsSize()-1) > 1 ) {
+      size_t childStart = _levelStarts[ _levelStarts.size()-2 ];
+      size_t childEnd   = _levelStarts[ _levelStarts.size()-1 ];
+      for ( size_t first=childStart ; first<childEnd ; first+=Fanout ) {
+        Box    bb;
+        size_t last = std::min( first+Fanout, childEnd );
+        for ( size_t i=first ; i<last ; ++i ) bb.merge( _boxes[i] );
+        _boxes.push_back( bb );
+      }
+      _levelStarts.push_back( _boxes.size() );
+    }
+    if (getLevelsSize() > MaxDepth)
+      throw Error( "PackedRTree::build(): Too many levels (%d) for %d Go."
+                 , (int)getLevelsSize(), (int)gos.size() );
+
+    _valid = true;
+  }
+
+
+  void  PackedRTree::remove ( Go* go )
+  {
+    if (not _valid) return;
+
+    auto iindex = _indexes.find( go );
+    if (iindex == _indexes.end()) return;
+    size_t index = (*iindex).second;
+    _indexes.erase( iindex );
+
+    if (index < _items.size()) {
+      _items[ index ] = NULL;
+      ++_deads;
+      return;
+    }
+
+  // A pending Go, replaced by the last one.
+    index -= _items.size();
+    Go* last = _pendings.back();
+    _pendings[ index ] = last;
+    _pendings.pop_back();
+    if (last != go) _indexes[ last ] = _items.size() + index;
+  }
+
+
+// -------------------------------------------------------------------
+// Class  :  "Hurricane::PackedRTree::Cursor".
+
+
+  PackedRTree::Cursor::Cursor ()
+    : _rtree    (NULL)
+    , _area     ()
+    , _threshold(0)
+    , _depth    (0)
+    , _pending  (0)
+    , _element  (NULL)
+  { }
+
+
+  PackedRTree::Cursor::Cursor ( const PackedRTree* rtree, const Box& area, DbU::Unit threshold )
+    : _rtree    (rtree)
+    , _area     (area)
+    , _threshold(threshold)
+    , _depth    (0)
+    , _pending  (0)
+    , _element  (NULL)
+  {
+    if (not _rtree or _area.isEmpty()) return;
+
+    size_t levels = _rtree->getLevelsSize();
+    if (levels) {
+      _stack[0]._level = levels-1;
+      _stack[0]._index = 0;
+      _stack[0]._end   = _rtree->getLevelSize( levels-1 );
+      _depth = 1;
+    }
+    progress();
+  }
+
+
+  void  PackedRTree::Cursor::progress ()
+  {
+    _element = NULL;
+    if (not _rtree) return;
+
+    while ( _depth ) {
+      Frame& frame = _stack[ _depth-1 ];
+      if (frame._index >= frame._end) { --_depth; continue; }
+
+      size_t   index = frame._index++;
+      uint32_t level = frame._level;
+      if (_prune( _rtree->getBox(level,index), level )) continue;
+
+      if (level == 0) {
+        _element = _rtree->_items[ index ];
+        if (_element) return;
+        continue;
+      }
+
+      Frame& child = _stack[ _depth++ ];
+      child._level = level - 1;
+      child._index = index * Fanout;
+      child._end   = std::min( child._index + Fanout, _rtree->getLevelSize(level-1) );
+    }
+
+    while ( _pending < _rtree->_pendings.size() ) {
+      Go* go = _rtree->_pendings[ _pending++ ];
+      if (not _prune(go->getBoundingBox(),0)) {
+        _element = go;
+        return;
+      }
+    }
+  }
+
+
+}  // Hurricane namespace.
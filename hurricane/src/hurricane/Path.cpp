@@ -41,6 +41,7 @@ Path::Path(Instance* instance)
 // ***************************
 :  _sharedPath(NULL)
 {
+    SharedPath::Guard guard;
     if (instance) {
         _sharedPath = instance->_getSharedPath(NULL);
         if (!_sharedPath) _sharedPath = new SharedPath(instance);
@@ -51,6 +52,7 @@ Path::Path(Instance* headInstance, const Path& tailPath)
 // *****************************************************
 :  _sharedPath(NULL)
 {
+    SharedPath::Guard guard;
     if (!headInstance)
         throw Error("Cant't create " + _TName("Path") + " : null head instance");
 
@@ -72,6 +74,7 @@ Path::Path(const Path& headPath, Instance* tailInstance)
 // *****************************************************
 :  _sharedPath(NULL)
 {
+    SharedPath::Guard guard;
     if (!tailInstance)
         throw Error("Cant't create " + _TName("Path") + " : null tail instance");
 
@@ -80,10 +83,14 @@ Path::Path(const Path& headPath, Instance* tailInstance)
         if (!_sharedPath) _sharedPath = new SharedPath(tailInstance);
     }
     else {
+        _sharedPath = SharedPath::_getChildSharedPath(headPath._getSharedPath(), tailInstance);
+        if (_sharedPath) return;
+
         Instance* headInstance = headPath.getHeadInstance();
         SharedPath* tailSharedPath = Path(headPath.getTailPath(), tailInstance)._getSharedPath();
         _sharedPath = headInstance->_getSharedPath(tailSharedPath);
         if (!_sharedPath) _sharedPath = new SharedPath(headInstance, tailSharedPath);
+        SharedPath::_setChildSharedPath(headPath._getSharedPath(), _sharedPath);
     }
 }
 
@@ -91,6 +98,7 @@ Path::Path(const Path& headPath, const Path& tailPath)
 // *****************************************************
 :  _sharedPath(tailPath._getSharedPath())
 {
+    SharedPath::Guard guard;
     vector<Instance*> instances;
     headPath.getInstances().fill(instances);
     
@@ -106,6 +114,7 @@ Path::Path(Cell* cell, const string& pathName)
 // *******************************************
 :  _sharedPath(NULL)
 {
+    SharedPath::Guard guard;
     if (cell) {
         list<Instance*> instanceList;
         string restOfPathName = pathName;
@@ -164,7 +173,15 @@ bool Path::operator!=(const Path& path) const
 bool Path::operator<(const Path& path) const
 // *****************************************
 {
-    return (_sharedPath < path._sharedPath);
+// Identifiers follow the creation order, so the ordering is stable
+// from one run to another (unlike the pointers).
+    return (getId() < path.getId());
+}
+
+uint32_t Path::getId() const
+// *************************
+{
+    return (_sharedPath) ? _sharedPath->getId() : 0;
 }
 
 Instance* Path::getHeadInstance() const
@@ -21,6 +21,7 @@
 #include "hurricane/Net.h"
 #include "hurricane/Cell.h"
 #include "hurricane/Instance.h"
+#include "hurricane/HyperNetIndex.h"
 #include "hurricane/Error.h"
 
 namespace Hurricane {
@@ -153,6 +154,7 @@ void Plug::setNet(Net* net)
       cdebug_log(18,0) << "Plug::setNet(): About to disconnect " << this << endl;
 
     _setNet( net );
+    HyperNetIndex::notify( getCell(), HyperNetIndex::PlugChanged, this );
   }
 }
 
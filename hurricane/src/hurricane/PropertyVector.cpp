@@ -0,0 +1,149 @@
+// -*- C++ -*-
+//
+// Copyright (c) Sorbonne Université 2024-2024, All Rights Reserved
+//
+// This file is part of Hurricane.
+//
+// Hurricane is free software: you can redistribute it  and/or  modify
+// it under the terms of the GNU  Lesser  General  Public  License  as
+// published by the Free Software Foundation, either version 3 of  the
+// License, or (at your option) any later version.
+//
+// Hurricane is distributed in the hope that it will  be  useful,  but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHAN-
+// TABILITY or FITNESS FOR A PARTICULAR PURPOSE. See  the  Lesser  GNU
+// General Public License for more details.
+//
+// You should have received a copy of the Lesser  GNU  General  Public
+// License along with Hurricane. If not, see
+//                                     <http://www.gnu.org/licenses/>.
+//
+// +-----------------------------------------------------------------+
+// |                  H U R R I C A N E                              |
+// |     V L S I   B a c k e n d   D a t a - B a s e                 |
+// |                                                                 |
+// |  Author      :                    Jean-Paul Chaput              |
+// |  E-mail      :            Jean-Paul.Chaput@lip6.fr              |
+// | =============================================================== |
+// |  C++ Module  :  "./PropertyVector.cpp"                          |
+// +-----------------------------------------------------------------+
+
+
+#include <cstring>
+#include "hurricane/Property.h"
+#include "hurricane/PropertyVector.h"
+
+
+namespace Hurricane {
+
+  using std::string;
+
+
+// -------------------------------------------------------------------
+// Class  :  "Hurricane::PropertyVector::Collection".
+
+
+  Property* PropertyVector::Collection::Locator::getElement () const
+  { return (_current != _end) ? _current->_property : NULL; }
+
+
+  Locator<Property*>* PropertyVector::Collection::Locator::getClone () const
+  { return new Locator( _current, _end ); }
+
+
+  bool  PropertyVector::Collection::Locator::isValid () const
+  { return (_current != _end); }
+
+
+  void  PropertyVector::Collection::Locator::progress ()
+  { if (_current != _end) ++_current; }
+
+
+  string  PropertyVector::Collection::Locator::_getString () const
+  { return "<PropertyVector::Collection::Locator " + getString(_end - _current) + ">"; }
+
+
+  Collection<Property*>* PropertyVector::Collection::getClone () const
+  { return new Collection( _begin, _end ); }
+
+
+  Locator<Property*>* PropertyVector::Collection::getLocator () const
+  { return new Locator( _begin, _end ); }
+
+
+  unsigned  PropertyVector::Collection::getSize () const
+  { return _end - _begin; }
+
+
+  string  PropertyVector::Collection::_getString () const
+  { return "<PropertyVector::Collection " + getString(getSize()) + ">"; }
+
+
+// -------------------------------------------------------------------
+// Class  :  "Hurricane::PropertyVector".
+
+
+  PropertyVector::~PropertyVector ()
+  {
+    while ( _size ) pop_back();
+    if (_capacity > InlineSize) delete [] _heap;
+  }
+
+
+  void  PropertyVector::push_back ( Property* property )
+  {
+    if (_size == _capacity) {
+      Entry* entries = new Entry [ 2*_capacity ];
+      std::memcpy( entries, _getEntries(), _size*sizeof(Entry) );
+      if (_capacity > InlineSize) delete [] _heap;
+      _heap      = entries;
+      _capacity *= 2;
+    }
+    Entry& entry = _getEntries()[ _size++ ];
+    entry._name     = property->getName()._getSharedName();
+    entry._property = property;
+    entry._name->capture();
+  }
+
+
+  void  PropertyVector::pop_back ()
+  {
+    _getEntries()[ --_size ]._name->release();
+  }
+
+
+// Keep the insertion order, vectors are too short for a swap with
+// the last element to be worth it.
+  bool  PropertyVector::erase ( const Property* property )
+  {
+    Entry* entries = _getEntries();
+    for ( uint32_t i=0 ; i<_size ; ++i ) {
+      if (entries[i]._property != property) continue;
+      SharedName* name = entries[i]._name;
+      std::memmove( entries+i, entries+i+1, (_size-i-1)*sizeof(Entry) );
+      --_size;
+      name->release();
+      return true;
+    }
+    return false;
+  }
+
+
+  string  PropertyVector::_getTypeName () const
+  { return "PropertyVector"; }
+
+
+  string  PropertyVector::_getString () const
+  { return "<" + _getTypeName() + " " + getString(_size) + ">"; }
+
+
+  Record* PropertyVector::_getRecord () const
+  {
+    Record* record = new Record ( _getString() );
+    for ( uint32_t i=0 ; i<_size ; ++i )
+      record->add( getSlot( getString(i), (*this)[i] ) );
+    return record;
+  }
+
+
+}  // Hurricane namespace.
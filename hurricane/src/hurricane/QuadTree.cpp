@@ -17,9 +17,12 @@
 // not, see <http://www.gnu.org/licenses/>.
 // ****************************************************************************************************
 
+#include <algorithm>
 #include "hurricane/QuadTree.h"
+#include "hurricane/PackedRTree.h"
 #include "hurricane/Go.h"
 #include "hurricane/Instance.h"
+#include "hurricane/DataBase.h"
 #include "hurricane/Error.h"
 #include "hurricane/Warning.h"
 
@@ -34,6 +37,10 @@ namespace Hurricane {
 #define QUAD_TREE_IMPLODE_THRESHOLD 80
 #define QUAD_TREE_EXPLODE_THRESHOLD 100
 
+// Root QuadTrees whose packed R-tree must be (re)built at the end of
+// the outermost UpdateSession.
+static vector<QuadTree*> RTREES_TO_BUILD;
+
 
 
 // ****************************************************************************************************
@@ -126,6 +133,8 @@ class QuadTree_GosUnder : public Collection<Go*> {
         private: DbU::Unit _threshold;
         private: QuadTree* _currentQuadTree;
         private: GoLocator _goLocator;
+        private: PackedRTree::Cursor _cursor;
+        private: bool _useRTree;
       //private: static size_t _allocateds;
 
         public: Locator();
@@ -199,7 +208,9 @@ QuadTree::QuadTree()
     _ulChild(NULL),
     _urChild(NULL),
     _llChild(NULL),
-    _lrChild(NULL)
+    _lrChild(NULL),
+    _rtree(NULL),
+    _rtreeQueued(false)
 {
 }
 
@@ -214,7 +225,9 @@ QuadTree::QuadTree(QuadTree* parent)
     _ulChild(NULL),
     _urChild(NULL),
     _llChild(NULL),
-    _lrChild(NULL)
+    _lrChild(NULL),
+    _rtree(NULL),
+    _rtreeQueued(false)
 {
 }
 
@@ -225,6 +238,11 @@ QuadTree::~QuadTree()
     if (_urChild) delete _urChild;
     if (_llChild) delete _llChild;
     if (_lrChild) delete _lrChild;
+    if (_rtreeQueued) {
+        auto iqueued = std::find(RTREES_TO_BUILD.begin(), RTREES_TO_BUILD.end(), this);
+        if (iqueued != RTREES_TO_BUILD.end()) RTREES_TO_BUILD.erase(iqueued);
+    }
+    if (_rtree) delete _rtree;
 }
 
 //size_t  QuadTree::getLocatorAllocateds ()
@@ -236,7 +254,9 @@ QuadTree::~QuadTree()
 const Box& QuadTree::getBoundingBox() const
 // ****************************************
 {
-  if (_boundingBox.isEmpty()) {
+// When the DataBase is frozen, all the non-empty bounding boxes have
+// already been computed (see _updateBoundingBoxes()).
+  if (_boundingBox.isEmpty() and not DataBase::isFrozen()) {
     Box& boundingBox = const_cast<Box&>( _boundingBox );
     if (_ulChild) boundingBox.merge(_ulChild->getBoundingBox());
     if (_urChild) boundingBox.merge(_urChild->getBoundingBox());
@@ -267,19 +287,8 @@ void QuadTree::insert(Go* go)
         throw Error("Can't insert go : null go");
 
     if (!go->isMaterialized()) {
-        Box boundingBox = go->getBoundingBox();
-        QuadTree* child = _getDeepestChild(boundingBox);
-        child->_goSet._insert(go);
-        go->_quadTree = child;
-        QuadTree* parent = child;
-        while (parent) {
-            parent->_size++;
-            if (parent->isEmpty() || !parent->_boundingBox.isEmpty())
-                parent->_boundingBox.merge(boundingBox);
-            parent = parent->_parent;
-        }
-        if (QUAD_TREE_EXPLODE_THRESHOLD <= child->_size)
-            child->_explode();
+        QuadTree* root = _insert(go, go->getBoundingBox());
+        if (root->_rtree && root->_rtree->needsRebuild()) root->_queueRTree();
     }
 }
 
@@ -294,13 +303,19 @@ void QuadTree::remove(Go* go)
         QuadTree* child = go->_quadTree;
         child->_goSet._remove(go);
         go->_quadTree = NULL;
+        QuadTree* root = child;
         QuadTree* parent = child;
         while (parent) {
             parent->_size--;
             if (parent->_boundingBox.isConstrainedBy(boundingBox))
                 parent->_boundingBox = Box();
+            root = parent;
             parent = parent->_parent;
         }
+        if (root->_rtree) {
+            root->_rtree->remove(go);
+            if (root->_rtree->needsRebuild()) root->_queueRTree();
+        }
         parent = child;
         while (parent) {
             if (!(parent->_size <= QUAD_TREE_IMPLODE_THRESHOLD))
@@ -311,6 +326,53 @@ void QuadTree::remove(Go* go)
     }
 }
 
+void QuadTree::setRTree(bool state)
+// ********************************
+{
+    if (_parent)
+        throw Error("Can't set packed R-tree index : not a root QuadTree");
+
+    if (state) {
+        if (!_rtree) {
+            _rtree = new PackedRTree();
+            buildRTree();
+        }
+    } else if (_rtree) {
+        delete _rtree;
+        _rtree = NULL;
+    }
+}
+
+void QuadTree::buildRTree()
+// ************************
+{
+    if (!_rtree) return;
+
+    vector<Go*> gos;
+    gos.reserve(_size);
+    for (Go* go : getGoRange()) gos.push_back(go);
+    _rtree->build(gos);
+}
+
+void QuadTree::buildRTrees()
+// *************************
+{
+    for (QuadTree* quadTree : RTREES_TO_BUILD) {
+        quadTree->_rtreeQueued = false;
+        if (quadTree->_rtree && quadTree->_rtree->needsRebuild())
+            quadTree->buildRTree();
+    }
+    RTREES_TO_BUILD.clear();
+}
+
+void QuadTree::_queueRTree()
+// *************************
+{
+    if (_rtreeQueued) return;
+    _rtreeQueued = true;
+    RTREES_TO_BUILD.push_back(this);
+}
+
 string QuadTree::_getString() const
 // ********************************
 {
@@ -339,6 +401,13 @@ Record* QuadTree::_getRecord() const
     record->add( getSlot("_urChild"    ,  _urChild    ) );
     record->add( getSlot("_llChild"    ,  _llChild    ) );
     record->add( getSlot("_lrChild"    ,  _lrChild    ) );
+    if (_rtree) {
+      record->add( getSlot("_rtree.size"    , _rtree->getSize()        ) );
+      record->add( getSlot("_rtree.levels"  , _rtree->getLevelsSize()  ) );
+      record->add( getSlot("_rtree.pendings", _rtree->getPendingsSize()) );
+      record->add( getSlot("_rtree.deads"   , _rtree->getDeadsSize()   ) );
+      record->add( getSlot("_rtree.valid"   , _rtree->isValid()        ) );
+    }
   }
   return record;
 }
@@ -456,6 +525,51 @@ QuadTree* QuadTree::_getNextQuadTree(const Box& area)
     return nextQuadTree;
 }
 
+QuadTree* QuadTree::_insert(Go* go, const Box& boundingBox)
+// ********************************************************
+{
+    QuadTree* child = _getDeepestChild(boundingBox);
+    child->_goSet._insert(go);
+    go->_quadTree = child;
+    QuadTree* root = child;
+    QuadTree* parent = child;
+    while (parent) {
+        parent->_size++;
+        if (parent->isEmpty() || !parent->_boundingBox.isEmpty())
+            parent->_boundingBox.merge(boundingBox);
+        root = parent;
+        parent = parent->_parent;
+    }
+    if (QUAD_TREE_EXPLODE_THRESHOLD <= child->_size)
+        child->_explode();
+    if (root->_rtree && root->_rtree->isValid()) root->_rtree->insert(go);
+    return root;
+}
+
+// Batch insertion for UpdateSession, with the bounding boxes computed
+// beforehand. Only this QuadTree and it's Gos are modified (the R-tree
+// is not queued for rebuild) so distinct root QuadTrees can be filled
+// concurrently.
+void QuadTree::_insert(const vector<Go*>& gos, const vector<Box>& boundingBoxes)
+// *****************************************************************************
+{
+    for (size_t i=0 ; i<gos.size() ; ++i) {
+        if (!gos[i]->isMaterialized()) _insert(gos[i], boundingBoxes[i]);
+    }
+}
+
+void QuadTree::_updateBoundingBoxes()
+// ***********************************
+{
+    if (_hasBeenExploded()) {
+        _ulChild->_updateBoundingBoxes();
+        _urChild->_updateBoundingBoxes();
+        _llChild->_updateBoundingBoxes();
+        _lrChild->_updateBoundingBoxes();
+    }
+    getBoundingBox();
+}
+
 void QuadTree::_explode()
 // **********************
 {
@@ -762,7 +876,9 @@ QuadTree_GosUnder::Locator::Locator()
     _area(),
     _threshold(0),
     _currentQuadTree(NULL),
-    _goLocator()
+    _goLocator(),
+    _cursor(),
+    _useRTree(false)
 {
   //_allocateds++;
 }
@@ -774,9 +890,16 @@ QuadTree_GosUnder::Locator::Locator(const QuadTree* quadTree, const Box& area, D
     _area(area),
     _threshold(threshold),
     _currentQuadTree(NULL),
-    _goLocator()
+    _goLocator(),
+    _cursor(),
+    _useRTree(false)
 {
     //_allocateds++;
+    if (_quadTree and _quadTree->getRTree() and _quadTree->getRTree()->isValid()) {
+        _useRTree = true;
+        _cursor = PackedRTree::Cursor(_quadTree->getRTree(), _area, _threshold);
+        return;
+    }
     if (_quadTree and not _area.isEmpty()) {
         _currentQuadTree = _quadTree->_getFirstQuadTree(_area);
         while ( true ) {
@@ -806,7 +929,9 @@ QuadTree_GosUnder::Locator::Locator(const Locator& locator)
     _area(locator._area),
     _threshold(locator._threshold),
     _currentQuadTree(locator._currentQuadTree),
-    _goLocator(locator._goLocator)
+    _goLocator(locator._goLocator),
+    _cursor(locator._cursor),
+    _useRTree(locator._useRTree)
 {
   //_allocateds++;
 }
@@ -819,12 +944,15 @@ QuadTree_GosUnder::Locator& QuadTree_GosUnder::Locator::operator=(const Locator&
     _threshold = locator._threshold;
     _currentQuadTree = locator._currentQuadTree;
     _goLocator = locator._goLocator;
+    _cursor = locator._cursor;
+    _useRTree = locator._useRTree;
     return *this;
 }
 
 Go* QuadTree_GosUnder::Locator::getElement() const
 // ***********************************************
 {
+    if (_useRTree) return _cursor.getElement();
     return _goLocator.getElement();
 }
 
@@ -837,12 +965,17 @@ Locator<Go*>* QuadTree_GosUnder::Locator::getClone() const
 bool QuadTree_GosUnder::Locator::isValid() const
 // *********************************************
 {
+    if (_useRTree) return _cursor.isValid();
     return _goLocator.isValid();
 }
 
 void QuadTree_GosUnder::Locator::progress()
 // ****************************************
 {
+  if (_useRTree) {
+    _cursor.progress();
+    return;
+  }
   if (isValid()) {
     do {
       _goLocator.progress();
@@ -30,8 +30,13 @@
 
 
 #include <limits>
+#include <set>
+#include <atomic>
+#include <thread>
+#include <exception>
 #include "hurricane/BasicLayer.h"
 #include "hurricane/Slice.h"
+#include "hurricane/DataBase.h"
 #include "hurricane/Cell.h"
 #include "hurricane/Instance.h"
 #include "hurricane/Query.h"
@@ -53,6 +58,8 @@ namespace Hurricane {
     , _stopLevel         (std::numeric_limits<unsigned int>::max())
     , _stopCellFlags     (Cell::Flags::NoFlags)
     , _instanceCount     (0)
+    , _rootInstance      ()
+    , _concurrent        (false)
   { }
 
 
@@ -115,6 +122,11 @@ namespace Hurricane {
     //cerr << "doQuery() start:" << _stack.getInstanceCount() << " " << _basicLayer << endl;
 
     while ( not _stack.empty() ) {
+      if (_stack.getRootInstance() and (_stack.size() == 1)) {
+        _stack.progress();
+        continue;
+      }
+
     // Process the Components of the current instance.
       Box ab = getMasterCell()->getAbutmentBox();
       if (  (_stack.getThreshold() <= 0)
@@ -172,6 +184,125 @@ namespace Hurricane {
   }
 
 
+  void  Query::prepareConcurrent ( Cell* topCell )
+  {
+  // Bounding boxes of the cells & quadtrees are lazily computed, down
+  // to the nodes reset by QuadTree::remove(), so force them all before
+  // the concurrent walk, which must be read-only.
+    std::set<Cell*> visiteds;
+    vector<Cell*>   stack;
+    stack.push_back( topCell );
+    while ( not stack.empty() ) {
+      Cell* cell = stack.back();
+      stack.pop_back();
+      if (not visiteds.insert(cell).second) continue;
+
+      cell->_getQuadTree()->_updateBoundingBoxes();
+      for ( Slice*          slice : cell->getSlices()          ) slice->_getQuadTree()->_updateBoundingBoxes();
+      for ( ExtensionSlice* slice : cell->getExtensionSlices() ) slice->_getQuadTree()->_updateBoundingBoxes();
+      cell->getBoundingBox();
+      for ( Instance* instance : cell->getInstances() ) stack.push_back( instance->getMasterCell() );
+    }
+  }
+
+
+  void  Query::doParallelQuery ( unsigned int threads, bool prepared )
+  {
+    if (_stack.getTopArea().isEmpty() or not _stack.getTopCell()) return;
+
+    Cell*             topCell = _stack.getTopCell();
+    vector<Instance*> roots;
+    if (    (threads > 1)
+       and  (_stack.getStopLevel() > 0)
+       and  not topCell->getFlags().isset(_stack.getStopCellFlags()) ) {
+      for ( Instance* instance : topCell->getInstancesUnder(_stack.getTopArea(),_stack.getThreshold()) )
+        roots.push_back( instance );
+    }
+    if (roots.size() < 2) { doQuery(); return; }
+
+  // Contiguous chunks of root instances, more than threads to balance
+  // the load, each walked by it's own clone to keep the merge order.
+    size_t         chunkCount = std::min( roots.size(), (size_t)threads*4 );
+    size_t         chunkSize  = (roots.size() + chunkCount - 1) / chunkCount;
+    vector<Query*> clones;
+    chunkCount = (roots.size() + chunkSize - 1) / chunkSize;
+    for ( size_t ichunk=0 ; ichunk<chunkCount ; ++ichunk ) {
+      Query* query = clone();
+      if (not query) break;
+
+      query->_basicLayer    = _basicLayer;
+      query->_extensionMask = _extensionMask;
+      query->_filter        = _filter;
+      query->_stack.setTopCell          ( topCell );
+      query->_stack.setTopArea          ( _stack.getTopArea() );
+      query->_stack.setTopTransformation( _stack.getTopTransformation() );
+      query->_stack.setThreshold        ( _stack.getThreshold() );
+      query->_stack.setStartLevel       ( _stack.getStartLevel() );
+      query->_stack.setStopLevel        ( _stack.getStopLevel() );
+      query->_stack.setStopCellFlags    ( _stack.getStopCellFlags() );
+      query->_stack.setConcurrent       ( true );
+      clones.push_back( query );
+    }
+    if (clones.size() < chunkCount) {
+      for ( Query* query : clones ) delete query;
+      doQuery();
+      return;
+    }
+
+  // First, the components of the top cell alone, as in doQuery().
+    unsigned int stopLevel = _stack.getStopLevel();
+    _stack.setStopLevel( 0 );
+    try {
+      doQuery();
+    } catch ( ... ) {
+      _stack.setStopLevel( stopLevel );
+      for ( Query* query : clones ) delete query;
+      throw;
+    }
+    _stack.setStopLevel( stopLevel );
+
+    if (not prepared and not DataBase::isFrozen()) prepareConcurrent( topCell );
+
+    std::atomic<size_t>             nextChunk ( 0 );
+    vector<std::exception_ptr>      errors    ( clones.size() );
+    auto walkChunks = [&] () {
+      for ( size_t ichunk=nextChunk++ ; ichunk<clones.size() ; ichunk=nextChunk++ ) {
+        try {
+          size_t end = std::min( (ichunk+1)*chunkSize, roots.size() );
+          for ( size_t iroot=ichunk*chunkSize ; iroot<end ; ++iroot ) {
+            clones[ichunk]->_stack.setRootInstance( roots[iroot] );
+            clones[ichunk]->doQuery();
+          }
+        } catch ( ... ) {
+          errors[ichunk] = std::current_exception();
+        }
+      }
+    };
+
+    vector<std::thread> workers;
+    for ( size_t i=1 ; i<std::min((size_t)threads,clones.size()) ; ++i )
+      workers.emplace_back( walkChunks );
+    walkChunks();
+    for ( std::thread& worker : workers ) worker.join();
+
+    std::exception_ptr error = NULL;
+    for ( size_t ichunk=0 ; ichunk<clones.size() ; ++ichunk ) {
+      if (errors[ichunk]) { if (not error) error = errors[ichunk]; }
+      else merge( clones[ichunk] );
+      delete clones[ichunk];
+    }
+    if (error) std::rethrow_exception( error );
+  }
+
+
+  Query* Query::clone () const
+  { return NULL; }
+
+
+  void  Query::merge ( Query* )
+  { }
+
+
   bool  Query::hasGoCallback () const
   { return false; }
 
@@ -18,6 +18,9 @@
 // ****************************************************************************************************
 
 #include <limits>
+#include <mutex>
+#include <cstring>
+#include <cstdint>
 #include "hurricane/Error.h"
 #include "hurricane/SharedName.h"
 
@@ -26,22 +29,158 @@ namespace Hurricane {
 
 
 // ****************************************************************************************************
-// SharedName implementation
+// SharedName::Table implementation
 // ****************************************************************************************************
 
-  SharedName::SharedNameMap* SharedName::_SHARED_NAME_MAP = NULL;
+class SharedName::Table {
+// ********************
 
+    public: static const size_t ShardBits = 6;
+    public: static const size_t Shards    = (1 << ShardBits);
+    public: static const size_t MinSlots  = 64;
 
-  SharedName::SharedName ( const string& name )
-    : _hash  (0)
-    , _count (0)
-    , _string(name)
+    public: struct Shard {
+                std::mutex           _mutex;
+                vector<SharedName*>  _slots;
+                size_t               _size;
+                size_t               _used;
+            };
+
+    private: static SharedName* const _tombstone;
+    private: Shard _shards[Shards];
+
+    public: Table();
+    public: ~Table();
+
+    public: static inline uint64_t mix(unsigned long hash) { return (uint64_t)hash * 0x9e3779b97f4a7c15ULL; };
+    public: inline Shard& getShard(uint64_t mixed) { return _shards[mixed >> (64 - ShardBits)]; };
+    public: size_t getCount() const;
+    public: SharedName* find(Shard&, unsigned long hash, const char* s, size_t length) const;
+    public: void insert(Shard&, uint64_t mixed, SharedName*);
+    public: void erase(Shard&, uint64_t mixed, SharedName*);
+    public: void dump() const;
+
+    private: void _rehash(Shard&, size_t slotsSize);
+
+};
+
+
+  SharedName* const SharedName::Table::_tombstone = reinterpret_cast<SharedName*>( uintptr_t(1) );
+
+
+SharedName::Table::Table()
+// ***********************
+{
+    for ( Shard& shard : _shards ) {
+        shard._slots.assign(MinSlots, NULL);
+        shard._size = 0;
+        shard._used = 0;
+    }
+}
+
+SharedName::Table::~Table()
+// ************************
+{ }
+
+size_t SharedName::Table::getCount() const
+// ***************************************
 {
-    if (!_SHARED_NAME_MAP) _SHARED_NAME_MAP = new SharedNameMap();
-    (*_SHARED_NAME_MAP)[&_string] = this;
+    size_t count = 0;
+    for ( const Shard& shard : _shards ) count += shard._size;
+    return count;
+}
+
+SharedName* SharedName::Table::find(Shard& shard, unsigned long hash, const char* s, size_t length) const
+// ***************************************************************************************************
+{
+// Linear probing. The slots size is a power of two, the low bits of
+// the mixed hash are used (the high ones have selected the shard).
+    size_t mask  = shard._slots.size() - 1;
+    size_t index = mix(hash) & mask;
+    for ( ; ; index = (index+1) & mask ) {
+        SharedName* sharedName = shard._slots[index];
+        if (!sharedName) return NULL;
+        if (sharedName == _tombstone) continue;
+        if (   (sharedName->_hash == hash)
+            && (sharedName->_string.size() == length)
+            && !memcmp(sharedName->_string.data(), s, length))
+            return sharedName;
+    }
+    return NULL;
+}
+
+void SharedName::Table::insert(Shard& shard, uint64_t mixed, SharedName* sharedName)
+// *********************************************************************************
+{
+// Kept under 75% of occupancy, tombstones included.
+    if ((shard._used+1)*4 > shard._slots.size()*3)
+        _rehash(shard, ((shard._size+1)*2 > shard._slots.size()) ? shard._slots.size()*2 : shard._slots.size());
+
+    size_t mask  = shard._slots.size() - 1;
+    size_t index = mixed & mask;
+    while (shard._slots[index] && (shard._slots[index] != _tombstone)) index = (index+1) & mask;
+    if (!shard._slots[index]) shard._used++;
+    shard._slots[index] = sharedName;
+    shard._size++;
+}
+
+void SharedName::Table::erase(Shard& shard, uint64_t mixed, SharedName* sharedName)
+// ********************************************************************************
+{
+    size_t mask  = shard._slots.size() - 1;
+    size_t index = mixed & mask;
+    for ( ; shard._slots[index] ; index = (index+1) & mask ) {
+        if (shard._slots[index] == sharedName) {
+            shard._slots[index] = _tombstone;
+            shard._size--;
+            return;
+        }
+    }
+}
+
+void SharedName::Table::_rehash(Shard& shard, size_t slotsSize)
+// ************************************************************
+{
+    vector<SharedName*> slots (slotsSize, NULL);
+    size_t              mask = slotsSize - 1;
+    for ( SharedName* sharedName : shard._slots ) {
+        if (!sharedName || (sharedName == _tombstone)) continue;
+        size_t index = mix(sharedName->_hash) & mask;
+        while (slots[index]) index = (index+1) & mask;
+        slots[index] = sharedName;
+    }
+    shard._slots.swap(slots);
+    shard._used = shard._size;
+}
+
+void SharedName::Table::dump() const
+// *********************************
+{
+    for ( size_t i=0 ; i<Shards ; i++ ) {
+        const Shard& shard = _shards[i];
+        cerr << "- Shard [" << i << "] " << shard._size << "/" << shard._slots.size() << endl;
+        for ( SharedName* sharedName : shard._slots ) {
+            if (!sharedName || (sharedName == _tombstone)) continue;
+            cerr << "  - " << sharedName << endl;
+        }
+    }
+}
 
-    for ( char c : _string ) _hash = 131 * _hash + int(c);
 
+
+// ****************************************************************************************************
+// SharedName implementation
+// ****************************************************************************************************
+
+  SharedName::Table* SharedName::_SHARED_NAME_TABLE = NULL;
+  bool               SharedName::_concurrent        = false;
+
+
+  SharedName::SharedName ( const char* s, size_t length, unsigned long hash )
+    : _hash  (hash)
+    , _count (0)
+    , _string(s,length)
+{
     // if (_idCounter == std::numeric_limits<unsigned long>::max()) {
     //   throw Error( "SharedName::SharedName(): Identifier counter has reached it's limit (%d bits)."
     //              , std::numeric_limits<unsigned long>::digits );
@@ -52,33 +191,95 @@ namespace Hurricane {
 
 SharedName::~SharedName()
 // **********************
+{ }
+
+unsigned long SharedName::computeHash(const char* s, size_t length)
+// ****************************************************************
 {
-    _SHARED_NAME_MAP->erase(&_string);
+// Must not be changed: the intrusive maps of Cell, Library & Technology
+// are hashed on it, so it drives their iteration order.
+    unsigned long hash = 0;
+    for ( size_t i=0 ; i<length ; i++ ) hash = 131 * hash + int(s[i]);
+    return hash;
 }
 
-void SharedName::capture()
-// ***********************
+SharedName* SharedName::_intern(const char* s, size_t length)
+// **********************************************************
+{
+// The very first Name is the static Name::_emptyName, built before
+// any thread may be started.
+    if (!_SHARED_NAME_TABLE) _SHARED_NAME_TABLE = new Table();
+
+    unsigned long hash  = computeHash(s, length);
+    uint64_t      mixed = Table::mix(hash);
+    Table::Shard& shard = _SHARED_NAME_TABLE->getShard(mixed);
+
+    std::unique_lock<std::mutex> lock (shard._mutex, std::defer_lock);
+    if (_concurrent) lock.lock();
+
+    SharedName* sharedName = _SHARED_NAME_TABLE->find(shard, hash, s, length);
+    if (!sharedName) {
+        sharedName = new SharedName(s, length, hash);
+        _SHARED_NAME_TABLE->insert(shard, mixed, sharedName);
+    }
+    sharedName->capture();
+    return sharedName;
+}
+
+void SharedName::setConcurrent(bool state)
+// ***************************************
 {
-    _count++;
+    _concurrent = state;
+}
+
+bool SharedName::isConcurrent()
+// ****************************
+{
+    return _concurrent;
+}
+
+size_t SharedName::getCount()
+// **************************
+{
+    return (_SHARED_NAME_TABLE) ? _SHARED_NAME_TABLE->getCount() : 0;
 }
 
 void SharedName::release()
 // ***********************
 {
-    if (!--_count) delete this;
+    uint64_t      mixed = Table::mix(_hash);
+    Table::Shard& shard = _SHARED_NAME_TABLE->getShard(mixed);
+
+    if (!_concurrent) {
+        if (--_count) return;
+        _SHARED_NAME_TABLE->erase(shard, mixed, this);
+        delete this;
+        return;
+    }
+
+// Only the last reference goes through the lock.
+    int count = _count.load(std::memory_order_relaxed);
+    while (count > 1) {
+        if (_count.compare_exchange_weak(count, count-1, std::memory_order_acq_rel)) return;
+    }
+
+    std::lock_guard<std::mutex> lock (shard._mutex);
+    if (--_count) return;
+    _SHARED_NAME_TABLE->erase(shard, mixed, this);
+    delete this;
 }
 
 string SharedName::_getString() const
 // **********************************
 {
-  return "<" + _TName("SharedName") + " " + getString(_count) + " hash:" + getString(_hash) + " " + _string + ">";
+  return "<" + _TName("SharedName") + " " + getString(_count.load()) + " hash:" + getString(_hash) + " " + _string + ">";
 }
 
 Record* SharedName::_getRecord() const
 // *****************************
 {
     Record* record = new Record(getString(this));
-    record->add(getSlot("_count", &_count));
+    record->add(getSlot("_count", _count.load()));
     record->add(getSlot("_string", &_string));
     return record;
 }
@@ -86,21 +287,8 @@ Record* SharedName::_getRecord() const
 void  SharedName::dump ()
 // **********************
 {
-  cerr << "_SHARED_NAME_MAP contents:" << endl;
-  for ( auto item : *_SHARED_NAME_MAP ) {
-    cerr << "- [" << item.first << "] = " << item.second << endl;
-  }
-}
-
-
-// ****************************************************************************************************
-// SharedName::SharedNameMapComparator
-// ****************************************************************************************************
-
-bool SharedName::SharedNameMapComparator::operator()(string* s1, string* s2) const
-// *******************************************************************************
-{
-    return (*s1) < (*s2);
+  cerr << "_SHARED_NAME_TABLE contents:" << endl;
+  if (_SHARED_NAME_TABLE) _SHARED_NAME_TABLE->dump();
 }
 
 
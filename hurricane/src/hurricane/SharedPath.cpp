@@ -99,10 +99,25 @@ class SharedPath_Instances : public Collection<Instance*> {
 
 static char NAME_SEPARATOR = '.';
 
+static inline uint64_t getChildKey(uint32_t headId, const Instance* instance)
+// ************************************************************************
+{
+    return ((uint64_t)headId << 32) | instance->getId();
+}
+
+// Never deleted, SharedPath may outlive the static destructors.
+std::vector<SharedPath*>*                  SharedPath::_idToSharedPath   = NULL;
+std::vector<uint32_t>*                     SharedPath::_freeIds          = NULL;
+std::unordered_map<uint64_t,SharedPath*>*  SharedPath::_childSharedPaths = NULL;
+bool                                       SharedPath::_concurrent       = false;
+std::recursive_mutex                       SharedPath::_mutex;
+
 
 SharedPath::SharedPath(Instance* headInstance, SharedPath* tailSharedPath)
 // ***********************************************************************
-  : _hash(0)
+  : _id(0)
+  , _headSharedPathId(0)
+  , _hash(0)
   , _headInstance(headInstance)
   , _tailSharedPath(tailSharedPath)
   , _quarkMap()
@@ -127,7 +142,23 @@ SharedPath::SharedPath(Instance* headInstance, SharedPath* tailSharedPath)
                    , getString(_tailSharedPath->getOwnerCell ()).c_str()
                    );
 
+    if (!_idToSharedPath) {
+        _idToSharedPath   = new std::vector<SharedPath*>(1, NULL);
+        _freeIds          = new std::vector<uint32_t>();
+        _childSharedPaths = new std::unordered_map<uint64_t,SharedPath*>();
+    }
+    if (_freeIds->empty() && (_idToSharedPath->size() > std::numeric_limits<uint32_t>::max()))
+        throw Error("Can't create " + _TName("SharedPath") + " : identifiers exhausted");
+
     _hash = (_headInstance->getId() << 1) + ((_tailSharedPath) ? _tailSharedPath->getHash() << 1: 0);
+    if (!_freeIds->empty()) {
+        _id = _freeIds->back();
+        _freeIds->pop_back();
+        (*_idToSharedPath)[_id] = this;
+    } else {
+        _id = _idToSharedPath->size();
+        _idToSharedPath->push_back(this);
+    }
     _headInstance->_getSharedPathMap()._insert(this);
 
     cdebug_log(0,0) << "SharedPath::SharedPath() pathHash:" << getHash() << " \"" << this << "\"" << endl;
@@ -145,6 +176,69 @@ SharedPath::~SharedPath()
         end_for;
     }
     _headInstance->_getSharedPathMap()._remove(this);
+
+    if (_headSharedPathId) {
+        auto ichild = _childSharedPaths->find(getChildKey(_headSharedPathId, getTailInstance()));
+        if ((ichild != _childSharedPaths->end()) && (ichild->second == this))
+            _childSharedPaths->erase(ichild);
+    }
+
+// The identifier is about to be recycled: forget the children indexed
+// under it, they must not be reached through the next path using it.
+    for_each_instance(instance, getMasterCell()->getInstances()) {
+        auto ichild = _childSharedPaths->find(getChildKey(_id, instance));
+        if (ichild != _childSharedPaths->end()) {
+            ichild->second->_headSharedPathId = 0;
+            _childSharedPaths->erase(ichild);
+        }
+        end_for;
+    }
+    (*_idToSharedPath)[_id] = NULL;
+    _freeIds->push_back(_id);
+}
+
+bool SharedPath::isConcurrent()
+// ****************************
+{
+    return _concurrent;
+}
+
+void SharedPath::setConcurrent(bool state)
+// ***************************************
+// Must be switched while only one thread is running.
+{
+    _concurrent = state;
+}
+
+SharedPath* SharedPath::getSharedPath(uint32_t id)
+// ***********************************************
+{
+    Guard guard;
+    return (_idToSharedPath && (id < _idToSharedPath->size())) ? (*_idToSharedPath)[id] : NULL;
+}
+
+uint32_t SharedPath::getIdsSize()
+// ******************************
+{
+    return (_idToSharedPath) ? _idToSharedPath->size() : 1;
+}
+
+SharedPath* SharedPath::_getChildSharedPath(const SharedPath* head, const Instance* tailInstance)
+// **********************************************************************************************
+{
+    if (!head) return tailInstance->_getSharedPath(NULL);
+    auto ichild = _childSharedPaths->find(getChildKey(head->_id, tailInstance));
+    return (ichild != _childSharedPaths->end()) ? ichild->second : NULL;
+}
+
+void SharedPath::_setChildSharedPath(SharedPath* head, SharedPath* child)
+// **********************************************************************
+{
+// The head (parent) may die before the child, in which case the child
+// link is reset by the head destructor (see ~SharedPath()).
+    if (!head || !child) return;
+    child->_headSharedPathId = head->_id;
+    (*_childSharedPaths)[getChildKey(head->_id, child->getTailInstance())] = child;
 }
 
 SharedPath* SharedPath::getHeadSharedPath() const
@@ -152,12 +246,17 @@ SharedPath* SharedPath::getHeadSharedPath() const
 {
     if (!_tailSharedPath) return NULL;
 
+    Guard guard;
+    SharedPath* headSharedPath = getSharedPath(_headSharedPathId);
+    if (headSharedPath) return headSharedPath;
+
     SharedPath* tailSharedPath = _tailSharedPath->getHeadSharedPath();
 
-    SharedPath* headSharedPath = _headInstance->_getSharedPath(tailSharedPath);
+    headSharedPath = _headInstance->_getSharedPath(tailSharedPath);
 
     if (!headSharedPath) headSharedPath = new SharedPath(_headInstance, tailSharedPath);
 
+    _setChildSharedPath(headSharedPath, (SharedPath*)this);
     return headSharedPath;
 }
 
@@ -267,6 +366,7 @@ Record* SharedPath::_getRecord() const
 {
      Record* record = new Record(getString(this));
     if (record) {
+        record->add(getSlot("Id", _id));
         record->add(getSlot("HeadInstance", _headInstance));
         record->add(getSlot("TailSharedPath", _tailSharedPath));
         record->add(getSlot("Quarks", &_quarkMap));
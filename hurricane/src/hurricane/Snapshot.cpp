@@ -0,0 +1,1266 @@
+// -*- C++ -*-
+//
+// Copyright (c) Sorbonne Université 2024-2024, All Rights Reserved
+//
+// This file is part of Hurricane.
+//
+// Hurricane is free software: you can redistribute it  and/or  modify
+// it under the terms of the GNU  Lesser  General  Public  License  as
+// published by the Free Software Foundation, either version 3 of  the
+// License, or (at your option) any later version.
+//
+// Hurricane is distributed in the hope that it will  be  useful,  but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHAN-
+// TABILITY or FITNESS FOR A PARTICULAR PURPOSE. See  the  Lesser  GNU
+// General Public License for more details.
+//
+// You should have received a copy of the Lesser  GNU  General  Public
+// License along with Hurricane. If not, see
+//                                     <http://www.gnu.org/licenses/>.
+//
+// +-----------------------------------------------------------------+
+// |                  H U R R I C A N E                              |
+// |     V L S I   B a c k e n d   D a t a - B a s e                 |
+// |                                                                 |
+// |  Author      :                    Jean-Paul Chaput              |
+// |  E-mail      :            Jean-Paul.Chaput@lip6.fr              |
+// | =============================================================== |
+// |  C++ Module  :  "./Snapshot.cpp"                                |
+// +-----------------------------------------------------------------+
+
+
+#include <cstring>
+#include <cerrno>
+#include <fstream>
+#include <map>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "hurricane/Error.h"
+#include "hurricane/Warning.h"
+#include "hurricane/DataBase.h"
+#include "hurricane/Technology.h"
+#include "hurricane/Library.h"
+#include "hurricane/Cell.h"
+#include "hurricane/Net.h"
+#include "hurricane/DeepNet.h"
+#include "hurricane/HyperNet.h"
+#include "hurricane/NetRoutingProperty.h"
+#include "hurricane/NetExternalComponents.h"
+#include "hurricane/Instance.h"
+#include "hurricane/Plug.h"
+#include "hurricane/Contact.h"
+#include "hurricane/Pin.h"
+#include "hurricane/Horizontal.h"
+#include "hurricane/Vertical.h"
+#include "hurricane/Pad.h"
+#include "hurricane/Diagonal.h"
+#include "hurricane/Polygon.h"
+#include "hurricane/Rectilinear.h"
+#include "hurricane/RoutingPad.h"
+#include "hurricane/Layer.h"
+#include "hurricane/Snapshot.h"
+
+
+namespace {
+
+  using namespace std;
+  using namespace Hurricane;
+
+
+// -------------------------------------------------------------------
+// File layout.
+//
+// All the records are plain structs written in native byte order,
+// their sizes are multiples of 8 and all sections are 8 bytes aligned
+// so they can be used directly from the mapped file.
+
+  const char      SnapshotMagic[8] = { 'H', 'S', 'N', 'A', 'P', 'S', 'H', 'T' };
+  const uint32_t  ByteOrderMark    = 0x01020304;
+  const uint32_t  NoIndex          = (uint32_t)-1;
+  const uint32_t  PlugAnchor       = (1U << 31);
+
+  const uint64_t  CellStateMask    = Cell::Flags::TerminalNetlist
+                                   | Cell::Flags::Pad
+                                   | Cell::Flags::Feed
+                                   | Cell::Flags::Diode
+                                   | Cell::Flags::PowerFeed
+                                   | Cell::Flags::FlattenedNets
+                                   | Cell::Flags::AbstractedSupply
+                                   | Cell::Flags::Placed
+                                   | Cell::Flags::Routed
+                                   | Cell::Flags::SlavedAb
+                                   | Cell::Flags::NoExtractConsistent;
+
+  enum CellFlag      { CellReference  = (1 << 0)
+                     , CellEmptyAb    = (1 << 1)
+                     };
+  enum NetFlag       { NetExternal    = (1 << 0)
+                     , NetGlobal      = (1 << 1)
+                     , NetAutomatic   = (1 << 2)
+                     , NetDeep        = (1 << 3)
+                     , NetRouting     = (1 << 4)
+                     };
+  enum ComponentKind { KindContact     = 1
+                     , KindPin         = 2
+                     , KindHorizontal  = 3
+                     , KindVertical    = 4
+                     , KindPad         = 5
+                     , KindRoutingPad  = 6
+                     , KindDiagonal    = 7
+                     , KindPolygon     = 8
+                     , KindRectilinear = 9
+                     };
+  enum ComponentFlag { ComponentExternal = (1 << 0)
+                     };
+  enum EntityKind    { EntityLocal     = 1
+                     , EntityPlug      = 2
+                     , EntityComponent = 3
+                     };
+
+
+  struct Section {
+    uint64_t  _offset;
+    uint64_t  _size;
+  };
+
+
+  struct FileHeader {
+    char      _magic[8];
+    uint32_t  _version;
+    uint32_t  _byteOrder;
+    double    _physicalsPerGrid;
+    double    _gridsPerLambda;
+    uint64_t  _fileSize;
+    Section   _strings;
+    Section   _chars;
+    Section   _cells;
+    uint32_t  _topCell;
+    uint32_t  _padding;
+  };
+
+
+  struct StringEntry {
+    uint32_t  _offset;
+    uint32_t  _length;
+  };
+
+
+  struct CellEntry {
+    uint32_t  _name;
+    uint32_t  _library;
+    uint32_t  _flags;
+    uint32_t  _padding;
+    uint64_t  _cellFlags;
+    int64_t   _abutmentBox[4];
+    Section   _nets;
+    Section   _instances;
+    Section   _plugs;
+    Section   _components;
+    Section   _paths;
+    Section   _points;
+  };
+
+
+  struct NetEntry {
+    uint32_t  _name;
+    uint32_t  _flags;
+    uint32_t  _type;
+    uint32_t  _direction;
+    uint32_t  _path;          // Root net occurrence of a DeepNet.
+    uint32_t  _pathSize;
+    uint32_t  _rootNet;
+    uint32_t  _routingFlags;  // NetRoutingState.
+    uint32_t  _wPitch;
+    uint32_t  _symNet;
+    int64_t   _symAxis;
+  };
+
+
+  struct InstanceEntry {
+    uint32_t  _name;
+    uint32_t  _master;
+    int64_t   _tx;
+    int64_t   _ty;
+    uint32_t  _orientation;
+    uint32_t  _placementStatus;
+  };
+
+
+  struct PlugEntry {
+    uint32_t  _instance;
+    uint32_t  _masterNet;
+    uint32_t  _net;
+    uint32_t  _padding;
+  };
+
+
+  struct PointEntry {
+    int64_t   _x;
+    int64_t   _y;
+  };
+
+
+// The meaning of the fields depends on the kind:
+//   - Contact & Pin : _source is the anchor, _values are dx, dy,
+//                     width & height.
+//   - Horizontal    : _values are y, width, dxSource & dxTarget.
+//   - Vertical      : _values are x, width, dySource & dyTarget.
+//   - Pad           : _values are the bounding box.
+//   - Diagonal      : _values are the source x & y, the target x & y
+//                     and the width.
+//   - Polygon &     : _values are the index of the first point in the
+//     Rectilinear     points pool of the Cell and the points count.
+//   - RoutingPad    : _status is the EntityKind of the occurrence,
+//                     _source the local component, or (_name,
+//                     _entityNet) the plug, or (_entityNet, _layer,
+//                     _values[0..3]) the component. _values[4..5] are
+//                     the user center.
+// Anchors (_source & _target) are component indexes, or plug indexes
+// tagged with PlugAnchor. _properties holds the ComponentFlag.
+
+  struct ComponentEntry {
+    uint32_t  _kind;
+    uint32_t  _net;
+    uint32_t  _layer;
+    uint32_t  _source;
+    uint32_t  _target;
+    uint32_t  _name;
+    uint32_t  _entityNet;
+    uint32_t  _flags;
+    uint32_t  _status;
+    uint32_t  _path;
+    uint32_t  _pathSize;
+    uint32_t  _properties;
+    int64_t   _values[6];
+  };
+
+
+  static_assert( sizeof(FileHeader    ) % 8 == 0, "FileHeader size must be a multiple of 8."     );
+  static_assert( sizeof(StringEntry   ) % 8 == 0, "StringEntry size must be a multiple of 8."    );
+  static_assert( sizeof(CellEntry     ) % 8 == 0, "CellEntry size must be a multiple of 8."      );
+  static_assert( sizeof(NetEntry      ) % 8 == 0, "NetEntry size must be a multiple of 8."       );
+  static_assert( sizeof(InstanceEntry ) % 8 == 0, "InstanceEntry size must be a multiple of 8."  );
+  static_assert( sizeof(PlugEntry     ) % 8 == 0, "PlugEntry size must be a multiple of 8."      );
+  static_assert( sizeof(ComponentEntry) % 8 == 0, "ComponentEntry size must be a multiple of 8." );
+  static_assert( sizeof(PointEntry    ) % 8 == 0, "PointEntry size must be a multiple of 8."     );
+
+
+  inline uint64_t  align8 ( uint64_t offset ) { return (offset + 7) & ~(uint64_t)7; }
+
+
+// -------------------------------------------------------------------
+// Class  :  "SnapshotWriter".
+
+  class SnapshotWriter {
+    public:
+                 SnapshotWriter ();
+      uint32_t   addCell        ( Cell* );
+      void       write          ( const string& path, uint32_t topCell );
+    private:
+      struct CellData {
+        CellEntry               _entry;
+        vector<NetEntry>        _nets;
+        vector<InstanceEntry>   _instances;
+        vector<PlugEntry>       _plugs;
+        vector<ComponentEntry>  _components;
+        vector<uint32_t>        _paths;
+        vector<PointEntry>      _points;
+      };
+    private:
+      uint32_t   _addString       ( const Name& );
+      uint32_t   _addPath         ( CellData&, const Path& );
+      void       _addPoints       ( ComponentEntry&, const vector<Point>&, CellData& );
+      void       _checkProperties ( const DBo*, map<string,size_t>& droppeds ) const;
+      void       _fillCell        ( Cell*, CellData& );
+      void       _fillComponent   ( ComponentEntry&, Component*, CellData& );
+      uint32_t   _getAnchor       ( Component* ) const;
+      template< typename Entry >
+      void       _write           ( ofstream&, uint64_t& position, const vector<Entry>& );
+    private:
+      unordered_map<Name,uint32_t>         _stringIds;
+      vector<StringEntry>                  _strings;
+      string                               _chars;
+      unordered_map<Cell*,uint32_t>        _cellIds;
+      vector<CellData>                     _cells;
+      unordered_map<Net*,uint32_t>         _netIds;
+      unordered_map<Instance*,uint32_t>    _instanceIds;
+      unordered_map<Plug*,uint32_t>        _plugIds;
+      unordered_map<Component*,uint32_t>   _componentIds;
+  };
+
+
+  SnapshotWriter::SnapshotWriter ()
+    : _stringIds   ()
+    , _strings     ()
+    , _chars       ()
+    , _cellIds     ()
+    , _cells       ()
+    , _netIds      ()
+    , _instanceIds ()
+    , _plugIds     ()
+    , _componentIds()
+  { }
+
+
+  uint32_t  SnapshotWriter::_addString ( const Name& name )
+  {
+    auto inserted = _stringIds.insert( make_pair(name,(uint32_t)_strings.size()) );
+    if (inserted.second) {
+      const string& s = getString( name );
+      _strings.push_back( { (uint32_t)_chars.size(), (uint32_t)s.size() } );
+      _chars.append( s );
+    }
+    return inserted.first->second;
+  }
+
+
+  uint32_t  SnapshotWriter::_addPath ( CellData& data, const Path& path )
+  {
+    uint32_t begin = data._paths.size();
+    for ( Path tail=path ; not tail.isEmpty() ; tail=tail.getTailPath() )
+      data._paths.push_back( _addString(tail.getHeadInstance()->getName()) );
+    return begin;
+  }
+
+
+  void  SnapshotWriter::_addPoints ( ComponentEntry& entry, const vector<Point>& points, CellData& data )
+  {
+    entry._values[0] = data._points.size();
+    entry._values[1] = points.size();
+    for ( const Point& point : points )
+      data._points.push_back( { point.getX(), point.getY() } );
+  }
+
+
+// Only the NetRoutingState and the external components are saved. The
+// other properties that would go in a JSON save are counted.
+  void  SnapshotWriter::_checkProperties ( const DBo* dbo, map<string,size_t>& droppeds ) const
+  {
+    for ( Property* property : dbo->getProperties() ) {
+      if (not property->hasJson()) continue;
+      if (property->getName() == NetRoutingProperty::getPropertyName()) continue;
+      ++droppeds[ getString(property->getName()) ];
+    }
+  }
+
+
+  uint32_t  SnapshotWriter::addCell ( Cell* cell )
+  {
+    auto icell = _cellIds.find( cell );
+    if (icell != _cellIds.end()) return icell->second;
+
+  // Masters are always written before the Cells that instanciate them.
+    if (not cell->isTerminalNetlist()) {
+      for ( Instance* instance : cell->getInstances() )
+        addCell( instance->getMasterCell() );
+    }
+
+    uint32_t id = _cells.size();
+    _cellIds.insert( make_pair(cell,id) );
+    _cells.push_back( CellData() );
+    _fillCell( cell, _cells.back() );
+    return id;
+  }
+
+
+  void  SnapshotWriter::_fillCell ( Cell* cell, CellData& data )
+  {
+    CellEntry& entry = data._entry;
+    memset( &entry, 0, sizeof(CellEntry) );
+
+    Box ab = cell->getAbutmentBox();
+    entry._name      = _addString( cell->getName() );
+    entry._library   = _addString( Name(cell->getLibrary()->getHierarchicalName()) );
+    entry._cellFlags = (uint64_t)cell->getFlags() & CellStateMask;
+    if (ab.isEmpty()) entry._flags |= CellEmptyAb;
+    else {
+      entry._abutmentBox[0] = ab.getXMin();
+      entry._abutmentBox[1] = ab.getYMin();
+      entry._abutmentBox[2] = ab.getXMax();
+      entry._abutmentBox[3] = ab.getYMax();
+    }
+    if (cell->isTerminalNetlist()) {
+      entry._flags |= CellReference;
+      return;
+    }
+
+    _netIds      .clear();
+    _instanceIds .clear();
+    _plugIds     .clear();
+    _componentIds.clear();
+
+    for ( Net* net : cell->getNets() ) {
+      _netIds.insert( make_pair(net,(uint32_t)data._nets.size()) );
+      data._nets.push_back( NetEntry() );
+    }
+    for ( Instance* instance : cell->getInstances() ) {
+      InstanceEntry ientry;
+      ientry._name            = _addString( instance->getName() );
+      ientry._master          = _cellIds[ instance->getMasterCell() ];
+      ientry._tx              = instance->getTransformation().getTx();
+      ientry._ty              = instance->getTransformation().getTy();
+      ientry._orientation     = instance->getTransformation().getOrientation().getCode();
+      ientry._placementStatus = instance->getPlacementStatus().getCode();
+      _instanceIds.insert( make_pair(instance,(uint32_t)data._instances.size()) );
+      data._instances.push_back( ientry );
+
+      for ( Plug* plug : instance->getConnectedPlugs() ) {
+        PlugEntry pentry;
+        pentry._instance  = _instanceIds[ instance ];
+        pentry._masterNet = _addString( plug->getMasterNet()->getName() );
+        pentry._net       = _netIds[ plug->getNet() ];
+        pentry._padding   = 0;
+        _plugIds.insert( make_pair(plug,(uint32_t)data._plugs.size()) );
+        data._plugs.push_back( pentry );
+      }
+    }
+
+    size_t              unsupporteds = 0;
+    map<string,size_t>  droppeds;
+    _checkProperties( cell, droppeds );
+    for ( Instance* instance : cell->getInstances() ) _checkProperties( instance, droppeds );
+    for ( Net* net : cell->getNets() ) {
+      NetEntry& nentry = data._nets[ _netIds[net] ];
+      memset( &nentry, 0, sizeof(NetEntry) );
+      nentry._name      = _addString( net->getName() );
+      nentry._type      = net->getType().getCode();
+      nentry._direction = net->getDirection().getCode();
+      nentry._path      = NoIndex;
+      nentry._rootNet   = NoIndex;
+      nentry._symNet    = NoIndex;
+      if (net->isExternal ()) nentry._flags |= NetExternal;
+      if (net->isGlobal   ()) nentry._flags |= NetGlobal;
+      if (net->isAutomatic()) nentry._flags |= NetAutomatic;
+      _checkProperties( net, droppeds );
+
+      DeepNet* deepNet = dynamic_cast<DeepNet*>( net );
+      if (deepNet) {
+        Occurrence root = deepNet->getRootNetOccurrence();
+        nentry._flags   |= NetDeep;
+        nentry._path     = _addPath( data, root.getPath() );
+        nentry._pathSize = data._paths.size() - nentry._path;
+        nentry._rootNet  = _addString( static_cast<Net*>(root.getEntity())->getName() );
+      }
+
+      NetRoutingState* state = NetRoutingExtension::get( net );
+      if (state) {
+        nentry._flags        |= NetRouting;
+        nentry._routingFlags  = state->getFlags();
+        nentry._wPitch        = state->getWPitch();
+        nentry._symAxis       = state->getSymAxis();
+        if (state->getSymNet()) nentry._symNet = _netIds[ state->getSymNet() ];
+      }
+
+      for ( Component* component : net->getComponents() ) {
+        if (dynamic_cast<Plug*>(component)) continue;
+        if (  not dynamic_cast<Contact    *>(component)
+          and not dynamic_cast<Horizontal *>(component)
+          and not dynamic_cast<Vertical   *>(component)
+          and not dynamic_cast<Pad        *>(component)
+          and not dynamic_cast<RoutingPad *>(component)
+          and not dynamic_cast<Diagonal   *>(component)
+          and not dynamic_cast<Polygon    *>(component)
+          and not dynamic_cast<Rectilinear*>(component)) {
+          ++unsupporteds;
+          continue;
+        }
+        _checkProperties( component, droppeds );
+        _componentIds.insert( make_pair(component,(uint32_t)data._components.size()) );
+        data._components.push_back( ComponentEntry() );
+      }
+    }
+
+    for ( auto item : _componentIds )
+      _fillComponent( data._components[item.second], item.first, data );
+
+    if (unsupporteds)
+      cerr << Warning( "Snapshot::save(): %u components of kinds not supported in %s are not saved."
+                     , (unsigned)unsupporteds, getString(cell).c_str() ) << endl;
+    if (not droppeds.empty()) {
+      string names;
+      for ( auto idropped : droppeds ) {
+        if (not names.empty()) names += ", ";
+        names += idropped.first + " (" + getString(idropped.second) + ")";
+      }
+      cerr << Error( "Snapshot::save(): Properties of %s are not supported and not saved:\n"
+                     "        %s."
+                   , getString(cell).c_str(), names.c_str() ) << endl;
+    }
+  }
+
+
+  uint32_t  SnapshotWriter::_getAnchor ( Component* anchor ) const
+  {
+    if (not anchor) return NoIndex;
+
+    Plug* plug = dynamic_cast<Plug*>( anchor );
+    if (plug) {
+      auto iplug = _plugIds.find( plug );
+      return (iplug != _plugIds.end()) ? (iplug->second | PlugAnchor) : NoIndex;
+    }
+    auto icomponent = _componentIds.find( anchor );
+    return (icomponent != _componentIds.end()) ? icomponent->second : NoIndex;
+  }
+
+
+  void  SnapshotWriter::_fillComponent ( ComponentEntry& entry, Component* component, CellData& data )
+  {
+    memset( &entry, 0, sizeof(ComponentEntry) );
+    entry._net    = _netIds[ component->getNet() ];
+    entry._layer  = (component->getLayer()) ? _addString( component->getLayer()->getName() ) : NoIndex;
+    entry._source = NoIndex;
+    entry._target = NoIndex;
+    entry._name   = NoIndex;
+    entry._path   = NoIndex;
+
+    Pin*         pin         = NULL;
+    Contact*     contact     = NULL;
+    Horizontal*  horizontal  = NULL;
+    Vertical*    vertical    = NULL;
+    Pad*         pad         = NULL;
+    RoutingPad*  rp          = NULL;
+    Diagonal*    diagonal    = NULL;
+    Polygon*     polygon     = NULL;
+    Rectilinear* rectilinear = NULL;
+
+    if (NetExternalComponents::isExternal(component)) entry._properties |= ComponentExternal;
+
+    if ( (pin = dynamic_cast<Pin*>(component)) ) {
+      entry._kind      = KindPin;
+      entry._name      = _addString( pin->getName() );
+      entry._flags     = pin->getAccessDirection().getCode();
+      entry._status    = pin->getPlacementStatus().getCode();
+      entry._source    = _getAnchor( pin->getAnchor() );
+      entry._values[0] = pin->getDx();
+      entry._values[1] = pin->getDy();
+      entry._values[2] = pin->getWidth();
+      entry._values[3] = pin->getHeight();
+    } else if ( (contact = dynamic_cast<Contact*>(component)) ) {
+      entry._kind      = KindContact;
+      entry._source    = _getAnchor( contact->getAnchor() );
+      entry._values[0] = contact->getDx();
+      entry._values[1] = contact->getDy();
+      entry._values[2] = contact->getWidth();
+      entry._values[3] = contact->getHeight();
+    } else if ( (horizontal = dynamic_cast<Horizontal*>(component)) ) {
+      entry._kind      = KindHorizontal;
+      entry._source    = _getAnchor( horizontal->getSource() );
+      entry._target    = _getAnchor( horizontal->getTarget() );
+      entry._values[0] = horizontal->getY();
+      entry._values[1] = horizontal->getWidth();
+      entry._values[2] = horizontal->getDxSource();
+      entry._values[3] = horizontal->getDxTarget();
+    } else if ( (vertical = dynamic_cast<Vertical*>(component)) ) {
+      entry._kind      = KindVertical;
+      entry._source    = _getAnchor( vertical->getSource() );
+      entry._target    = _getAnchor( vertical->getTarget() );
+      entry._values[0] = vertical->getX();
+      entry._values[1] = vertical->getWidth();
+      entry._values[2] = vertical->getDySource();
+      entry._values[3] = vertical->getDyTarget();
+    } else if ( (pad = dynamic_cast<Pad*>(component)) ) {
+      Box bb = pad->getBoundingBox();
+      entry._kind      = KindPad;
+      entry._values[0] = bb.getXMin();
+      entry._values[1] = bb.getYMin();
+      entry._values[2] = bb.getXMax();
+      entry._values[3] = bb.getYMax();
+    } else if ( (diagonal = dynamic_cast<Diagonal*>(component)) ) {
+      entry._kind      = KindDiagonal;
+      entry._values[0] = diagonal->getSourceX();
+      entry._values[1] = diagonal->getSourceY();
+      entry._values[2] = diagonal->getTargetX();
+      entry._values[3] = diagonal->getTargetY();
+      entry._values[4] = diagonal->getWidth();
+    } else if ( (polygon = dynamic_cast<Polygon*>(component)) ) {
+      entry._kind = KindPolygon;
+      _addPoints( entry, polygon->getPoints(), data );
+    } else if ( (rectilinear = dynamic_cast<Rectilinear*>(component)) ) {
+      entry._kind = KindRectilinear;
+      _addPoints( entry, rectilinear->getPoints(), data );
+    } else if ( (rp = dynamic_cast<RoutingPad*>(component)) ) {
+      Occurrence occurrence = rp->getOccurrence();
+      Entity*    entity     = occurrence.getEntity();
+      Plug*      plug       = dynamic_cast<Plug*>( entity );
+      entry._kind  = KindRoutingPad;
+      entry._flags = rp->getFlags();
+      entry._layer = NoIndex;
+      if (occurrence.getPath().isEmpty() and not plug) {
+        entry._status = EntityLocal;
+        entry._source = _getAnchor( static_cast<Component*>(entity) );
+      } else {
+        entry._path     = _addPath( data, occurrence.getPath() );
+        entry._pathSize = data._paths.size() - entry._path;
+        if (plug) {
+          entry._status    = EntityPlug;
+          entry._name      = _addString( plug->getInstance()->getName() );
+          entry._entityNet = _addString( plug->getMasterNet()->getName() );
+        } else {
+          Component* master = static_cast<Component*>( entity );
+          Box        bb     = master->getBoundingBox();
+          entry._status    = EntityComponent;
+          entry._entityNet = _addString( master->getNet()->getName() );
+          entry._layer     = _addString( master->getLayer()->getName() );
+          entry._values[0] = bb.getXMin();
+          entry._values[1] = bb.getYMin();
+          entry._values[2] = bb.getXMax();
+          entry._values[3] = bb.getYMax();
+        }
+      }
+      if (rp->hasUserCenter()) {
+        entry._values[4] = rp->getUserCenter().getX();
+        entry._values[5] = rp->getUserCenter().getY();
+      }
+    }
+  }
+
+
+  template< typename Entry >
+  void  SnapshotWriter::_write ( ofstream& stream, uint64_t& position, const vector<Entry>& entries )
+  {
+    static const char zeros[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+    uint64_t aligned = align8( position );
+    stream.write( zeros, aligned - position );
+    stream.write( reinterpret_cast<const char*>(entries.data()), entries.size()*sizeof(Entry) );
+    position = aligned + entries.size()*sizeof(Entry);
+  }
+
+
+  void  SnapshotWriter::write ( const string& path, uint32_t topCell )
+  {
+    FileHeader header;
+    memset( &header, 0, sizeof(FileHeader) );
+    memcpy( header._magic, SnapshotMagic, sizeof(SnapshotMagic) );
+    header._version          = Snapshot::Version;
+    header._byteOrder        = ByteOrderMark;
+    header._physicalsPerGrid = DbU::getPhysicalsPerGrid();
+    header._gridsPerLambda   = DbU::getGridsPerLambda();
+    header._topCell          = topCell;
+
+  // First compute the layout (offsets), then write sequentially.
+    uint64_t position = sizeof(FileHeader);
+    position = align8( position ); header._strings = { position, _strings.size() }; position += _strings.size()*sizeof(StringEntry);
+    position = align8( position ); header._chars   = { position, _chars  .size() }; position += _chars  .size();
+    position = align8( position ); header._cells   = { position, _cells  .size() }; position += _cells  .size()*sizeof(CellEntry);
+    for ( CellData& data : _cells ) {
+      CellEntry& entry = data._entry;
+      position = align8( position ); entry._nets       = { position, data._nets      .size() }; position += data._nets      .size()*sizeof(NetEntry);
+      position = align8( position ); entry._instances  = { position, data._instances .size() }; position += data._instances .size()*sizeof(InstanceEntry);
+      position = align8( position ); entry._plugs      = { position, data._plugs     .size() }; position += data._plugs     .size()*sizeof(PlugEntry);
+      position = align8( position ); entry._components = { position, data._components.size() }; position += data._components.size()*sizeof(ComponentEntry);
+      position = align8( position ); entry._paths      = { position, data._paths     .size() }; position += data._paths     .size()*sizeof(uint32_t);
+      position = align8( position ); entry._points     = { position, data._points    .size() }; position += data._points    .size()*sizeof(PointEntry);
+    }
+    header._fileSize = position;
+
+    ofstream stream ( path, ios::out|ios::binary|ios::trunc );
+    if (not stream.good())
+      throw Error( "Snapshot::save(): Unable to open \"%s\" for writing.", path.c_str() );
+
+    vector<char>      chars   ( _chars.begin(), _chars.end() );
+    vector<CellEntry> entries;
+    entries.reserve( _cells.size() );
+    for ( const CellData& data : _cells ) entries.push_back( data._entry );
+
+    stream.write( reinterpret_cast<const char*>(&header), sizeof(FileHeader) );
+    position = sizeof(FileHeader);
+    _write( stream, position, _strings );
+    _write( stream, position, chars    );
+    _write( stream, position, entries  );
+    for ( const CellData& data : _cells ) {
+      _write( stream, position, data._nets       );
+      _write( stream, position, data._instances  );
+      _write( stream, position, data._plugs      );
+      _write( stream, position, data._components );
+      _write( stream, position, data._paths      );
+      _write( stream, position, data._points     );
+    }
+    stream.close();
+
+    if (stream.fail())
+      throw Error( "Snapshot::save(): Write error on \"%s\".", path.c_str() );
+  }
+
+
+} // Anonymous namespace.
+
+
+namespace Hurricane {
+
+  using std::string;
+  using std::vector;
+  using std::cerr;
+  using std::endl;
+
+
+// -------------------------------------------------------------------
+// Class  :  "Hurricane::Snapshot".
+
+
+  void  Snapshot::save ( Cell* cell, const string& path )
+  {
+    if (not cell)
+      throw Error( "Snapshot::save(): NULL Cell argument." );
+
+    SnapshotWriter writer;
+    uint32_t       topCell = writer.addCell( cell );
+    writer.write( path, topCell );
+  }
+
+
+  unordered_map<const Cell*,Snapshot*>  Snapshot::_lazies;
+
+
+  Cell* Snapshot::load ( const string& path, uint32_t flags )
+  {
+    if (flags & Eager) {
+      Snapshot snapshot ( path );
+      Cell*    topCell  = snapshot.loadNetlist();
+      snapshot.loadComponents();
+      return topCell;
+    }
+
+    Snapshot* snapshot = new Snapshot ( path );
+    Cell*     topCell  = NULL;
+    try {
+      topCell = snapshot->loadNetlist();
+    } catch ( ... ) {
+      delete snapshot;
+      throw;
+    }
+    if (snapshot->_pendings.empty()) {
+      delete snapshot;
+      return topCell;
+    }
+    for ( auto ipending : snapshot->_pendings ) _lazies[ ipending.first ] = snapshot;
+    cdebug_log(18,0) << "Snapshot::load() " << path << " "
+                     << snapshot->_pendings.size() << " lazy Cells." << endl;
+    return topCell;
+  }
+
+
+  bool  Snapshot::isLazy ( const Cell* cell )
+  { return (_lazies.find(cell) != _lazies.end()); }
+
+
+  void  Snapshot::complete ( Cell* cell )
+  {
+    if (_lazies.empty()) return;
+    auto ilazy = _lazies.find( cell );
+    if (ilazy == _lazies.end()) return;
+
+    Snapshot* snapshot = ilazy->second;
+    snapshot->loadComponents( cell );
+    if (snapshot->_pendings.empty()) delete snapshot;
+  }
+
+
+  void  Snapshot::forget ( Cell* cell )
+  {
+    if (_lazies.empty()) return;
+  // The slave instances are about to be destroyed while the pending
+  // components of their owners may be anchored on their plugs.
+    vector<Cell*> owners;
+    for ( Instance* instance : cell->getSlaveInstances() ) owners.push_back( instance->getCell() );
+    for ( Cell* owner : owners ) complete( owner );
+
+    auto ilazy = _lazies.find( cell );
+    if (ilazy == _lazies.end()) return;
+
+    Snapshot* snapshot = ilazy->second;
+    snapshot->_release( cell );
+    if (snapshot->_pendings.empty()) delete snapshot;
+  }
+
+
+  void  Snapshot::_release ( const Cell* cell )
+  {
+    _pendings.erase( cell );
+    auto ilazy = _lazies.find( cell );
+    if ((ilazy != _lazies.end()) and (ilazy->second == this)) _lazies.erase( ilazy );
+  }
+
+
+  Snapshot::Snapshot ( const string& path )
+    : _path     (path)
+    , _base     (NULL)
+    , _size     (0)
+    , _names    ()
+    , _layers   ()
+    , _cells    ()
+    , _nets     ()
+    , _instances()
+    , _plugs    ()
+    , _pendings ()
+  {
+    int fd = open( _path.c_str(), O_RDONLY );
+    if (fd < 0)
+      throw Error( "Snapshot::Snapshot(): Unable to open \"%s\" (%s)."
+                 , _path.c_str(), strerror(errno) );
+
+    struct stat status;
+    if (fstat(fd,&status) < 0) {
+      close( fd );
+      throw Error( "Snapshot::Snapshot(): Unable to stat \"%s\" (%s)."
+                 , _path.c_str(), strerror(errno) );
+    }
+    _size = status.st_size;
+    if (_size < sizeof(FileHeader)) {
+      close( fd );
+      throw Error( "Snapshot::Snapshot(): \"%s\" is too small to be a snapshot.", _path.c_str() );
+    }
+
+    void* base = mmap( NULL, _size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if (base == MAP_FAILED)
+      throw Error( "Snapshot::Snapshot(): Unable to map \"%s\" (%s)."
+                 , _path.c_str(), strerror(errno) );
+    _base = static_cast<const char*>( base );
+
+    const FileHeader* header = reinterpret_cast<const FileHeader*>( _base );
+    string            error;
+    if (memcmp(header->_magic,SnapshotMagic,sizeof(SnapshotMagic)))
+      error = "not a snapshot file";
+    else if (header->_byteOrder != ByteOrderMark)
+      error = "written with another byte order";
+    else if (header->_version != Version)
+      error = "unsupported version " + getString(header->_version);
+    else if (header->_fileSize != _size)
+      error = "truncated file";
+    else if (  (header->_physicalsPerGrid != DbU::getPhysicalsPerGrid())
+            or (header->_gridsPerLambda   != DbU::getGridsPerLambda()))
+      error = "DbU settings differs from the current ones";
+    if (not error.empty()) {
+      munmap( const_cast<char*>(_base), _size );
+      _base = NULL;
+      throw Error( "Snapshot::Snapshot(): \"%s\", %s.", _path.c_str(), error.c_str() );
+    }
+
+    _names .resize( header->_strings._size );
+    _layers.resize( header->_strings._size, NULL );
+    cdebug_log(18,0) << "Snapshot::Snapshot() " << _path << " " << _size << " bytes." << endl;
+  }
+
+
+  Snapshot::~Snapshot ()
+  {
+    for ( auto ipending : _pendings ) {
+      auto ilazy = _lazies.find( ipending.first );
+      if ((ilazy != _lazies.end()) and (ilazy->second == this)) _lazies.erase( ilazy );
+    }
+    if (_base) munmap( const_cast<char*>(_base), _size );
+  }
+
+
+  template< typename Entry >
+  inline const Entry* Snapshot::_getEntries ( uint64_t offset, uint64_t size ) const
+  {
+    if ((offset % 8) or (offset > _size) or (size > (_size - offset) / sizeof(Entry)))
+      throw Error( "Snapshot: \"%s\", corrupted section at offset %llu."
+                 , _path.c_str(), (unsigned long long)offset );
+    return reinterpret_cast<const Entry*>( _base + offset );
+  }
+
+
+  string  Snapshot::_getString ( uint32_t id ) const
+  {
+    const FileHeader*  header  = reinterpret_cast<const FileHeader*>( _base );
+    const StringEntry* strings = _getEntries<StringEntry>( header->_strings._offset, header->_strings._size );
+    const char*        chars   = _getEntries<char>       ( header->_chars  ._offset, header->_chars  ._size );
+    if (id >= header->_strings._size)
+      throw Error( "Snapshot: \"%s\", string index %u out of range.", _path.c_str(), id );
+    if ((uint64_t)strings[id]._offset + strings[id]._length > header->_chars._size)
+      throw Error( "Snapshot: \"%s\", corrupted string %u.", _path.c_str(), id );
+    return string( chars + strings[id]._offset, strings[id]._length );
+  }
+
+
+  const Name& Snapshot::_getName ( uint32_t id )
+  {
+    static Name noName;
+    if (id >= _names.size()) return noName;
+    if (_names[id].isEmpty()) {
+      string s = _getString( id );
+      _names[id] = Name( s.c_str(), s.size() );
+    }
+    return _names[id];
+  }
+
+
+  const Layer* Snapshot::_getLayer ( uint32_t id )
+  {
+    if (id >= _layers.size()) return NULL;
+    if (not _layers[id]) {
+      _layers[id] = DataBase::getDB()->getTechnology()->getLayer( _getName(id) );
+      if (not _layers[id])
+        throw Error( "Snapshot: \"%s\", no layer \"%s\" in the technology."
+                   , _path.c_str(), getString(_getName(id)).c_str() );
+    }
+    return _layers[id];
+  }
+
+
+  Cell* Snapshot::getTopCell () const
+  {
+    const FileHeader* header = reinterpret_cast<const FileHeader*>( _base );
+    return (header->_topCell < _cells.size()) ? _cells[ header->_topCell ] : NULL;
+  }
+
+
+  bool  Snapshot::hasComponents ( const Cell* cell ) const
+  { return (_pendings.find(cell) != _pendings.end()); }
+
+
+  Cell* Snapshot::loadNetlist ()
+  {
+    if (not _cells.empty()) return getTopCell();
+
+    const FileHeader* header = reinterpret_cast<const FileHeader*>( _base );
+    _cells    .reserve( header->_cells._size );
+    _nets     .resize ( header->_cells._size );
+    _instances.resize ( header->_cells._size );
+    _plugs    .resize ( header->_cells._size );
+
+    bool autoMaterialization = not Go::autoMaterializationIsDisabled();
+    Go::disableAutoMaterialization();
+    try {
+      for ( uint32_t id=0 ; id<header->_cells._size ; ++id )
+        _cells.push_back( _loadCell(id) );
+    }
+    catch ( ... ) {
+      if (autoMaterialization) Go::enableAutoMaterialization();
+      throw;
+    }
+    if (autoMaterialization) {
+      Go::enableAutoMaterialization();
+      for ( auto& instances : _instances ) {
+        for ( Instance* instance : instances ) {
+          if (instance->getPlacementStatus() != Instance::PlacementStatus::UNPLACED)
+            instance->materialize();
+        }
+      }
+    }
+    return getTopCell();
+  }
+
+
+  Cell* Snapshot::_loadCell ( uint32_t id )
+  {
+    const FileHeader* header  = reinterpret_cast<const FileHeader*>( _base );
+    const CellEntry&  entry   = _getEntries<CellEntry>( header->_cells._offset, header->_cells._size )[id];
+    DataBase*         db      = DataBase::getDB();
+    string            libPath = _getString( entry._library );
+
+    if (entry._flags & CellReference) {
+      Library* library = db->getLibrary( libPath, DataBase::NoFlags );
+      Cell*    cell    = (library) ? library->getCell( _getName(entry._name) ) : NULL;
+      if (not cell)
+        cell = db->getCell( libPath + SharedPath::getNameSeparator() + _getString(entry._name)
+                          , DataBase::NoFlags );
+      if (not cell)
+        throw Error( "Snapshot::loadNetlist(): \"%s\", referenced Cell \"%s\" not found in library \"%s\"."
+                   , _path.c_str(), _getString(entry._name).c_str(), libPath.c_str() );
+      return cell;
+    }
+
+    Library* library = db->getLibrary( libPath, DataBase::CreateLib|DataBase::WarnCreateLib );
+    Cell*    cell    = Cell::create( library, _getName(entry._name) );
+    if (not (entry._flags & CellEmptyAb))
+      cell->setAbutmentBox( Box( entry._abutmentBox[0], entry._abutmentBox[1]
+                               , entry._abutmentBox[2], entry._abutmentBox[3] ) );
+    cell->setFlags( entry._cellFlags & CellStateMask );
+
+    const NetEntry*      nentries = _getEntries<NetEntry     >( entry._nets     ._offset, entry._nets     ._size );
+    const InstanceEntry* ientries = _getEntries<InstanceEntry>( entry._instances._offset, entry._instances._size );
+    const PlugEntry*     pentries = _getEntries<PlugEntry    >( entry._plugs    ._offset, entry._plugs    ._size );
+    const uint32_t*      paths    = _getEntries<uint32_t     >( entry._paths    ._offset, entry._paths    ._size );
+    vector<Net*>&        nets     = _nets     [id];
+    vector<Instance*>&   insts    = _instances[id];
+    vector<Plug*>&       plugs    = _plugs    [id];
+
+    nets.resize( entry._nets._size, NULL );
+    for ( uint32_t inet=0 ; inet<entry._nets._size ; ++inet ) {
+      if (nentries[inet]._flags & NetDeep) continue;
+      nets[inet] = Net::create( cell, _getName(nentries[inet]._name) );
+    }
+
+    insts.reserve( entry._instances._size );
+    for ( uint32_t iinst=0 ; iinst<entry._instances._size ; ++iinst ) {
+      const InstanceEntry& ientry = ientries[iinst];
+      if (ientry._master >= id)
+        throw Error( "Snapshot::loadNetlist(): \"%s\", bad master Cell index %u for %s."
+                   , _path.c_str(), ientry._master, getString(cell).c_str() );
+      insts.push_back( Instance::create
+        ( cell
+        , _getName( ientry._name )
+        , _cells[ ientry._master ]
+        , Transformation( ientry._tx
+                        , ientry._ty
+                        , Transformation::Orientation((Transformation::Orientation::Code)ientry._orientation) )
+        , Instance::PlacementStatus( (Instance::PlacementStatus::Code)ientry._placementStatus )
+        , false ) );
+    }
+
+  // DeepNets are created after the instances as they are build upon an
+  // occurrence.
+    for ( uint32_t inet=0 ; inet<entry._nets._size ; ++inet ) {
+      const NetEntry& nentry = nentries[inet];
+      if (not (nentry._flags & NetDeep)) continue;
+      if ((uint64_t)nentry._path + nentry._pathSize > entry._paths._size)
+        throw Error( "Snapshot::loadNetlist(): \"%s\", bad path for DeepNet in %s."
+                   , _path.c_str(), getString(cell).c_str() );
+
+      Path  path;
+      Cell* master = cell;
+      for ( uint32_t i=0 ; i<nentry._pathSize ; ++i ) {
+        Instance* instance = master->getInstance( _getName(paths[nentry._path+i]) );
+        if (not instance) break;
+        path   = Path( path, instance );
+        master = instance->getMasterCell();
+      }
+      Net* rootNet = master->getNet( _getName(nentry._rootNet) );
+      if (not rootNet or (path.isEmpty())) {
+        cerr << Error( "Snapshot::loadNetlist(): \"%s\", cannot rebuild DeepNet \"%s\" in %s."
+                     , _path.c_str(), getString(_getName(nentry._name)).c_str(), getString(cell).c_str() ) << endl;
+        continue;
+      }
+      HyperNet hyperNet ( Occurrence(rootNet,path) );
+      nets[inet] = DeepNet::create( hyperNet );
+    }
+
+    for ( uint32_t inet=0 ; inet<entry._nets._size ; ++inet ) {
+      const NetEntry& nentry = nentries[inet];
+      Net*            net    = nets[inet];
+      if (not net) continue;
+      net->setType     ( Net::Type     ( (Net::Type::Code     )nentry._type      ) );
+      net->setDirection( Net::Direction( (Net::Direction::Code)nentry._direction ) );
+      net->setExternal ( nentry._flags & NetExternal  );
+      net->setGlobal   ( nentry._flags & NetGlobal    );
+      net->setAutomatic( nentry._flags & NetAutomatic );
+      if (nentry._flags & NetRouting) {
+        NetRoutingState* state = NetRoutingExtension::create( net, nentry._routingFlags );
+        state->setWPitch ( nentry._wPitch  );
+        state->setSymAxis( nentry._symAxis );
+        if (nentry._symNet < nets.size()) state->setSymNet( nets[nentry._symNet] );
+      }
+    }
+
+    plugs.reserve( entry._plugs._size );
+    for ( uint32_t iplug=0 ; iplug<entry._plugs._size ; ++iplug ) {
+      const PlugEntry& pentry    = pentries[iplug];
+      Instance*        instance  = (pentry._instance < insts.size()) ? insts[pentry._instance] : NULL;
+      Net*             net       = (pentry._net      < nets .size()) ? nets [pentry._net     ] : NULL;
+      Net*             masterNet = (instance) ? instance->getMasterCell()->getNet( _getName(pentry._masterNet) ) : NULL;
+      Plug*            plug      = (masterNet) ? instance->getPlug( masterNet ) : NULL;
+      if (not plug or not net) {
+        cerr << Error( "Snapshot::loadNetlist(): \"%s\", cannot connect plug \"%s\" in %s."
+                     , _path.c_str(), getString(_getName(pentry._masterNet)).c_str(), getString(cell).c_str() ) << endl;
+        plugs.push_back( NULL );
+        continue;
+      }
+      plug->setNet( net );
+      plugs.push_back( plug );
+    }
+
+    if (entry._components._size) _pendings.insert( std::make_pair(cell,id) );
+    return cell;
+  }
+
+
+  void  Snapshot::loadComponents ()
+  {
+    for ( uint32_t id=0 ; id<_cells.size() ; ++id ) {
+      if (hasComponents(_cells[id])) _loadComponents( id );
+    }
+  }
+
+
+  void  Snapshot::loadComponents ( Cell* cell )
+  {
+    auto ipending = _pendings.find( cell );
+    if (ipending != _pendings.end()) _loadComponents( ipending->second );
+  }
+
+
+  void  Snapshot::_loadComponents ( uint32_t id )
+  {
+    Cell* cell = _cells[id];
+    _release( cell );
+
+  // RoutingPads may refer to components of the masters.
+    for ( Instance* instance : _instances[id] ) loadComponents( instance->getMasterCell() );
+
+    const FileHeader*     header   = reinterpret_cast<const FileHeader*>( _base );
+    const CellEntry&      entry    = _getEntries<CellEntry>( header->_cells._offset, header->_cells._size )[id];
+    const ComponentEntry* centries = _getEntries<ComponentEntry>( entry._components._offset, entry._components._size );
+    const uint32_t*       paths    = _getEntries<uint32_t>      ( entry._paths     ._offset, entry._paths     ._size );
+    const PointEntry*     points   = _getEntries<PointEntry>    ( entry._points    ._offset, entry._points    ._size );
+    const vector<Net*>&   nets     = _nets [id];
+    const vector<Plug*>&  plugs    = _plugs[id];
+    vector<Component*>    components ( entry._components._size, NULL );
+
+    bool autoMaterialization = not Go::autoMaterializationIsDisabled();
+    Go::disableAutoMaterialization();
+
+    auto getPoints = [&]( const ComponentEntry& centry ) -> vector<Point>
+      {
+        vector<Point> contour;
+        uint64_t      begin = centry._values[0];
+        uint64_t      size  = centry._values[1];
+        if ((begin > entry._points._size) or (size > entry._points._size - begin))
+          throw Error( "Snapshot::loadComponents(): \"%s\", bad points for a component of %s."
+                     , _path.c_str(), getString(cell).c_str() );
+        contour.reserve( size );
+        for ( uint64_t i=begin ; i<begin+size ; ++i )
+          contour.push_back( Point( points[i]._x, points[i]._y ));
+        return contour;
+      };
+
+  // Components are first created unanchored, with their raw (relative)
+  // coordinates, then hooked up in a second pass. So the records order
+  // is not constrained.
+    for ( size_t i=0 ; i<components.size() ; ++i ) {
+      const ComponentEntry& centry = centries[i];
+      Net*                  net    = (centry._net < nets.size()) ? nets[centry._net] : NULL;
+      if (not net) continue;
+
+      switch ( centry._kind ) {
+        case KindContact:
+          components[i] = Contact::create( net, _getLayer(centry._layer)
+                                         , centry._values[0], centry._values[1]
+                                         , centry._values[2], centry._values[3] );
+          break;
+        case KindPin:
+          components[i] = Pin::create( net
+                                     , _getName(centry._name)
+                                     , Pin::AccessDirection( (Pin::AccessDirection::Code)centry._flags  )
+                                     , Pin::PlacementStatus( (Pin::PlacementStatus::Code)centry._status )
+                                     , _getLayer(centry._layer)
+                                     , centry._values[0], centry._values[1]
+                                     , centry._values[2], centry._values[3] );
+          break;
+        case KindHorizontal:
+          components[i] = Horizontal::create( net, _getLayer(centry._layer)
+                                            , centry._values[0], centry._values[1]
+                                            , centry._values[2], centry._values[3] );
+          break;
+        case KindVertical:
+          components[i] = Vertical::create( net, _getLayer(centry._layer)
+                                          , centry._values[0], centry._values[1]
+                                          , centry._values[2], centry._values[3] );
+          break;
+        case KindPad:
+          components[i] = Pad::create( net, _getLayer(centry._layer)
+                                     , Box( centry._values[0], centry._values[1]
+                                          , centry._values[2], centry._values[3] ) );
+          break;
+        case KindDiagonal:
+          components[i] = Diagonal::create( net, _getLayer(centry._layer)
+                                          , Point( centry._values[0], centry._values[1] )
+                                          , Point( centry._values[2], centry._values[3] )
+                                          , centry._values[4] );
+          break;
+        case KindPolygon:
+          components[i] = Polygon::create( net, _getLayer(centry._layer), getPoints(centry) );
+          break;
+        case KindRectilinear:
+          components[i] = Rectilinear::create( net, _getLayer(centry._layer), getPoints(centry) );
+          break;
+      }
+    }
+
+    for ( size_t i=0 ; i<components.size() ; ++i ) {
+      const ComponentEntry& centry = centries[i];
+      Net*                  net    = (centry._net < nets.size()) ? nets[centry._net] : NULL;
+      if ((centry._kind != KindRoutingPad) or not net) continue;
+
+      Occurrence occurrence;
+      if (centry._status == EntityLocal) {
+        if (centry._source < components.size() and components[centry._source])
+          occurrence = Occurrence( components[centry._source] );
+      } else if ((uint64_t)centry._path + centry._pathSize <= entry._paths._size) {
+        Path  path;
+        Cell* master = cell;
+        for ( uint32_t j=0 ; j<centry._pathSize and master ; ++j ) {
+          Instance* instance = master->getInstance( _getName(paths[centry._path+j]) );
+          if (instance) path = Path( path, instance );
+          master = (instance) ? instance->getMasterCell() : NULL;
+        }
+        if (master and (centry._status == EntityPlug)) {
+          Instance* instance  = master->getInstance( _getName(centry._name) );
+          Net*      masterNet = (instance) ? instance->getMasterCell()->getNet( _getName(centry._entityNet) ) : NULL;
+          Plug*     plug      = (masterNet) ? instance->getPlug( masterNet ) : NULL;
+          if (plug) occurrence = Occurrence( plug, path );
+        } else if (master) {
+          Net*         entityNet = master->getNet( _getName(centry._entityNet) );
+          const Layer* layer     = _getLayer( centry._layer );
+          Box          bb        ( centry._values[0], centry._values[1], centry._values[2], centry._values[3] );
+          if (entityNet) {
+            for ( Component* component : entityNet->getComponents() ) {
+              if (dynamic_cast<Plug*>(component)) continue;
+              if ((component->getLayer() == layer) and (component->getBoundingBox() == bb)) {
+                occurrence = Occurrence( component, path );
+                break;
+              }
+            }
+          }
+        }
+      }
+      if (not occurrence.isValid()) {
+        cerr << Error( "Snapshot::loadComponents(): \"%s\", cannot rebuild RoutingPad occurrence on %s in %s."
+                     , _path.c_str(), getString(net).c_str(), getString(cell).c_str() ) << endl;
+        continue;
+      }
+
+      RoutingPad* rp = RoutingPad::create( net, occurrence, 0 );
+      rp->unsetFlags( rp->getFlags() );
+      rp->setFlags  ( centry._flags );
+      if (centry._flags & RoutingPad::UserCenter)
+        rp->setUserCenter( Point(centry._values[4],centry._values[5]) );
+      components[i] = rp;
+    }
+
+    auto getAnchor = [&]( uint32_t index ) -> Component*
+      {
+        if (index == NoIndex) return NULL;
+        if (index & PlugAnchor) {
+          index &= ~PlugAnchor;
+          return (index < plugs.size()) ? plugs[index] : NULL;
+        }
+        return (index < components.size()) ? components[index] : NULL;
+      };
+
+    for ( size_t i=0 ; i<components.size() ; ++i ) {
+      const ComponentEntry& centry = centries[i];
+      if (not components[i]) continue;
+
+      Component* source = getAnchor( centry._source );
+      Component* target = getAnchor( centry._target );
+      switch ( centry._kind ) {
+        case KindContact:
+        case KindPin:
+          if (source) static_cast<Contact*>(components[i])->getAnchorHook()->attach( source->getBodyHook() );
+          break;
+        case KindHorizontal:
+        case KindVertical:
+          if (source) static_cast<Segment*>(components[i])->getSourceHook()->attach( source->getBodyHook() );
+          if (target) static_cast<Segment*>(components[i])->getTargetHook()->attach( target->getBodyHook() );
+          break;
+      }
+      if ((centry._properties & ComponentExternal) and components[i]->getNet()->isExternal())
+        NetExternalComponents::setExternal( components[i] );
+    }
+
+    if (autoMaterialization) {
+      Go::enableAutoMaterialization();
+      for ( Component* component : components ) {
+        if (component) component->materialize();
+      }
+    }
+  }
+
+
+}  // Hurricane namespace.
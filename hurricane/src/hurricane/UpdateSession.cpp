@@ -17,10 +17,17 @@
 // not, see <http://www.gnu.org/licenses/>.
 // ****************************************************************************************************
 
+#include <atomic>
+#include <thread>
+#include <unordered_map>
 #include "hurricane/UpdateSession.h"
 #include "hurricane/Go.h"
 #include "hurricane/Cell.h"
+#include "hurricane/DataBase.h"
 #include "hurricane/Instance.h"
+#include "hurricane/Component.h"
+#include "hurricane/QuadTree.h"
+#include "hurricane/PackedRTree.h"
 #include "hurricane/Error.h"
 
 namespace Hurricane {
@@ -33,9 +40,14 @@ namespace Hurricane {
 
 stack<UpdateSession*>* UPDATOR_STACK = NULL;
 
-UpdateSession::UpdateSession()
-// ***************************
-:    Inherit()
+unsigned int UpdateSession::_threads = 1;
+
+UpdateSession::UpdateSession(unsigned int flags)
+// *********************************************
+:    Inherit(),
+    _flags(flags),
+    _gos(),
+    _releaseds()
 { }
 
 void UpdateSession::destroy()
@@ -51,10 +63,16 @@ const Name& UpdateSession::getPropertyName()
     return NAME;
 }
 
-UpdateSession* UpdateSession::_create()
-// ************************************
+void UpdateSession::setThreads(unsigned int threads)
+// *************************************************
+{
+    _threads = (threads) ? threads : 1;
+}
+
+UpdateSession* UpdateSession::_create(unsigned int flags)
+// ******************************************************
 {
-    UpdateSession* updateSession = new UpdateSession();
+    UpdateSession* updateSession = new UpdateSession(flags);
 
     updateSession->_postCreate();
 
@@ -88,6 +106,8 @@ void UpdateSession::_destroy()
 
     UPDATOR_STACK->pop();
 
+    if (isBulk()) _materializeBulk();
+
     vector<Cell*> changedCells;
     for ( DBo* owner : getOwners() ) {
       Cell* cell = dynamic_cast<Cell*>(owner);
@@ -110,6 +130,81 @@ void UpdateSession::_destroy()
     Inherit::_preDestroy();
   }
 
+// In bulk mode the invalidated Gos are not kept in the owner set of
+// the SharedProperty but stacked in _gos, the ones released before
+// the end of the session (that is, destroyed) being recorded in
+// _releaseds. At the end, the Gos are grouped by the QuadTree they
+// belong to and inserted tree by tree. The Slices are created and
+// the bounding boxes computed sequentially first, so the insertions
+// only modify their own root QuadTree. The Slices QuadTrees are
+// filled concurrently, not the Cell ones: exploding a node computes
+// the bounding box of Instances, which may lazily compute the one of
+// a master Cell shared between two trees.
+void UpdateSession::_materializeBulk()
+// ***********************************
+{
+    struct Batch {
+        Cell*       _cell;
+        QuadTree*   _quadTree;
+        bool        _concurrent;
+        vector<Go*> _gos;
+        vector<Box> _boundingBoxes;
+    };
+
+    vector<Batch> batches;
+    unordered_map<QuadTree*,size_t> batchIndexes;
+    for (Go* go : _gos) {
+        if (_releaseds.find(go) != _releaseds.end()) continue;
+        if (go->getProperty(getPropertyName()) != this) continue; // Duplicate.
+        go->_onDestroyed(this);
+
+        if (go->isMaterialized()) continue;
+        QuadTree* quadTree = go->_getMaterializationQuadTree();
+        if (!quadTree) {
+            go->materialize();
+            continue;
+        }
+        auto ibatch = batchIndexes.find(quadTree);
+        if (ibatch == batchIndexes.end()) {
+            ibatch = batchIndexes.insert(make_pair(quadTree, batches.size())).first;
+            batches.push_back(Batch {go->getCell(), quadTree, (dynamic_cast<Component*>(go) != NULL), {}, {}});
+        }
+        Batch& batch = batches[ibatch->second];
+        batch._gos.push_back(go);
+        batch._boundingBoxes.push_back(go->getBoundingBox());
+    }
+    cdebug_log(18,0) << "UpdateSession::_materializeBulk() " << _gos.size() << " Gos, "
+                     << batches.size() << " QuadTrees." << endl;
+    vector<Go*>().swap(_gos);
+    _releaseds.clear();
+
+    size_t concurrents = 0;
+    for (Batch& batch : batches) {
+        if (batch._concurrent and (_threads > 1)) ++concurrents;
+        else batch._quadTree->_insert(batch._gos, batch._boundingBoxes);
+    }
+    if (concurrents) {
+        std::atomic<size_t> next (0);
+        auto worker = [&]() {
+            for (size_t i=next++ ; i<batches.size() ; i=next++) {
+                if (batches[i]._concurrent)
+                    batches[i]._quadTree->_insert(batches[i]._gos, batches[i]._boundingBoxes);
+            }
+        };
+        vector<std::thread> workers;
+        for (size_t i=1 ; i<std::min((size_t)_threads, concurrents) ; ++i)
+            workers.push_back(std::thread(worker));
+        worker();
+        for (std::thread& thread : workers) thread.join();
+    }
+
+    for (Batch& batch : batches) {
+        QuadTree* quadTree = batch._quadTree;
+        if (quadTree->hasRTree() && quadTree->getRTree()->needsRebuild()) quadTree->_queueRTree();
+        batch._cell->_fit(quadTree->getBoundingBox());
+    }
+}
+
 string UpdateSession::_getString() const
 // *************************************
 {
@@ -128,12 +223,32 @@ Record* UpdateSession::_getRecord() const
 void UpdateSession::onCapturedBy(DBo* owner)
 // *****************************************
 {
-    if ( not dynamic_cast<Go*>(owner) and not dynamic_cast<Cell*>(owner) )
+    Go* go = dynamic_cast<Go*>(owner);
+    if ( not go and not dynamic_cast<Cell*>(owner) )
       throw Error( "Bad update session capture : not a graphic object (Go) or a Cell" );
-    
+
+    if (go and isBulk()) {
+      _gos.push_back(go);
+    // Same address as a destroyed Go, it is a new one.
+      if (not _releaseds.empty()) _releaseds.erase(go);
+      return;
+    }
     Inherit::onCapturedBy(owner);
   }
 
+void UpdateSession::onReleasedBy(DBo* owner)
+// *****************************************
+{
+    if (isBulk()) {
+      Go* go = dynamic_cast<Go*>(owner);
+      if (go) {
+        _releaseds.insert(go);
+        return;
+      }
+    }
+    Inherit::onReleasedBy(owner);
+}
+
 void UpdateSession::onNotOwned()
 // *****************************
 { }
@@ -187,11 +302,14 @@ void Go::invalidate(bool propagateFlag)
   cdebug_log(18,0) << "Go::invalidate(" << this << ") - Completed." << endl;
 }
 
-void UpdateSession::open()
-// ***********************
+void UpdateSession::open(unsigned int flags)
+// *****************************************
 {
+  if (DataBase::isFrozen())
+    throw Error("Can't open update session : the DataBase is frozen");
+
   cdebug_log(18,1) << "UpdateSession::open() [stack=" << (UPDATOR_STACK->size()+1) << "]" << endl;
-  UpdateSession::_create();
+  UpdateSession::_create(flags);
 }
 
 void UpdateSession::close()
@@ -204,6 +322,7 @@ void UpdateSession::close()
     throw Error("Can't end update : empty update session stack");
 
   UPDATOR_STACK->top()->_destroy();
+  if (UPDATOR_STACK->empty()) QuadTree::buildRTrees();
 
   cdebug_tabw(18,-1);
   cdebug_log(18,0) << "UpdateSession::close() [stack:" << UPDATOR_STACK->size() << "] Materialization completed." << endl;
@@ -51,6 +51,7 @@
 namespace Hurricane {
 
 class Library;
+class HyperNetIndex;
 class BasicLayer;
 
 typedef  multimap<Entity*,Entity*>  SlaveEntityMap;
@@ -84,7 +85,9 @@ class Cell : public Entity {
                   , CellAboutToChange       = (1 << 10)
                   , CellChanged             = (1 << 11)
                   , CellDestroyed           = (1 << 12)
+                  , NetlistChanged          = (1 << 13)
                   // Cell states
+                  , RTreeIndex              = (1 << 19)
                   , TerminalNetlist         = (1 << 20)
                   , Pad                     = (1 << 21)
                   , Feed                    = (1 << 22)
@@ -279,6 +282,9 @@ class Cell : public Entity {
 
     };
 
+    public: typedef IntrusiveRange<InstanceMap,Instance> InstanceRange;
+    public: typedef IntrusiveRange<NetMap,Net> NetRange;
+
     class PinMap : public IntrusiveMap<Name, Pin> {
     // *******************************************
 
@@ -341,6 +347,7 @@ class Cell : public Entity {
     private: SlaveEntityMap _slaveEntityMap;
     private: AliasNameSet _netAliasSet;
     private: Observable _observers;
+    private: HyperNetIndex* _hyperNetIndex;
     private: Flags _flags;
 
 // Constructors
@@ -413,9 +420,11 @@ class Cell : public Entity {
     public: const Flags& getFlags() const { return _flags; } 
     public: Flags& getFlags() { return _flags; } 
     public: Path getShuntedPath() const { return _shuntedPath; }
+    public: HyperNetIndex* getHyperNetIndex() const { return _hyperNetIndex; }
     public: Entity* getEntity(const Signature&) const;
     public: Instance* getInstance(const Name& name) const {return _instanceMap.getElement(name);};
     public: Instances getInstances() const {return _instanceMap.getElements();};
+    public: InstanceRange getInstanceRange() const {return InstanceRange(&_instanceMap);};
     public: Instances getPlacedInstances() const;
     public: Instances getFixedInstances() const;
     public: Instances getUnplacedInstances() const;
@@ -437,6 +446,7 @@ class Cell : public Entity {
     public: Net* getNet(const Name& name, bool useAlias=true) const;
     public: DeepNet* getDeepNet( Path, const Net* ) const;
     public: Nets getNets() const {return _netMap.getElements();};
+    public: NetRange getNetRange() const {return NetRange(&_netMap);};
     public: Nets getGlobalNets() const;
     public: Nets getExternalNets() const;
     public: Nets getInternalNets() const;
@@ -495,6 +505,8 @@ class Cell : public Entity {
     public: bool isAbstractedSupply() const {return _flags.isset(Flags::AbstractedSupply);};
     public: bool isPlaced() const {return _flags.isset(Flags::Placed);};
     public: bool isRouted() const {return _flags.isset(Flags::Routed);};
+    public: bool isRTreeIndexed() const {return _flags.isset(Flags::RTreeIndex);};
+    public: bool isHyperNetIndexed() const {return (_hyperNetIndex != NULL);};
     public: bool isExtractConsistent() const {return not _flags.isset(Flags::NoExtractConsistent);};
     public: bool isNetAlias(const Name& name) const;
 
@@ -511,6 +523,8 @@ class Cell : public Entity {
     public: void setDiode(bool state) {_flags.set(Flags::Diode,state);};
     public: void setPowerFeed(bool state) {_flags.set(Flags::PowerFeed,state);};
     public: void setRouted(bool state) {_flags.set(Flags::Routed,state);};
+    public: void setRTreeIndex(bool state);
+    public: void setHyperNetIndex(bool state);
     public: void setAbstractedSupply(bool state) { _flags.set(Flags::AbstractedSupply,state); };
     public: void setNoExtractConsistent(bool state) { _flags.set(Flags::NoExtractConsistent,state); };
     public: void flattenNets(uint64_t flags=Flags::BuildRings);
@@ -1120,7 +1120,7 @@ extern tstream  cdebug;
 
 
 #define  cdebug_log(level,indent)   if (cdebug.enabled(level)) cdebug.log(level,indent)
-#define  cdebug_tabw(level,indent)  cdebug.tabw(level,indent)
+#define  cdebug_tabw(level,indent)  if (cdebug.enabled(level)) cdebug.tabw(level,indent)
 
 
 // x-----------------------------------------------------------------x
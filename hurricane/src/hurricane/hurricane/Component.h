@@ -115,6 +115,7 @@ namespace Hurricane {
       virtual       void            materialize               ();
       virtual       void            unmaterialize             ();
       virtual       void            invalidate                ( bool propagateFlag = true );
+      virtual       QuadTree*       _getMaterializationQuadTree ();
       virtual       void            forceId                   ( unsigned int id );
     // Filters                                                
       static        ComponentFilter getIsUnderFilter          ( const Box& area );
@@ -34,6 +34,7 @@
 #include "hurricane/DBos.h"
 #include "hurricane/Name.h"
 #include "hurricane/Properties.h"
+#include "hurricane/PropertyVector.h"
 
 
 namespace Hurricane {
@@ -60,10 +61,10 @@ namespace Hurricane {
       static  void               useIdCounter2       ();
     public:
       virtual void               destroy             ();
-      inline  set<Property*>&    _getPropertySet     ();
+      inline  PropertyVector&    _getPropertySet     ();
               void               _onDestroyed        ( Property* property );
       inline  unsigned int       getId               () const;
-              Property*          getProperty         ( const Name& ) const;
+      inline  Property*          getProperty         ( const Name& ) const;
               Properties         getProperties       () const;
       inline  bool               hasProperty         () const;
               void               setId               ( unsigned int );
@@ -95,7 +96,7 @@ namespace Hurricane {
       static  unsigned int       _idCounter;
       static  unsigned int       _idCounterLimit;
               unsigned int       _id;
-      mutable set<Property*>     _propertySet;
+      mutable PropertyVector     _propertySet;
     public:
       struct CompareById {
           template<typename Key>
@@ -105,9 +106,10 @@ namespace Hurricane {
 
 
 // Inline Functions.
-  inline set<Property*>& DBo::_getPropertySet () { return _propertySet; }
+  inline PropertyVector& DBo::_getPropertySet () { return _propertySet; }
   inline bool            DBo::hasProperty     () const { return !_propertySet.empty(); }
   inline unsigned int    DBo::getId           () const { return _id; }
+  inline Property*       DBo::getProperty     ( const Name& name ) const { return _propertySet.find( name ); }
 
   template<typename Key>
   inline bool  DBo::CompareById::operator() ( const Key* lhs, const Key* rhs ) const
@@ -52,8 +52,10 @@ class DataBase : public DBo {
 // **********
 
     private: static DataBase* _db;
+    private: static bool _frozen;
     private: Technology* _technology;
     private: Library* _rootLibrary;
+    private: bool _sharedNameConcurrent;
     private: function<Hurricane::Cell*(string)> _cellLoader;
 
 // Constructors
@@ -82,12 +84,15 @@ class DataBase : public DBo {
 // Accessors
 // *********
 
+    public: static bool isFrozen() {return _frozen;};
     public: Technology* getTechnology() const {return _technology;};
     public: Library* getRootLibrary() const {return _rootLibrary;};
     public: Library* getLibrary(string,unsigned int flags);
     public: Cell* getCell(string, unsigned int flags);
     public: Cell* getCell(string);
     public: void  clear();
+    public: void  freeze();
+    public: void  unfreeze();
     public: static DataBase* getDB();
 
 };
@@ -74,6 +74,8 @@ class Go : public Entity {
 
     public: virtual void invalidate(bool propagateFlag = true);
               // implementation located on file UpdateSession.cpp to access local variables
+    public: virtual QuadTree* _getMaterializationQuadTree();
+              // QuadTree materialize() would insert into, NULL if materialize() must be called
 
     public: virtual void translate(const DbU::Unit& dx, const DbU::Unit& dy) = 0;
     public: virtual void translate(const Point& );
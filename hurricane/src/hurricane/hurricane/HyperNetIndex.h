@@ -0,0 +1,218 @@
+// -*- C++ -*-
+//
+// Copyright (c) Sorbonne Université 2024-2024, All Rights Reserved
+//
+// This file is part of Hurricane.
+//
+// Hurricane is free software: you can redistribute it  and/or  modify
+// it under the terms of the GNU  Lesser  General  Public  License  as
+// published by the Free Software Foundation, either version 3 of  the
+// License, or (at your option) any later version.
+//
+// Hurricane is distributed in the hope that it will  be  useful,  but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHAN-
+// TABILITY or FITNESS FOR A PARTICULAR PURPOSE. See  the  Lesser  GNU
+// General Public License for more details.
+//
+// You should have received a copy of the Lesser  GNU  General  Public
+// License along with Hurricane. If not, see
+//                                     <http://www.gnu.org/licenses/>.
+//
+// +-----------------------------------------------------------------+
+// |                  H U R R I C A N E                              |
+// |     V L S I   B a c k e n d   D a t a - B a s e                 |
+// |                                                                 |
+// |  Author      :                    Jean-Paul Chaput              |
+// |  E-mail      :            Jean-Paul.Chaput@lip6.fr              |
+// | =============================================================== |
+// |  C++ Header  :  "./hurricane/HyperNetIndex.h"                   |
+// +-----------------------------------------------------------------+
+
+
+#pragma  once
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include "hurricane/Observer.h"
+#include "hurricane/Path.h"
+#include "hurricane/Occurrences.h"
+
+
+namespace Hurricane {
+
+  class Cell;
+  class Entity;
+
+
+// -------------------------------------------------------------------
+// Class  :  "Hurricane::HyperNetIndex".
+//
+// Flattened connectivity of a Cell hierarchy, for fast HyperNet
+// queries. All the net occurrences reachable through the plugs
+// (down to, and including, the terminal netlist cells) are merged
+// by a union-find, then each hyper net is stored as a contiguous
+// slice of net occurrences and of terminal netlist plug occurrences.
+// The hyper net id is the index of it's slices.
+//
+// The index observes every Cell of the hierarchy and is maintained
+// event by event (see HyperNetIndex::notify()). A netlist change
+// only kills the hyper nets it touches, their net occurrences are
+// kept as seeds and lazily flooded again, into new slices appended
+// at the end, on the next query. The other hyper nets keep their id.
+// Events without details (master Cell change) and Cell destruction
+// invalidate the whole index, which is then rebuilt on the next
+// query, as it is when the dead slices outweigh the live ones.
+// Net occurrences never connected since the last update are simply
+// not found (NoId), the callers must then fall back on the
+// hierarchical walk. As for the Locators, the netlist must not be
+// modified while iterating over a slice.
+
+  class HyperNetIndex {
+    public:
+      static const uint32_t  NoId = (uint32_t)-1;
+      enum Event { NoEvent           = 0
+                 , NetChanged        = 1
+                 , NetDestroyed      = 2
+                 , PlugChanged       = 3
+                 , InstanceCreated   = 4
+                 , InstanceDestroyed = 5
+                 };
+    public:
+      class Slice : public Collection<Occurrence> {
+        public:
+          typedef Collection<Occurrence>  Inherit;
+        public:
+          class Locator : public Hurricane::Locator<Occurrence> {
+            public:
+              inline                                Locator    ( const Occurrence* begin, const Occurrence* end );
+              virtual Occurrence                    getElement () const;
+              virtual Hurricane::Locator<Occurrence>* getClone () const;
+              virtual bool                          isValid    () const;
+              virtual void                          progress   ();
+              virtual std::string                   _getString () const;
+            private:
+              const Occurrence* _current;
+              const Occurrence* _end;
+          };
+        public:
+          inline                                Slice       ( const Occurrence* begin=NULL, const Occurrence* end=NULL );
+          virtual Collection<Occurrence>*       getClone    () const;
+          virtual Hurricane::Locator<Occurrence>* getLocator() const;
+          virtual unsigned                      getSize     () const;
+          virtual std::string                   _getString  () const;
+        private:
+          const Occurrence* _begin;
+          const Occurrence* _end;
+      };
+    private:
+      class CellWatch final : public BaseObserver {
+        public:
+          inline               CellWatch ( HyperNetIndex*, Cell* );
+          inline Cell*         getCell   () const;
+          virtual void         notify    ( unsigned int flags );
+        private:
+          HyperNetIndex* _index;
+          Cell*          _cell;
+      };
+      struct Range {
+        uint32_t  netBegin;
+        uint32_t  netEnd;
+        uint32_t  plugBegin;
+        uint32_t  plugEnd;
+      };
+    public:
+      static void            notify                           ( Cell*, Event, Entity* );
+    public:
+                             HyperNetIndex                    ( Cell* );
+                            ~HyperNetIndex                    ();
+      inline Cell*           getCell                          () const;
+      inline bool            isValid                          () const;
+      inline bool            isUpToDate                       () const;
+      inline void            invalidate                       ();
+             void            update                           ();
+             uint32_t        getHyperNetId                    ( const Occurrence& netOccurrence );
+      inline size_t          getHyperNetsSize                 () const;
+      inline size_t          getNetOccurrencesSize            () const;
+      inline Occurrences     getNetOccurrences                ( uint32_t id ) const;
+      inline Occurrences     getTerminalNetlistPlugOccurrences( uint32_t id ) const;
+             std::string     _getTypeName                     () const;
+             std::string     _getString                       () const;
+             Record*         _getRecord                       () const;
+    private:
+             void            _watch                           ( Cell* );
+             void            _clear                           ();
+             void            _rebuild                         ();
+             void            _flood                           ( const Occurrence& seed );
+             void            _kill                            ( const Occurrence& netOccurrence );
+             void            _getSubTree                      ( Cell*, const Path&, std::vector< std::pair<Cell*,Path> >& );
+             void            _onEvent                         ( Cell*, Event, Entity* );
+    private:
+                             HyperNetIndex                    ( const HyperNetIndex& );
+             HyperNetIndex&  operator=                        ( const HyperNetIndex& );
+    private:
+      static Event                                 _event;
+      static Entity*                               _eventEntity;
+      Cell*                                        _cell;
+      std::unordered_map<Cell*,CellWatch*>         _watches;
+      std::unordered_map<Cell*,std::vector<Path>>  _cellPaths;
+      std::unordered_map<Occurrence,uint32_t>      _netIds;
+      std::vector<Occurrence>                      _netOccurrences;
+      std::vector<Occurrence>                      _plugOccurrences;
+      std::vector<Range>                           _ranges;
+      std::unordered_set<Occurrence>               _seeds;
+      size_t                                       _garbage;
+      bool                                         _valid;
+  };
+
+
+  inline HyperNetIndex::Slice::Locator::Locator ( const Occurrence* begin, const Occurrence* end )
+    : Hurricane::Locator<Occurrence>()
+    , _current(begin)
+    , _end    (end)
+  { }
+
+
+  inline HyperNetIndex::Slice::Slice ( const Occurrence* begin, const Occurrence* end )
+    : Inherit()
+    , _begin(begin)
+    , _end  (end)
+  { }
+
+
+  inline HyperNetIndex::CellWatch::CellWatch ( HyperNetIndex* index, Cell* cell )
+    : BaseObserver()
+    , _index(index)
+    , _cell (cell)
+  { }
+
+
+  inline Cell*   HyperNetIndex::CellWatch::getCell        () const { return _cell; }
+  inline Cell*   HyperNetIndex::getCell                   () const { return _cell; }
+  inline bool    HyperNetIndex::isValid                   () const { return _valid; }
+  inline bool    HyperNetIndex::isUpToDate                () const { return _valid and _seeds.empty(); }
+  inline void    HyperNetIndex::invalidate                () { _valid = false; }
+  inline size_t  HyperNetIndex::getHyperNetsSize          () const { return _ranges.size(); }
+  inline size_t  HyperNetIndex::getNetOccurrencesSize     () const { return _netOccurrences.size() - _garbage; }
+
+
+  inline Occurrences  HyperNetIndex::getNetOccurrences ( uint32_t id ) const
+  {
+    if (id >= getHyperNetsSize()) return Slice();
+    return Slice( _netOccurrences.data() + _ranges[id].netBegin
+                , _netOccurrences.data() + _ranges[id].netEnd );
+  }
+
+
+  inline Occurrences  HyperNetIndex::getTerminalNetlistPlugOccurrences ( uint32_t id ) const
+  {
+    if (id >= getHyperNetsSize()) return Slice();
+    return Slice( _plugOccurrences.data() + _ranges[id].plugBegin
+                , _plugOccurrences.data() + _ranges[id].plugEnd );
+  }
+
+
+}  // Hurricane namespace.
+
+
+INSPECTOR_P_SUPPORT(Hurricane::HyperNetIndex);
@@ -158,6 +158,7 @@ class Instance : public Go {
     public: virtual void materialize();
     public: virtual void unmaterialize();
     public: virtual void invalidate(bool propagateFlag = true);
+    public: virtual QuadTree* _getMaterializationQuadTree();
     public: virtual void translate(const DbU::Unit& dx, const DbU::Unit& dy);
 
     public: void setName(const Name& name);
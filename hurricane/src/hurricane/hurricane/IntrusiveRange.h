@@ -0,0 +1,256 @@
+// -*- C++ -*-
+//
+// Copyright (c) Sorbonne Université 2024-2024, All Rights Reserved
+//
+// This file is part of Hurricane.
+//
+// Hurricane is free software: you can redistribute it  and/or  modify
+// it under the terms of the GNU  Lesser  General  Public  License  as
+// published by the Free Software Foundation, either version 3 of  the
+// License, or (at your option) any later version.
+//
+// Hurricane is distributed in the hope that it will  be  useful,  but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHAN-
+// TABILITY or FITNESS FOR A PARTICULAR PURPOSE. See  the  Lesser  GNU
+// General Public License for more details.
+//
+// You should have received a copy of the Lesser  GNU  General  Public
+// License along with Hurricane. If not, see
+//                                     <http://www.gnu.org/licenses/>.
+//
+// +-----------------------------------------------------------------+
+// |                  H U R R I C A N E                              |
+// |     V L S I   B a c k e n d   D a t a - B a s e                 |
+// |                                                                 |
+// |  Author      :                    Jean-Paul Chaput              |
+// |  E-mail      :            Jean-Paul.Chaput@lip6.fr              |
+// | =============================================================== |
+// |  C++ Header  :  "./hurricane/IntrusiveRange.h"                  |
+// +-----------------------------------------------------------------+
+
+
+#pragma  once
+#include <iterator>
+
+
+namespace Hurricane {
+
+
+// -------------------------------------------------------------------
+// Class  :  "Hurricane::IntrusiveRange".
+//
+// Light weight alternative to the Collection/Locator iteration over
+// the intrusive containers (IntrusiveSet, IntrusiveMap and
+// IntrusiveMapConst), meant for range based for loops only:
+//
+//     for ( Net* net : cell->getNetRange() ) { ... }
+//
+// The range and it's iterator live on the stack (no clone, no heap
+// allocation) and the chaining function is called through the
+// concrete container type, so it is not virtually dispatched.
+// As for the Locators, the container must not be modified during
+// the iteration.
+
+  template< typename Container, typename Element >
+  class IntrusiveRange {
+    public:
+      class iterator {
+        public:
+          typedef std::forward_iterator_tag  iterator_category;
+          typedef Element*                   value_type;
+          typedef std::ptrdiff_t             difference_type;
+          typedef Element**                  pointer;
+          typedef Element*&                  reference;
+        public:
+          inline           iterator   ( const Container* container=NULL );
+          inline Element*  operator*  () const;
+          inline iterator& operator++ ();
+          inline bool      operator== ( const iterator& other ) const;
+          inline bool      operator!= ( const iterator& other ) const;
+        private:
+          inline void      _nextBucket ();
+        private:
+          const Container* _container;
+          unsigned         _index;
+          Element*         _element;
+      };
+    public:
+      inline           IntrusiveRange ( const Container* );
+      inline iterator  begin          () const;
+      inline iterator  end            () const;
+      inline bool      empty          () const;
+    private:
+      const Container* _container;
+  };
+
+
+  template< typename Container, typename Element >
+  inline IntrusiveRange<Container,Element>::iterator::iterator ( const Container* container )
+    : _container(container)
+    , _index    (0)
+    , _element  (NULL)
+  { if (_container) _nextBucket(); }
+
+
+  template< typename Container, typename Element >
+  inline void  IntrusiveRange<Container,Element>::iterator::_nextBucket ()
+  {
+    unsigned  length = _container->_getLength();
+    Element** array  = _container->_getArray();
+    while ( (_index < length) and not (_element = array[_index++]) );
+  }
+
+
+  template< typename Container, typename Element >
+  inline Element* IntrusiveRange<Container,Element>::iterator::operator* () const
+  { return _element; }
+
+
+  template< typename Container, typename Element >
+  inline typename IntrusiveRange<Container,Element>::iterator&
+  IntrusiveRange<Container,Element>::iterator::operator++ ()
+  {
+    _element = _container->Container::_getNextElement( _element );
+    if (not _element) _nextBucket();
+    return *this;
+  }
+
+
+  template< typename Container, typename Element >
+  inline bool  IntrusiveRange<Container,Element>::iterator::operator== ( const iterator& other ) const
+  { return _element == other._element; }
+
+
+  template< typename Container, typename Element >
+  inline bool  IntrusiveRange<Container,Element>::iterator::operator!= ( const iterator& other ) const
+  { return _element != other._element; }
+
+
+  template< typename Container, typename Element >
+  inline IntrusiveRange<Container,Element>::IntrusiveRange ( const Container* container )
+    : _container(container)
+  { }
+
+
+  template< typename Container, typename Element >
+  inline typename IntrusiveRange<Container,Element>::iterator  IntrusiveRange<Container,Element>::begin () const
+  { return iterator( _container ); }
+
+
+  template< typename Container, typename Element >
+  inline typename IntrusiveRange<Container,Element>::iterator  IntrusiveRange<Container,Element>::end () const
+  { return iterator(); }
+
+
+  template< typename Container, typename Element >
+  inline bool  IntrusiveRange<Container,Element>::empty () const
+  { return not (begin() != end()); }
+
+
+// -------------------------------------------------------------------
+// Class  :  "Hurricane::SubTypeRange".
+//
+// Range counterpart of SubTypeCollection, only the elements of Range
+// that can be casted into SubType (a pointer type) are returned.
+
+  template< typename Range, typename SubType >
+  class SubTypeRange {
+    public:
+      typedef typename Range::iterator  BaseIterator;
+    public:
+      class iterator {
+        public:
+          typedef std::forward_iterator_tag  iterator_category;
+          typedef SubType                    value_type;
+          typedef std::ptrdiff_t             difference_type;
+          typedef SubType*                   pointer;
+          typedef SubType&                   reference;
+        public:
+          inline           iterator   ( BaseIterator current, BaseIterator end );
+          inline SubType   operator*  () const;
+          inline iterator& operator++ ();
+          inline bool      operator== ( const iterator& other ) const;
+          inline bool      operator!= ( const iterator& other ) const;
+        private:
+          inline void      _skip      ();
+        private:
+          BaseIterator  _current;
+          BaseIterator  _end;
+          SubType       _element;
+      };
+    public:
+      inline           SubTypeRange ( const Range& );
+      inline iterator  begin        () const;
+      inline iterator  end          () const;
+      inline bool      empty        () const;
+    private:
+      Range  _range;
+  };
+
+
+  template< typename Range, typename SubType >
+  inline SubTypeRange<Range,SubType>::iterator::iterator ( BaseIterator current, BaseIterator end )
+    : _current(current)
+    , _end    (end)
+    , _element(NULL)
+  { _skip(); }
+
+
+  template< typename Range, typename SubType >
+  inline void  SubTypeRange<Range,SubType>::iterator::_skip ()
+  {
+    for ( ; _current != _end ; ++_current ) {
+      _element = dynamic_cast<SubType>( *_current );
+      if (_element) return;
+    }
+    _element = NULL;
+  }
+
+
+  template< typename Range, typename SubType >
+  inline SubType  SubTypeRange<Range,SubType>::iterator::operator* () const
+  { return _element; }
+
+
+  template< typename Range, typename SubType >
+  inline typename SubTypeRange<Range,SubType>::iterator&
+  SubTypeRange<Range,SubType>::iterator::operator++ ()
+  {
+    ++_current;
+    _skip();
+    return *this;
+  }
+
+
+  template< typename Range, typename SubType >
+  inline bool  SubTypeRange<Range,SubType>::iterator::operator== ( const iterator& other ) const
+  { return _current == other._current; }
+
+
+  template< typename Range, typename SubType >
+  inline bool  SubTypeRange<Range,SubType>::iterator::operator!= ( const iterator& other ) const
+  { return _current != other._current; }
+
+
+  template< typename Range, typename SubType >
+  inline SubTypeRange<Range,SubType>::SubTypeRange ( const Range& range )
+    : _range(range)
+  { }
+
+
+  template< typename Range, typename SubType >
+  inline typename SubTypeRange<Range,SubType>::iterator  SubTypeRange<Range,SubType>::begin () const
+  { return iterator( _range.begin(), _range.end() ); }
+
+
+  template< typename Range, typename SubType >
+  inline typename SubTypeRange<Range,SubType>::iterator  SubTypeRange<Range,SubType>::end () const
+  { return iterator( _range.end(), _range.end() ); }
+
+
+  template< typename Range, typename SubType >
+  inline bool  SubTypeRange<Range,SubType>::empty () const
+  { return not (begin() != end()); }
+
+
+}  // Hurricane namespace.
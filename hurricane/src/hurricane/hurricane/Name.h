@@ -21,11 +21,10 @@
 #pragma  once
 #include "hurricane/Commons.h"
 #include "hurricane/Names.h"
+#include "hurricane/SharedName.h"
 
 namespace Hurricane {
 
-class SharedName;
-
 
 
 // ****************************************************************************************************
@@ -49,6 +48,7 @@ class Name {
     public: Name();
 
     public: Name(const char* c);
+    public: Name(const char* c, size_t length);
     public: Name(const string& s);
 
     public: Name(const Name& name);
@@ -63,8 +63,8 @@ class Name {
 
     public: Name& operator=(const Name& name);
 
-    public: bool operator==(const Name& name) const;
-    public: bool operator!=(const Name& name) const;
+    public: bool operator==(const Name& name) const {return (_sharedName == name._sharedName);};
+    public: bool operator!=(const Name& name) const {return (_sharedName != name._sharedName);};
     public: bool operator<(const Name& name) const;
     public: bool operator<=(const Name& name) const;
     public: bool operator>(const Name& name) const;
@@ -77,6 +77,7 @@ class Name {
 
     public: bool isEmpty() const;
     public: size_t size() const;
+    public: unsigned long getHash() const {return _sharedName->getHash();};
 
 // Others
 // ******
@@ -122,6 +123,19 @@ class Name {
 
 INSPECTOR_PR_SUPPORT(Hurricane::Name);
 
+
+// Names are interned, the precomputed hash is enough for unordered
+// containers, the equality being a pointer comparison.
+namespace std {
+
+  template<>
+  struct hash<Hurricane::Name> {
+    inline size_t operator() ( const Hurricane::Name& name ) const { return name.getHash(); }
+  };
+
+}
+
+
 inline void  jsonWrite ( JsonWriter* w, Hurricane::Name name )
 { w->write( getString(name).c_str() ); }
 
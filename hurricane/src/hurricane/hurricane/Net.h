@@ -33,6 +33,7 @@
 #include "hurricane/Horizontals.h"
 #include "hurricane/Pads.h"
 #include "hurricane/IntrusiveSet.h"
+#include "hurricane/IntrusiveRange.h"
 #include "hurricane/Path.h"
 #include "hurricane/NetAlias.h"
 
@@ -127,6 +128,9 @@ class Net : public Entity {
 
     };
 
+    public: typedef IntrusiveRange<ComponentSet,Component> ComponentRange;
+    public: typedef SubTypeRange<ComponentRange,RoutingPad*> RoutingPadRange;
+
     class RubberSet : public IntrusiveSet<Rubber> {
     // ******************************************
 
@@ -180,6 +184,8 @@ class Net : public Entity {
     public: Components getComponents() const {return _componentSet.getElements();};
     public: Rubbers getRubbers() const {return _rubberSet.getElements();};
     public: RoutingPads getRoutingPads() const;
+    public: ComponentRange getComponentRange() const {return ComponentRange(&_componentSet);};
+    public: RoutingPadRange getRoutingPadRange() const {return RoutingPadRange(getComponentRange());};
     public: Plugs getPlugs() const;
     public: Pins getPins() const;
     public: Contacts getContacts() const;
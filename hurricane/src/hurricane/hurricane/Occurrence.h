@@ -67,6 +67,8 @@ class Occurrence {
 
     public: Entity* getEntity() const {return _entity;};
     public: Path getPath() const {return Path(_sharedPath);};
+    public: uint32_t getPathId() const;
+    public: size_t getHash() const;
     public: Cell* getOwnerCell() const;
     public: Cell* getMasterCell() const;
     public: Property* getProperty(const Name& name) const;
@@ -131,6 +133,16 @@ class JsonOccurrence : public JsonObject {
 INSPECTOR_PV_SUPPORT(Hurricane::Occurrence);
 
 
+namespace std {
+
+  template<>
+  struct hash<Hurricane::Occurrence> {
+    inline size_t operator() ( const Hurricane::Occurrence& occurrence ) const { return occurrence.getHash(); }
+  };
+
+}
+
+
 #endif // HURRICANE_OCCURENCE
 
 
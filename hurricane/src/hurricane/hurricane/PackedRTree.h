@@ -0,0 +1,166 @@
+// -*- C++ -*-
+//
+// Copyright (c) Sorbonne Université 2024-2024, All Rights Reserved
+//
+// This file is part of Hurricane.
+//
+// Hurricane is free software: you can redistribute it  and/or  modify
+// it under the terms of the GNU  Lesser  General  Public  License  as
+// published by the Free Software Foundation, either version 3 of  the
+// License, or (at your option) any later version.
+//
+// Hurricane is distributed in the hope that it will  be  useful,  but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHAN-
+// TABILITY or FITNESS FOR A PARTICULAR PURPOSE. See  the  Lesser  GNU
+// General Public License for more details.
+//
+// You should have received a copy of the Lesser  GNU  General  Public
+// License along with Hurricane. If not, see
+//                                     <http://www.gnu.org/licenses/>.
+//
+// +-----------------------------------------------------------------+
+// |                  H U R R I C A N E                              |
+// |     V L S I   B a c k e n d   D a t a - B a s e                 |
+// |                                                                 |
+// |  Author      :                    Jean-Paul Chaput              |
+// |  E-mail      :            Jean-Paul.Chaput@lip6.fr              |
+// | =============================================================== |
+// |  C++ Header  :  "./hurricane/PackedRTree.h"                     |
+// +-----------------------------------------------------------------+
+
+
+#pragma  once
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include "hurricane/Box.h"
+
+
+namespace Hurricane {
+
+  class Go;
+
+
+// -------------------------------------------------------------------
+// Class  :  "Hurricane::PackedRTree".
+//
+// Static R-tree, bulk loaded with the Sort-Tile-Recursive method and
+// stored level by level in flat arrays (level 0 are the Go's boxes,
+// the children of node i at level L are [i*Fanout,(i+1)*Fanout) at
+// level L-1). It is only an *index* over the Go of a QuadTree, which
+// stays the owner of the Go membership:
+//   - Insertions after the bulk load are kept in a pending vector,
+//     scanned linearly by the queries.
+//   - A removal only leaves a tombstone: the Go is cleared from its
+//     leaf (it may be deleted just afterwards), the node boxes are
+//     kept as they are, still valid bounds. The position of each Go
+//     is recorded in a map to find it back.
+
+  class PackedRTree {
+    public:
+      static const size_t  Fanout   = 16;
+      static const size_t  MaxDepth = 16;
+    public:
+      class Cursor {
+        public:
+                      Cursor    ();
+                      Cursor    ( const PackedRTree*, const Box& area, DbU::Unit threshold );
+          inline bool isValid   () const;
+          inline Go*  getElement() const;
+                 void progress  ();
+        private:
+          struct Frame {
+            uint32_t  _level;
+            size_t    _index;
+            size_t    _end;
+          };
+        private:
+          inline bool _prune    ( const Box&, uint32_t level ) const;
+        private:
+          const PackedRTree* _rtree;
+          Box                _area;
+          DbU::Unit          _threshold;
+          Frame              _stack[MaxDepth];
+          uint32_t           _depth;
+          size_t             _pending;
+          Go*                _element;
+      };
+    public:
+                      PackedRTree    ();
+             void     clear          ();
+             void     build          ( std::vector<Go*>& );
+      inline void     insert         ( Go* );
+             void     remove         ( Go* );
+      inline void     invalidate     ();
+      inline bool     isValid        () const;
+      inline bool     needsRebuild   () const;
+      inline size_t   getSize        () const;
+      inline size_t   getPendingsSize() const;
+      inline size_t   getDeadsSize   () const;
+      inline size_t   getLevelsSize  () const;
+      inline size_t   getLevelSize   ( size_t level ) const;
+      inline const Box& getBox       ( size_t level, size_t index ) const;
+    private:
+      std::vector<Box>     _boxes;
+      std::vector<size_t>  _levelStarts;
+      std::vector<Go*>     _items;
+      std::vector<Go*>     _pendings;
+      std::unordered_map<Go*,size_t>
+                           _indexes;
+      size_t               _deads;
+      bool                 _valid;
+  };
+
+
+  inline bool        PackedRTree::isValid         () const { return _valid; }
+  inline size_t      PackedRTree::getSize         () const { return _items.size() - _deads + _pendings.size(); }
+  inline size_t      PackedRTree::getPendingsSize () const { return _pendings.size(); }
+  inline size_t      PackedRTree::getDeadsSize    () const { return _deads; }
+  inline size_t      PackedRTree::getLevelsSize   () const { return (_levelStarts.empty()) ? 0 : _levelStarts.size()-1; }
+  inline size_t      PackedRTree::getLevelSize    ( size_t level ) const { return _levelStarts[level+1] - _levelStarts[level]; }
+  inline const Box&  PackedRTree::getBox          ( size_t level, size_t index ) const { return _boxes[ _levelStarts[level]+index ]; }
+
+
+// Pending Go are indexed after the packed ones.
+  inline void  PackedRTree::insert ( Go* go )
+  {
+    _indexes.insert( std::make_pair( go, _items.size()+_pendings.size() ));
+    _pendings.push_back( go );
+  }
+
+
+  inline void  PackedRTree::invalidate ()
+  {
+    _valid = false;
+    _pendings.clear();
+  }
+
+
+// The pending Go are scanned linearly and the tombstones are walked
+// through for nothing, past a quarter of the packed size (and a
+// minimal amount) for either, a rebuild becomes worthwile.
+  inline bool  PackedRTree::needsRebuild () const
+  {
+    size_t threshold = std::max( (size_t)4*Fanout, _items.size()/4 );
+    return (not _valid) or (_pendings.size() > threshold) or (_deads > threshold);
+  }
+
+
+  inline bool  PackedRTree::Cursor::isValid    () const { return (_element != NULL); }
+  inline Go*   PackedRTree::Cursor::getElement () const { return _element; }
+
+
+// Same threshold rules as QuadTree_GosUnder: a node is pruned when it
+// is not bigger than the threshold, a Go when it is strictly smaller.
+  inline bool  PackedRTree::Cursor::_prune ( const Box& box, uint32_t level ) const
+  {
+    if (not box.intersect(_area)) return true;
+    if (_threshold <= 0) return false;
+    if (level == 0)
+      return (box.getWidth() < _threshold) and (box.getHeight() < _threshold);
+    return (box.getWidth() <= _threshold) and (box.getHeight() <= _threshold);
+  }
+
+
+}  // Hurricane namespace.
@@ -71,6 +71,7 @@ class Path {
 
     public: static char getNameSeparator();
 
+    public: uint32_t getId() const;
     public: Instance* getHeadInstance() const;
     public: Path getTailPath() const;
     public: Path getHeadPath() const;
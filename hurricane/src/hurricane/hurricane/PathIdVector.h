@@ -0,0 +1,133 @@
+// -*- C++ -*-
+//
+// Copyright (c) Sorbonne Université 2024-2024, All Rights Reserved
+//
+// This file is part of Hurricane.
+//
+// Hurricane is free software: you can redistribute it  and/or  modify
+// it under the terms of the GNU  Lesser  General  Public  License  as
+// published by the Free Software Foundation, either version 3 of  the
+// License, or (at your option) any later version.
+//
+// Hurricane is distributed in the hope that it will  be  useful,  but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHAN-
+// TABILITY or FITNESS FOR A PARTICULAR PURPOSE. See  the  Lesser  GNU
+// General Public License for more details.
+//
+// You should have received a copy of the Lesser  GNU  General  Public
+// License along with Hurricane. If not, see
+//                                     <http://www.gnu.org/licenses/>.
+//
+// +-----------------------------------------------------------------+
+// |                  H U R R I C A N E                              |
+// |     V L S I   B a c k e n d   D a t a - B a s e                 |
+// |                                                                 |
+// |  Author      :                    Jean-Paul Chaput              |
+// |  E-mail      :            Jean-Paul.Chaput@lip6.fr              |
+// | =============================================================== |
+// |  C++ Header  :  "./hurricane/PathIdVector.h"                    |
+// +-----------------------------------------------------------------+
+
+
+#pragma  once
+#include <vector>
+#include "hurricane/Path.h"
+#include "hurricane/SharedPath.h"
+
+
+namespace Hurricane {
+
+
+// -------------------------------------------------------------------
+// Class  :  "Hurricane::PathIdVector".
+//
+// Associate a Data to a Path using the dense SharedPath identifiers
+// as vector index, in place of a map keyed on Path. Only the entries
+// explicitly set are reported by has(), the others return the default.
+// As identifiers are recycled, a PathIdVector is meant to live while
+// the hierarchy it has been filled from is unchanged (a pass cache),
+// it must be cleared if instances are deleted in between.
+
+  template< typename Data >
+  class PathIdVector {
+    public:
+      inline              PathIdVector ( const Data& defaultData=Data() );
+      inline bool         has          ( const Path& ) const;
+      inline const Data&  get          ( const Path& ) const;
+      inline Data&        operator[]   ( const Path& );
+      inline void         erase        ( const Path& );
+      inline size_t       size         () const;
+      inline void         clear        ();
+    private:
+      std::vector<Data>  _datas;
+      std::vector<bool>  _sets;
+      size_t             _size;
+      Data               _default;
+  };
+
+
+  template< typename Data >
+  inline PathIdVector<Data>::PathIdVector ( const Data& defaultData )
+    : _datas  ()
+    , _sets   ()
+    , _size   (0)
+    , _default(defaultData)
+  { }
+
+
+  template< typename Data >
+  inline bool  PathIdVector<Data>::has ( const Path& path ) const
+  {
+    uint32_t id = path.getId();
+    return (id < _sets.size()) and _sets[id];
+  }
+
+
+  template< typename Data >
+  inline const Data& PathIdVector<Data>::get ( const Path& path ) const
+  { return (has(path)) ? _datas[path.getId()] : _default; }
+
+
+  template< typename Data >
+  inline Data& PathIdVector<Data>::operator[] ( const Path& path )
+  {
+    uint32_t id = path.getId();
+    if (id >= _datas.size()) {
+      size_t newSize = std::max( (size_t)id+1, (size_t)SharedPath::getIdsSize() );
+      _datas.resize( newSize, _default );
+      _sets .resize( newSize, false );
+    }
+    if (not _sets[id]) {
+      _sets[id] = true;
+      ++_size;
+    }
+    return _datas[id];
+  }
+
+
+  template< typename Data >
+  inline void  PathIdVector<Data>::erase ( const Path& path )
+  {
+    if (not has(path)) return;
+    uint32_t id = path.getId();
+    _datas[id] = _default;
+    _sets [id] = false;
+    --_size;
+  }
+
+
+  template< typename Data >
+  inline size_t  PathIdVector<Data>::size () const
+  { return _size; }
+
+
+  template< typename Data >
+  inline void  PathIdVector<Data>::clear ()
+  {
+    std::vector<Data>().swap( _datas );
+    std::vector<bool>().swap( _sets );
+    _size = 0;
+  }
+
+
+}  // Hurricane namespace.
@@ -30,6 +30,7 @@
 
 
 #pragma  once
+#include <typeinfo>
 #include "hurricane/Name.h"
 #include "hurricane/Properties.h"
 #include "hurricane/DBo.h"
@@ -59,6 +60,8 @@ namespace Hurricane {
     // Static Method.
       template<typename DerivedProperty>
       static  DerivedProperty* get           ( const DBo* );
+      template<typename DerivedProperty>
+      static  DerivedProperty* cast          ( Property* );
       static  Name             staticGetName ();
     // Constructor.
       template<typename DerivedProperty>
@@ -110,11 +113,23 @@ namespace Hurricane {
   }
 
 
+// The property stored under a name is almost always of the exact
+// class expected by the caller, checking that first is much cheaper
+// than the class hierarchy walk of a dynamic_cast.
+  template<typename DerivedProperty>
+  inline DerivedProperty* Property::cast ( Property* property )
+  {
+    if (not property) return NULL;
+    if (typeid(*property) == typeid(DerivedProperty)) return static_cast<DerivedProperty*>( property );
+    return dynamic_cast<DerivedProperty*>( property );
+  }
+
+
   template<typename DerivedProperty>
   DerivedProperty* Property::get ( const DBo* object )
   {
     Property*        property1 = object->getProperty ( DerivedProperty::staticGetName() );
-    DerivedProperty* property2 = dynamic_cast<DerivedProperty*> ( property1 );
+    DerivedProperty* property2 = cast<DerivedProperty> ( property1 );
     
     if ( property1 && !property2 )
       throw Error ( propertyTypeNameError
@@ -257,8 +272,9 @@ namespace Hurricane {
   template<typename Value, typename JsonState>
   Value* StandardPrivateProperty<Value,JsonState>::staticGetValue ( const DBo* object )
   {
-    if ( ( object == _owner ) || get(object) ) return _cache->getValue();
-    return NULL;
+    if ( object == _owner ) return &_cache->getValue();
+    auto property = get( object );
+    return (property) ? &property->getValue() : NULL;
   }
 
 
@@ -285,19 +301,23 @@ namespace Hurricane {
   {
     if ( object == _owner ) return _cache;
 
-    Property* property = object->getProperty ( StandardPrivateProperty<Value>::staticGetName() );
-    _cache   = dynamic_cast<StandardPrivateProperty<Value>*> ( property );
+  // The lookup result is kept local, the _cache static would be shared
+  // between threads reading a frozen DataBase.
+    Property*                        property = object->getProperty ( StandardPrivateProperty<Value>::staticGetName() );
+    StandardPrivateProperty<Value>*  result   = cast< StandardPrivateProperty<Value> > ( property );
     
-    if ( !_cache ) {
+    if ( !result ) {
       if ( property )
         throw Error ( propertyTypeNameError
                     , getString(StandardPrivateProperty<Value>::staticGetName()).c_str()
                     , getString(object).c_str() );
-      else if ( create )
-        const_cast<DBo*>(object)->put ( StandardPrivateProperty<Value>::create() );
+      else if ( create ) {
+        result = StandardPrivateProperty<Value>::create();
+        const_cast<DBo*>(object)->put ( result );
+      }
     }
 
-    return _cache;
+    return result;
   }
   
 
@@ -486,8 +506,9 @@ namespace Hurricane {
   template<typename Value>
   Value* StandardSharedProperty<Value>::staticGetValue ( const DBo* object )
   {
-    if ( ( object == _owner ) || get(object) ) return _cache->getValue();
-    return NULL;
+    if ( object == _owner ) return &_cache->getValue();
+    auto property = get( object );
+    return (property) ? &property->getValue() : NULL;
   }
 
 
@@ -514,19 +535,21 @@ namespace Hurricane {
   {
     if ( _owner == object ) return _cache;
 
-    Property* property = object->getProperty ( StandardSharedProperty<Value>::staticGetName() );
-    _cache = dynamic_cast<StandardSharedProperty<Value>*> ( property );
+    Property*                       property = object->getProperty ( StandardSharedProperty<Value>::staticGetName() );
+    StandardSharedProperty<Value>*  result   = cast< StandardSharedProperty<Value> > ( property );
     
-    if ( !_cache ) {
+    if ( !result ) {
       if ( property )
         throw Error ( propertyTypeNameError
                     , getString(StandardSharedProperty<Value>::staticGetName()).c_str()
                     , getString(object).c_str() );
-      else if ( create )
-        const_cast<DBo*>(object)->put ( StandardSharedProperty<Value>::create() );
+      else if ( create ) {
+        result = StandardSharedProperty<Value>::create();
+        const_cast<DBo*>(object)->put ( result );
+      }
     }
 
-    return _cache;
+    return result;
   }
 
 
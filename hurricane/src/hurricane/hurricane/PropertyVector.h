@@ -0,0 +1,172 @@
+// -*- C++ -*-
+//
+// Copyright (c) Sorbonne Université 2024-2024, All Rights Reserved
+//
+// This file is part of Hurricane.
+//
+// Hurricane is free software: you can redistribute it  and/or  modify
+// it under the terms of the GNU  Lesser  General  Public  License  as
+// published by the Free Software Foundation, either version 3 of  the
+// License, or (at your option) any later version.
+//
+// Hurricane is distributed in the hope that it will  be  useful,  but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHAN-
+// TABILITY or FITNESS FOR A PARTICULAR PURPOSE. See  the  Lesser  GNU
+// General Public License for more details.
+//
+// You should have received a copy of the Lesser  GNU  General  Public
+// License along with Hurricane. If not, see
+//                                     <http://www.gnu.org/licenses/>.
+//
+// +-----------------------------------------------------------------+
+// |                  H U R R I C A N E                              |
+// |     V L S I   B a c k e n d   D a t a - B a s e                 |
+// |                                                                 |
+// |  Author      :                    Jean-Paul Chaput              |
+// |  E-mail      :            Jean-Paul.Chaput@lip6.fr              |
+// | =============================================================== |
+// |  C++ Header  :  "./hurricane/PropertyVector.h"                  |
+// +-----------------------------------------------------------------+
+
+
+#pragma  once
+#include <cstdint>
+#include "hurricane/Name.h"
+#include "hurricane/Properties.h"
+
+
+namespace Hurricane {
+
+
+// -------------------------------------------------------------------
+// Class  :  "Hurricane::PropertyVector".
+//
+// Property storage of a DBo. Properties are kept in insertion order,
+// along with the SharedName of their name, so a lookup only compares
+// pointers (no virtual getName() call, no Name copy). The SharedName
+// is captured while the property is stored, so it cannot be recycled
+// for another name. Most of the DBo have zero, one or two properties,
+// they are stored inline, the array goes to the heap only beyond
+// InlineSize. The object is smaller than the std::set it replaces.
+
+  class PropertyVector {
+    public:
+      static const uint32_t  InlineSize = 2;
+    public:
+      struct Entry {
+        SharedName* _name;
+        Property*   _property;
+      };
+    public:
+      class Collection : public Hurricane::Collection<Property*> {
+        public:
+          typedef Hurricane::Collection<Property*>  Inherit;
+        public:
+          class Locator : public Hurricane::Locator<Property*> {
+            public:
+              inline                                Locator    ( const Entry* begin, const Entry* end );
+              virtual Property*                     getElement () const;
+              virtual Hurricane::Locator<Property*>* getClone  () const;
+              virtual bool                          isValid    () const;
+              virtual void                          progress   ();
+              virtual std::string                   _getString () const;
+            private:
+              const Entry* _current;
+              const Entry* _end;
+          };
+        public:
+          inline                                Collection  ( const Entry* begin=NULL, const Entry* end=NULL );
+          virtual Hurricane::Collection<Property*>* getClone() const;
+          virtual Hurricane::Locator<Property*>* getLocator () const;
+          virtual unsigned                      getSize     () const;
+          virtual std::string                   _getString  () const;
+        private:
+          const Entry* _begin;
+          const Entry* _end;
+      };
+    public:
+      inline                 PropertyVector ();
+                            ~PropertyVector ();
+      inline bool            empty          () const;
+      inline uint32_t        size           () const;
+      inline Property*       operator[]     ( uint32_t ) const;
+      inline Property*       back           () const;
+      inline Property*       find           ( const Name& ) const;
+      inline bool            contains       ( const Property* ) const;
+      inline Properties      getCollection  () const;
+             void            push_back      ( Property* );
+             void            pop_back       ();
+             bool            erase          ( const Property* );
+             std::string     _getTypeName   () const;
+             std::string     _getString     () const;
+             Record*         _getRecord     () const;
+    private:
+      inline Entry*          _getEntries    ();
+      inline const Entry*    _getEntries    () const;
+    private:
+                             PropertyVector ( const PropertyVector& ) = delete;
+             PropertyVector& operator=      ( const PropertyVector& ) = delete;
+    private:
+      uint32_t  _size;
+      uint32_t  _capacity;
+      union {
+        Entry   _inline[InlineSize];
+        Entry*  _heap;
+      };
+  };
+
+
+  inline  PropertyVector::PropertyVector ()
+    : _size    (0)
+    , _capacity(InlineSize)
+  { }
+
+
+  inline PropertyVector::Entry*       PropertyVector::_getEntries  () { return (_capacity > InlineSize) ? _heap : _inline; }
+  inline const PropertyVector::Entry* PropertyVector::_getEntries  () const { return (_capacity > InlineSize) ? _heap : _inline; }
+  inline bool                         PropertyVector::empty        () const { return (_size == 0); }
+  inline uint32_t                     PropertyVector::size         () const { return _size; }
+  inline Property*                    PropertyVector::operator[]   ( uint32_t i ) const { return _getEntries()[i]._property; }
+  inline Property*                    PropertyVector::back         () const { return _getEntries()[_size-1]._property; }
+  inline Properties                   PropertyVector::getCollection() const { return Collection( _getEntries(), _getEntries()+_size ); }
+
+
+  inline Property* PropertyVector::find ( const Name& name ) const
+  {
+    const SharedName* key     = name._getSharedName();
+    const Entry*      entries = _getEntries();
+    for ( uint32_t i=0 ; i<_size ; ++i ) {
+      if (entries[i]._name == key) return entries[i]._property;
+    }
+    return NULL;
+  }
+
+
+  inline bool  PropertyVector::contains ( const Property* property ) const
+  {
+    const Entry* entries = _getEntries();
+    for ( uint32_t i=0 ; i<_size ; ++i ) {
+      if (entries[i]._property == property) return true;
+    }
+    return false;
+  }
+
+
+  inline PropertyVector::Collection::Locator::Locator ( const Entry* begin, const Entry* end )
+    : Hurricane::Locator<Property*>()
+    , _current(begin)
+    , _end    (end)
+  { }
+
+
+  inline PropertyVector::Collection::Collection ( const Entry* begin, const Entry* end )
+    : Inherit()
+    , _begin(begin)
+    , _end  (end)
+  { }
+
+
+}  // Hurricane namespace.
+
+
+INSPECTOR_PR_SUPPORT(Hurricane::PropertyVector);
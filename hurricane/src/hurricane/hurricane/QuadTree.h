@@ -21,9 +21,11 @@
 #include "hurricane/Box.h"
 #include "hurricane/Gos.h"
 #include "hurricane/IntrusiveSet.h"
+#include "hurricane/IntrusiveRange.h"
 
 namespace Hurricane {
 
+class PackedRTree;
 
 
 // ****************************************************************************************************
@@ -47,6 +49,34 @@ class QuadTree {
 
     };
 
+    public: typedef IntrusiveRange<GoSet,Go> GoSetRange;
+
+    public: class GoRange {
+    // ******************
+
+        public: class iterator {
+        // *******************
+
+            public: iterator(QuadTree* quadTree = NULL);
+
+            public: Go* operator*() const {return *_goIterator;};
+            public: iterator& operator++();
+            public: bool operator==(const iterator& other) const {return _goIterator == other._goIterator;};
+            public: bool operator!=(const iterator& other) const {return _goIterator != other._goIterator;};
+
+            private: QuadTree* _quadTree;
+            private: GoSetRange::iterator _goIterator;
+        };
+
+        public: GoRange(const QuadTree* quadTree) : _quadTree(quadTree) {};
+
+        public: iterator begin() const {return iterator(_quadTree->_getFirstQuadTree());};
+        public: iterator end() const {return iterator();};
+        public: bool empty() const {return _quadTree->isEmpty();};
+
+        private: const QuadTree* _quadTree;
+    };
+
 // Attributes
 // **********
 
@@ -60,6 +90,8 @@ class QuadTree {
     private: QuadTree* _urChild; // Upper Right Child
     private: QuadTree* _llChild; // Lower Left Child
     private: QuadTree* _lrChild; // Lower Right Child
+    private: PackedRTree* _rtree; // Optional packed index (root only)
+    private: bool _rtreeQueued;
 
 // Constructors
 // ************
@@ -87,17 +119,23 @@ class QuadTree {
     public: const Box& getBoundingBox() const;
     public: Gos getGos() const;
     public: Gos getGosUnder(const Box& area, DbU::Unit threshold=0) const;
+    public: GoRange getGoRange() const {return GoRange(this);};
+    public: const PackedRTree* getRTree() const {return _rtree;};
 
 // Predicates
 // **********
 
     public: bool isEmpty() const {return (_size == 0);};
+    public: bool hasRTree() const {return (_rtree != NULL);};
 
 // Updators
 // ********
 
     public: void insert(Go* go);
     public: void remove(Go* go);
+    public: void setRTree(bool state);
+    public: void buildRTree();
+    public: static void buildRTrees();
 
 // Others
 // ******
@@ -115,12 +153,35 @@ class QuadTree {
 
     public: bool _hasBeenExploded() const {return (_ulChild != NULL);};
 
+    public: QuadTree* _insert(Go* go, const Box& boundingBox);
+    public: void _insert(const vector<Go*>& gos, const vector<Box>& boundingBoxes);
+    public: void _updateBoundingBoxes();
     public: void _explode();
     public: void _implode();
+    public: void _queueRTree();
 
 };
 
 
+inline QuadTree::GoRange::iterator::iterator(QuadTree* quadTree)
+// **************************************************************
+:    _quadTree(quadTree),
+    _goIterator((quadTree) ? &quadTree->_getGoSet() : NULL)
+{
+}
+
+inline QuadTree::GoRange::iterator& QuadTree::GoRange::iterator::operator++()
+// **************************************************************************
+{
+    ++_goIterator;
+    if (!*_goIterator) {
+        _quadTree = _quadTree->_getNextQuadTree();
+        if (_quadTree) _goIterator = GoSetRange::iterator(&_quadTree->_getGoSet());
+    }
+    return *this;
+}
+
+
 } // End of Hurricane namespace.
 
 
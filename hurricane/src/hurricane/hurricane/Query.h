@@ -37,6 +37,7 @@
 #include "hurricane/Transformation.h"
 #include "hurricane/Cell.h"
 #include "hurricane/Instance.h"
+#include "hurricane/VectorCollection.h"
 
 
 namespace Hurricane {
@@ -121,6 +122,8 @@ namespace Hurricane {
       inline  DbU::Unit             getThreshold         () const;
       inline  const Transformation& getTransformation    () const;
       inline  const Path&           getPath              () const;
+      inline  Instance*             getRootInstance      () const;
+      inline  bool                  isConcurrent         () const;
     //inline  const Tabulation&     getTab               () const;
     // Modifiers.
       inline  void                  setTopCell           ( Cell*                 cell );
@@ -131,6 +134,8 @@ namespace Hurricane {
       inline  void                  setStopLevel         ( unsigned int          level );
       inline  void                  setStopCellFlags     ( Cell::Flags );
       inline  void                  unsetStopCellFlags   ( Cell::Flags );
+      inline  void                  setRootInstance      ( Instance* );
+      inline  void                  setConcurrent        ( bool );
       inline  void                  init                 ();
       inline  void                  updateTransformation ();
       inline  bool                  levelDown            ();
@@ -151,6 +156,8 @@ namespace Hurricane {
               unsigned int          _stopLevel;
               Cell::Flags           _stopCellFlags;
               size_t                _instanceCount;
+              vector<Instance*>     _rootInstance;
+              bool                  _concurrent;
 
     private:
     // Internal: Constructors.
@@ -174,6 +181,8 @@ namespace Hurricane {
   inline  const Path&           QueryStack::getPath              () const { return back()->_path; }
 //inline  const Tabulation&     QueryStack::getTab               () const { return _tab; }
   inline  size_t                QueryStack::getInstanceCount     () const { return _instanceCount; }
+  inline  Instance*             QueryStack::getRootInstance      () const { return (_rootInstance.empty()) ? NULL : _rootInstance[0]; }
+  inline  bool                  QueryStack::isConcurrent         () const { return _concurrent; }
 
 
   inline Instance* QueryStack::getInstance ()
@@ -199,6 +208,16 @@ namespace Hurricane {
   inline  void  QueryStack::setStopLevel         ( unsigned int          level )          { _stopLevel = level; }
   inline  void  QueryStack::setStopCellFlags     ( Cell::Flags           flags )          { _stopCellFlags = flags; }
   inline  void  QueryStack::unsetStopCellFlags   ( Cell::Flags           flags )          { _stopCellFlags.reset(flags); }
+  inline  void  QueryStack::setConcurrent        ( bool                  state )          { _concurrent = state; }
+
+
+// The walk is restricted to the sub-tree of one instance of the top
+// cell, the components of the top cell itself are skipped.
+  inline  void  QueryStack::setRootInstance ( Instance* instance )
+  {
+    _rootInstance.clear();
+    if (instance) _rootInstance.push_back( instance );
+  }
 
 
   inline  void  QueryStack::init ()
@@ -228,6 +247,9 @@ namespace Hurricane {
     parent->_transformation.applyOn ( child->_transformation );
 
   //child->_path = Path ( Path(parent->_path,instance->getCell()->getShuntedPath()) , instance );
+  // SharedPath are created on the fly and chained into the instances,
+  // so it must be serialized when multiple stacks are walked at once.
+    SharedPath::Guard guard ( _concurrent );
     child->_path = Path ( parent->_path, instance );
   //cerr << "QueryStack::updateTransformation() " << child->_path << endl;
   }
@@ -239,8 +261,11 @@ namespace Hurricane {
     if (getMasterCell()->getFlags().isset(_stopCellFlags)) return false;
 
   //cerr << "QueryStack::levelDown(): t:" << DbU::getValueString(getThreshold()) << endl;
-    Locator<Instance*>* locator =
-      getMasterCell()->getInstancesUnder(getArea(),getThreshold()).getLocator();
+    Locator<Instance*>* locator = NULL;
+    if ((size() == 1) and not _rootInstance.empty())
+      locator = getCollection( _rootInstance ).getLocator();
+    else
+      locator = getMasterCell()->getInstancesUnder(getArea(),getThreshold()).getLocator();
 
     if ( locator->isValid() ) {
       push_back ( new QueryState ( locator ) );
@@ -309,6 +334,26 @@ namespace Hurricane {
 
 // -------------------------------------------------------------------
 // Class  :  "Query".
+//
+// doParallelQuery() splits the walk over the instances of the top
+// cell under the area. Each group of sub-trees is walked by a
+// *clone* of the query, then the clones are merged back in the
+// calling thread, in the same order as the sequential walk. As in
+// doQuery(), the components of the top cell are processed first, by
+// the query itself. The database must not be modified during the walk.
+// The lazily computed bounding boxes are forced by prepareConcurrent()
+// before the walk, unless the DataBase is frozen or the caller tells
+// (prepared) that it already did it since the last modification. A
+// caller doing many walks, like an extraction, should prepare once.
+// The reentrancy contract for the derived classes is:
+//   - clone() returns a new query of the same kind, the walk parameters
+//     (area, layer, filter, levels) are copied by the driver. If it
+//     returns NULL (the default), the query is done sequentially.
+//   - The callbacks of a clone run concurrently with those of the other
+//     clones, so they must only *read* the database and store their
+//     results in the clone itself (a per-thread sink).
+//   - merge() is called on the original query, sequentially, once per
+//     clone, it is the place to modify the database.
 
   class Query {
     public:
@@ -356,6 +401,8 @@ namespace Hurricane {
       virtual void                  rubberCallback         ( Rubber* );
       virtual void                  extensionGoCallback    ( Go*     ) = 0;
       virtual void                  masterCellCallback     () = 0;
+      virtual Query*                clone                  () const;
+      virtual void                  merge                  ( Query* );
     // Modifiers.
               void                  setQuery               ( Cell*                 cell
                                                            , const Box&            area
@@ -377,6 +424,8 @@ namespace Hurricane {
       inline  void                  setStopCellFlags       ( Cell::Flags );
       inline  void                  unsetStopCellFlags     ( Cell::Flags );
       virtual void                  doQuery                ();
+              void                  doParallelQuery        ( unsigned int threads, bool prepared=false );
+      static  void                  prepareConcurrent      ( Cell* );
 
     protected:
     // Internal: Attributes.
@@ -20,6 +20,7 @@
 #ifndef HURRICANE_SHARED_NAME
 #define HURRICANE_SHARED_NAME
 
+#include <atomic>
 #include "hurricane/Commons.h"
 
 namespace Hurricane {
@@ -27,41 +28,52 @@ namespace Hurricane {
 
 // -------------------------------------------------------------------
 // Class  :  "Hurricane::SharedName".
+//
+// The SharedName are interned in an open addressing hash table, split
+// in shards selected by the hash. In concurrent mode each shard is
+// protected by it's own mutex, and the reference count is atomic
+// (the 1 -> 0 transition is done under the shard lock, so a lookup
+// cannot resurrect a dying name). The mode must be switched while
+// only one thread is running.
 
 
   class SharedName {
       friend class Name;
+      friend class PropertyVector;
     public:
-      static void           dump         ();
+      static void           dump          ();
+      static void           setConcurrent ( bool );
+      static bool           isConcurrent  ();
+      static size_t         getCount      ();
+      static unsigned long  computeHash   ( const char*, size_t length );
     public:
-      inline unsigned long  getHash      () const;
-             const string&  _getSString  () const { return _string; };
-             string         _getTypeName () const { return _TName("SharedName"); };
-             string         _getString   () const;
-             Record*        _getRecord   () const;
-    private:               
-                            SharedName   ( const string& );
-                            SharedName   ( const SharedName& );
-                           ~SharedName   ();
-             SharedName&    operator=    ( const SharedName& );
-             void           capture      ();
-             void           release      ();
-
+      inline unsigned long  getHash       () const;
+             const string&  _getSString   () const { return _string; };
+             string         _getTypeName  () const { return _TName("SharedName"); };
+             string         _getString    () const;
+             Record*        _getRecord    () const;
     private:
-      struct SharedNameMapComparator {
-          bool operator() ( string* lhs, string* rhs ) const;
-      };
-      typedef  map<string*, SharedName*, SharedNameMapComparator>  SharedNameMap;
+      class Table;
+    private:               
+                            SharedName    ( const char*, size_t length, unsigned long hash );
+                            SharedName    ( const SharedName& );
+                           ~SharedName    ();
+             SharedName&    operator=     ( const SharedName& );
+      static SharedName*    _intern       ( const char*, size_t length );
+      inline void           capture       ();
+             void           release       ();
 
     private:
-      static SharedNameMap* _SHARED_NAME_MAP;
-             unsigned long  _hash;
-             int            _count;
-             string         _string;
+      static Table*             _SHARED_NAME_TABLE;
+      static bool               _concurrent;
+             unsigned long      _hash;
+             std::atomic<int>   _count;
+             string             _string;
   };
 
 
   inline  unsigned long  SharedName::getHash () const { return _hash; }
+  inline  void           SharedName::capture () { _count.fetch_add( 1, std::memory_order_relaxed ); }
 
 
 } // End of Hurricane namespace.
@@ -30,6 +30,10 @@
 
 
 #pragma  once
+#include <cstdint>
+#include <vector>
+#include <mutex>
+#include <unordered_map>
 #include "hurricane/Instances.h"
 #include "hurricane/SharedPathes.h"
 #include "hurricane/Quark.h"
@@ -44,6 +48,20 @@ namespace Hurricane {
 
 // -------------------------------------------------------------------
 // Class  :  "SharedPath".
+//
+// Each SharedPath is given a dense 32 bits identifier (0 stands for
+// the empty path), usable to index vectors (see PathIdVector). The
+// identifier of a destroyed SharedPath is recycled by the next one
+// created, so the identifier space stays as large as the peak number
+// of live paths. The parent path (the path minus the tail instance)
+// is cached by identifier, and a global index gives the child path
+// from a parent one and an instance, so walking down or up the
+// hierarchy is done in constant time instead of rebuilding the chain.
+// Both are cleared of a SharedPath entries when it is destroyed.
+//
+// SharedPaths are created on the fly by read accesses (Path building).
+// In concurrent mode, their lookup and creation are serialized by a
+// (recursive) mutex, through the Guard objects.
 
 
   class SharedPath {
@@ -59,6 +77,14 @@ namespace Hurricane {
           virtual void          _setNextElement ( Quark* , Quark* nextQuark ) const;
     };
 
+    public:
+      class Guard {
+        public:
+          inline  Guard ();
+          inline  Guard ( bool enabled );
+        private:
+          std::unique_lock<std::recursive_mutex>  _lock;
+      };
     public:
                    SharedPath ( Instance* headInstance, SharedPath* tailSharedPath = NULL );
                   ~SharedPath ();
@@ -66,9 +92,16 @@ namespace Hurricane {
                    SharedPath ( const SharedPath& ) = delete;
        SharedPath& operator=  ( const SharedPath& ) = delete;
     public:
-      static char getNameSeparator ();
-      static void setNameSeparator ( char nameSeparator );
+      static char        getNameSeparator    ();
+      static void        setNameSeparator    ( char nameSeparator );
+      static SharedPath* getSharedPath       ( uint32_t id );
+      static uint32_t    getIdsSize          ();
+      static SharedPath* _getChildSharedPath ( const SharedPath*, const Instance* );
+      static void        _setChildSharedPath ( SharedPath* head, SharedPath* child );
+      static bool        isConcurrent        ();
+      static void        setConcurrent       ( bool );
     public:
+      inline uint32_t       getId             () const;
              unsigned long  getHash           () const;
       inline Instance*      getHeadInstance   () const;
       inline SharedPath*    getTailSharedPath () const;
@@ -89,16 +122,35 @@ namespace Hurricane {
       inline QuarkMap&      _getQuarkMap                    ();
       inline SharedPath*    _getNextOfInstanceSharedPathMap () const;
       inline void           _setNextOfInstanceSharedPathMap ( SharedPath* sharedPath );
+    private:
+      static std::vector<SharedPath*>*                  _idToSharedPath;
+      static std::vector<uint32_t>*                     _freeIds;
+      static std::unordered_map<uint64_t,SharedPath*>*  _childSharedPaths;
+      static bool                                       _concurrent;
+      static std::recursive_mutex                       _mutex;
     private:
     // Attributes.
-      unsigned long  _hash;
-      Instance*      _headInstance;
-      SharedPath*    _tailSharedPath;
-      QuarkMap       _quarkMap;
-      SharedPath*    _nextOfInstanceSharedPathMap;
+              uint32_t       _id;
+      mutable uint32_t       _headSharedPathId;
+              unsigned long  _hash;
+              Instance*      _headInstance;
+              SharedPath*    _tailSharedPath;
+              QuarkMap       _quarkMap;
+              SharedPath*    _nextOfInstanceSharedPathMap;
   };
 
   
+  inline  SharedPath::Guard::Guard ()
+    : _lock(_mutex, std::defer_lock)
+  { if (_concurrent) _lock.lock(); }
+
+
+  inline  SharedPath::Guard::Guard ( bool enabled )
+    : _lock(_mutex, std::defer_lock)
+  { if (enabled) _lock.lock(); }
+
+
+  inline uint32_t              SharedPath::getId                           () const { return _id; }
   inline Instance*             SharedPath::getHeadInstance                 () const { return _headInstance; }
   inline SharedPath*           SharedPath::getTailSharedPath               () const { return _tailSharedPath; }
   inline Quark*                SharedPath::_getQuark                       (const Entity* entity ) const { return _quarkMap.getElement(entity); }
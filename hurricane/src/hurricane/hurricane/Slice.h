@@ -72,6 +72,7 @@ class Slice {
     public: Gos getGos() const {return _quadTree.getGos();};
     public: Gos getGosUnder(const Box& area, DbU::Unit threshold=0) const {return _quadTree.getGosUnder(area,threshold);};
     public: Components getComponents() const;
+    public: SubTypeRange<QuadTree::GoRange,Component*> getComponentRange() const {return _quadTree.getGoRange();};
     public: Components getComponentsUnder(const Box& area, DbU::Unit threshold=0) const;
     public: Markers getMarkers() const;
     public: Markers getMarkersUnder(const Box& area) const;
@@ -0,0 +1,138 @@
+// -*- C++ -*-
+//
+// Copyright (c) Sorbonne Université 2024-2024, All Rights Reserved
+//
+// This file is part of Hurricane.
+//
+// Hurricane is free software: you can redistribute it  and/or  modify
+// it under the terms of the GNU  Lesser  General  Public  License  as
+// published by the Free Software Foundation, either version 3 of  the
+// License, or (at your option) any later version.
+//
+// Hurricane is distributed in the hope that it will  be  useful,  but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHAN-
+// TABILITY or FITNESS FOR A PARTICULAR PURPOSE. See  the  Lesser  GNU
+// General Public License for more details.
+//
+// You should have received a copy of the Lesser  GNU  General  Public
+// License along with Hurricane. If not, see
+//                                     <http://www.gnu.org/licenses/>.
+//
+// +-----------------------------------------------------------------+
+// |                  H U R R I C A N E                              |
+// |     V L S I   B a c k e n d   D a t a - B a s e                 |
+// |                                                                 |
+// |  Author      :                    Jean-Paul Chaput              |
+// |  E-mail      :            Jean-Paul.Chaput@lip6.fr              |
+// | =============================================================== |
+// |  C++ Header  :  "./hurricane/Snapshot.h"                        |
+// +-----------------------------------------------------------------+
+
+
+#pragma  once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "hurricane/Name.h"
+
+
+namespace Hurricane {
+
+  class Cell;
+  class Net;
+  class Instance;
+  class Plug;
+  class Layer;
+
+
+// -------------------------------------------------------------------
+// Class  :  "Hurricane::Snapshot".
+//
+// Binary checkpoint of a Cell hierarchy, an alternative to the JSON
+// save/restore meant for speed. The snapshot holds all the non
+// terminal netlist Cells of the hierarchy (terminal netlist ones are
+// only referenced by name and must be available at load time), with
+// their nets, instances, plug connexions, components (Contact, Pin,
+// Horizontal, Vertical, Pad, RoutingPad, Diagonal, Polygon and
+// Rectilinear, the contours of the last ones in a points pool), the
+// NetRoutingState and the external components. The other properties
+// (with a JSON support) are not saved, save() reports them as an
+// Error listing their names, the snapshot is still written.
+//
+// The file is made of fixed size records, all the names are stored
+// once in a string table and every record refers to strings, Cells,
+// nets or components through their index. Offsets are relative to
+// the beginning of the file, which is read through mmap().
+//
+// Loading is done in two steps:
+//   1. loadNetlist() creates the Cells, nets, instances and plugs.
+//   2. loadComponents() creates the components of one Cell (and of
+//      it's snapshotted masters), or of all of them. Until then they
+//      are left untouched in the mapped file, so the Snapshot object
+//      must stay alive.
+//
+// The static load() is lazy by default: it only does the first step
+// and keeps the Snapshot aside, the components of a Cell are created
+// by it's first Cell::materialize() (through complete()). The Snapshot
+// is released once all it's Cells are completed or destroyed. Use the
+// Eager flag to load everything at once. As the pending components
+// refer to the nets, instances and plugs created by the first step,
+// the netlist of a Cell must not be edited before it is completed
+// (destroying a Cell completes the Cells instanciating it).
+
+  class Snapshot {
+    public:
+      static const uint32_t  Version = 2;
+      enum Flag { NoFlags = 0
+                , Eager   = (1 << 0)
+                };
+    public:
+      static void         save             ( Cell*, const std::string& path );
+      static Cell*        load             ( const std::string& path, uint32_t flags=NoFlags );
+      static bool         isLazy           ( const Cell* );
+      static void         complete         ( Cell* );
+      static void         forget           ( Cell* );
+    public:
+                          Snapshot         ( const std::string& path );
+                         ~Snapshot         ();
+      inline const std::string& getPath    () const;
+      inline size_t       getSize          () const;
+             Cell*        getTopCell       () const;
+             bool         hasComponents    ( const Cell* ) const;
+             Cell*        loadNetlist      ();
+             void         loadComponents   ( Cell* );
+             void         loadComponents   ();
+    private:
+      template< typename Entry >
+      inline const Entry* _getEntries      ( uint64_t offset, uint64_t size ) const;
+             std::string  _getString       ( uint32_t id ) const;
+             const Name&  _getName         ( uint32_t id );
+             const Layer* _getLayer        ( uint32_t id );
+             Cell*        _loadCell        ( uint32_t id );
+             void         _loadComponents  ( uint32_t id );
+             void         _release         ( const Cell* );
+    private:
+                          Snapshot         ( const Snapshot& );
+             Snapshot&    operator=        ( const Snapshot& );
+    private:
+      std::string                                _path;
+      const char*                                _base;
+      size_t                                     _size;
+      std::vector<Name>                          _names;
+      std::vector<const Layer*>                  _layers;
+      std::vector<Cell*>                         _cells;
+      std::vector< std::vector<Net*> >           _nets;
+      std::vector< std::vector<Instance*> >      _instances;
+      std::vector< std::vector<Plug*> >          _plugs;
+      std::unordered_map<const Cell*,uint32_t>   _pendings;
+    private:
+      static std::unordered_map<const Cell*,Snapshot*>  _lazies;
+  };
+
+
+  inline const std::string& Snapshot::getPath () const { return _path; }
+  inline size_t             Snapshot::getSize () const { return _size; }
+
+
+}  // Hurricane namespace.
@@ -135,6 +135,6 @@ extern tstream  cdebug;
 
 
 #define  cdebug_log(level,indent)   if (cdebug.enabled(level)) cdebug.log(level,indent)
-#define  cdebug_tabw(level,indent)  cdebug.tabw(level,indent)
+#define  cdebug_tabw(level,indent)  if (cdebug.enabled(level)) cdebug.tabw(level,indent)
 
 #endif  // HURRICANE_TSTREAM_H
@@ -20,6 +20,7 @@
 #ifndef HURRICANE_UPDATE_SESSION
 #define HURRICANE_UPDATE_SESSION
 
+#include <unordered_set>
 #include "hurricane/Property.h"
 
 namespace Hurricane {
@@ -39,11 +40,22 @@ class UpdateSession : public SharedProperty {
 // *****
 
     public: typedef SharedProperty Inherit;
+    public: enum Flags { NoFlags = 0
+                       , Bulk    = (1 << 0)
+                       };
+
+// Attributes
+// **********
+
+    private: static unsigned int _threads;
+    private: unsigned int _flags;
+    private: vector<Go*> _gos;
+    private: std::unordered_set<Go*> _releaseds;
 
 // Constructors
 // ************
 
-    protected: UpdateSession();
+    protected: UpdateSession(unsigned int flags);
 
     public: virtual void destroy();
 
@@ -52,18 +64,23 @@ class UpdateSession : public SharedProperty {
 
     public: static const Name& getPropertyName();
     public: virtual Name getName() const {return getPropertyName();};
+    public: bool isBulk() const {return (_flags & Bulk);};
+    public: static unsigned int getThreads() {return _threads;};
+    public: static void setThreads(unsigned int threads);
 
 // Managers
 // ********
 
     public: virtual void onCapturedBy(DBo* owner);
+    public: virtual void onReleasedBy(DBo* owner);
     public: virtual void onNotOwned();
 
 // Ohers
 // *****
 
-    public: static UpdateSession* _create();
+    public: static UpdateSession* _create(unsigned int flags = NoFlags);
     protected: virtual void _postCreate();
+    private: void _materializeBulk();
 
     public: void _destroy();
     protected: virtual void _preDestroy();
@@ -72,7 +89,7 @@ class UpdateSession : public SharedProperty {
     public: virtual string _getString() const;
     public: virtual Record* _getRecord() const;
 
-    public: static void open();
+    public: static void open(unsigned int flags = NoFlags);
     public: static void close();
     public: static void reset();
     public: static size_t  getStackSize();
@@ -14,6 +14,7 @@
 // +-----------------------------------------------------------------+
 
 
+#include "hurricane/Snapshot.h"
 #include "hurricane/isobar/PyCell.h"
 #include "hurricane/isobar/PyBox.h"
 #include "hurricane/isobar/PyLibrary.h"
@@ -106,6 +107,49 @@ extern "C" {
     return PyCell_Link(cell);
   }
 
+
+  // ---------------------------------------------------------------
+  // Attribute Method  :  "PyCell_fromSnapshot ()"
+
+  PyObject* PyCell_fromSnapshot ( PyObject*, PyObject* args )
+  {
+    cdebug_log(20,0) << "PyCell_fromSnapshot()" << endl;
+
+    char*        path  = NULL;
+    unsigned int flags = Snapshot::NoFlags;
+    Cell*        cell  = NULL;
+
+    HTRY
+      if (PyArg_ParseTuple(args,"s|I:Cell.fromSnapshot", &path, &flags)) {
+        cell = Snapshot::load( path, flags );
+      } else {
+        PyErr_SetString( ConstructorError, "Cell.fromSnapshot(): Takes a string and an optional flags parameter." );
+        return NULL;
+      }
+    HCATCH
+
+    return PyCell_Link(cell);
+  }
+
+
+  // ---------------------------------------------------------------
+  // Attribute Method  :  "PyCell_saveSnapshot ()"
+
+  static PyObject* PyCell_saveSnapshot ( PyCell *self, PyObject* args ) {
+    cdebug_log(20,0) << "PyCell_saveSnapshot ()" << endl;
+
+    HTRY
+    METHOD_HEAD ( "Cell.saveSnapshot()" )
+    char* path = NULL;
+    if (not PyArg_ParseTuple(args,"s:Cell.saveSnapshot", &path)) {
+      PyErr_SetString( ConstructorError, "Cell.saveSnapshot(): Takes exactly one string parameter." );
+      return NULL;
+    }
+    Snapshot::save( cell, path );
+    HCATCH
+    Py_RETURN_NONE;
+  }
+
   
   // ---------------------------------------------------------------
   // Attribute Method  :  "PyCell_getLibrary ()"
@@ -691,6 +735,42 @@ extern "C" {
   }
   
   
+  // ---------------------------------------------------------------
+  // Attribute Method  :  "PyCell_setRTreeIndex ()"
+
+  static PyObject* PyCell_setRTreeIndex ( PyCell *self, PyObject* args ) {
+    cdebug_log(20,0) << "PyCell_setRTreeIndex ()" << endl;
+
+    HTRY
+    METHOD_HEAD ( "Cell.setRTreeIndex()" )
+    PyObject* arg0;
+    if (!PyArg_ParseTuple(args,"O:Cell.setRTreeIndex", &arg0) && PyBool_Check(arg0)) {
+      return NULL;
+    }
+    PyObject_IsTrue(arg0)?cell->setRTreeIndex(true):cell->setRTreeIndex(false);
+    HCATCH
+    Py_RETURN_NONE;
+  }
+  
+  
+  // ---------------------------------------------------------------
+  // Attribute Method  :  "PyCell_setHyperNetIndex ()"
+
+  static PyObject* PyCell_setHyperNetIndex ( PyCell *self, PyObject* args ) {
+    cdebug_log(20,0) << "PyCell_setHyperNetIndex ()" << endl;
+
+    HTRY
+    METHOD_HEAD ( "Cell.setHyperNetIndex()" )
+    PyObject* arg0;
+    if (!PyArg_ParseTuple(args,"O:Cell.setHyperNetIndex", &arg0) && PyBool_Check(arg0)) {
+      return NULL;
+    }
+    PyObject_IsTrue(arg0)?cell->setHyperNetIndex(true):cell->setHyperNetIndex(false);
+    HCATCH
+    Py_RETURN_NONE;
+  }
+  
+  
   // ---------------------------------------------------------------
   // Attribute Method  :  "PyCell_setAbstractedSupply ()"
 
@@ -800,6 +880,8 @@ extern "C" {
   // Standart Predicates (Attributes).
   DirectGetBoolAttribute(PyCell_isTerminal         , isTerminal         ,PyCell,Cell)
   DirectGetBoolAttribute(PyCell_isTerminalNetlist  , isTerminalNetlist  ,PyCell,Cell)
+  DirectGetBoolAttribute(PyCell_isRTreeIndexed     , isRTreeIndexed     ,PyCell,Cell)
+  DirectGetBoolAttribute(PyCell_isHyperNetIndexed  , isHyperNetIndexed  ,PyCell,Cell)
   DirectGetBoolAttribute(PyCell_isUnique           , isUnique           ,PyCell,Cell)
   DirectGetBoolAttribute(PyCell_isUniquified       , isUniquified       ,PyCell,Cell)
   DirectGetBoolAttribute(PyCell_isUniquifyMaster   , isUniquifyMaster   ,PyCell,Cell)
@@ -827,6 +909,9 @@ extern "C" {
   PyMethodDef PyCell_Methods[] =
     { { "create"              , (PyCFunction)PyCell_create               , METH_VARARGS|METH_STATIC
                               , "Create a new cell." }
+    , { "fromSnapshot"        , (PyCFunction)PyCell_fromSnapshot         , METH_VARARGS|METH_STATIC
+                              , "Load a cell hierarchy from a binary snapshot file (components created on materialize(), unless flags is 1, eager)." }
+    , { "saveSnapshot"        , (PyCFunction)PyCell_saveSnapshot         , METH_VARARGS, "Save the cell hierarchy into a binary snapshot file." }
   //, { "getFlags"            , (PyCFunction)PyCell_getFlags             , METH_NOARGS , "Returns state flags." }
     , { "getLibrary"          , (PyCFunction)PyCell_getLibrary           , METH_NOARGS , "Returns the library owning the cell." }
     , { "getName"             , (PyCFunction)PyCell_getName              , METH_NOARGS , "Returns the name of the cell." }
@@ -857,6 +942,8 @@ extern "C" {
     , { "isTerminal"          , (PyCFunction)PyCell_isTerminal          , METH_NOARGS , "Returns true if the cell is marked as terminal, else false." }
     , { "isTerminalNetlist"   , (PyCFunction)PyCell_isTerminalNetlist   , METH_NOARGS , "Returns true if the cell is a leaf of the hierarchy, else false." }
     , { "isUnique"            , (PyCFunction)PyCell_isUnique            , METH_NOARGS , "Returns true if the cell has one or less instance." }
+    , { "isRTreeIndexed"      , (PyCFunction)PyCell_isRTreeIndexed      , METH_NOARGS , "Returns true if the area queries use packed R-trees." }
+    , { "isHyperNetIndexed"   , (PyCFunction)PyCell_isHyperNetIndexed   , METH_NOARGS , "Returns true if the HyperNet queries use a flattened connectivity index." }
     , { "isUniquified"        , (PyCFunction)PyCell_isUniquified        , METH_NOARGS , "Returns true if the cell is the result of an uniquification." }
     , { "isUniquifyMaster"    , (PyCFunction)PyCell_isUniquifyMaster    , METH_NOARGS , "Returns true if the cell is the reference for an uniquification." }
     , { "isRouted"            , (PyCFunction)PyCell_isRouted            , METH_NOARGS , "Returns true if the cell is flagged as routed." }
@@ -872,6 +959,8 @@ extern "C" {
     , { "setAbutmentBox"      , (PyCFunction)PyCell_setAbutmentBox      , METH_VARARGS, "Sets the cell abutment box." }
     , { "setTerminalNetlist"  , (PyCFunction)PyCell_setTerminalNetlist  , METH_VARARGS, "Sets the cell terminal netlist status." }
     , { "setAbstractedSupply" , (PyCFunction)PyCell_setAbstractedSupply , METH_VARARGS, "Sets the cell abstracted supply status." }
+    , { "setRTreeIndex"       , (PyCFunction)PyCell_setRTreeIndex       , METH_VARARGS, "Use packed R-trees (instead of the QuadTrees) for the area queries." }
+    , { "setHyperNetIndex"    , (PyCFunction)PyCell_setHyperNetIndex    , METH_VARARGS, "Maintain a flattened connectivity index for the HyperNet queries." }
     , { "setRouted"           , (PyCFunction)PyCell_setRouted           , METH_VARARGS, "Sets the cell routed status." }
     , { "setPad"              , (PyCFunction)PyCell_setPad              , METH_VARARGS, "Sets/reset the cell I/O pad flag." }
     , { "setFeed"             , (PyCFunction)PyCell_setFeed             , METH_VARARGS, "Sets/reset the cell feed (filler cell) flag." }
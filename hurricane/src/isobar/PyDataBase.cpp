@@ -122,6 +122,9 @@ extern "C" {
   // Standart Accessors (Attributes).
   // Standart Destroy (Attribute).
   DirectVoidMethod(DataBase,db,clear)
+  DirectVoidMethod(DataBase,db,freeze)
+  DirectVoidMethod(DataBase,db,unfreeze)
+  DirectGetBoolAttribute(PyDataBase_isFrozen,isFrozen,PyDataBase,DataBase)
   DBoDestroyAttribute(PyDataBase_destroy,PyDataBase)
 
 
@@ -137,6 +140,9 @@ extern "C" {
     , { "getRootLibrary", (PyCFunction)PyDataBase_getRootLibrary, METH_NOARGS , "Return the root library" }
     , { "getCell"       , (PyCFunction)PyDataBase_getCell       , METH_VARARGS, "Return a Cell" }
     , { "clear"         , (PyCFunction)PyDataBase_clear         , METH_NOARGS , "Clear all the cells, keeps technology" }
+    , { "freeze"        , (PyCFunction)PyDataBase_freeze        , METH_NOARGS , "Make the DataBase read-only, for concurrent accesses" }
+    , { "unfreeze"      , (PyCFunction)PyDataBase_unfreeze      , METH_NOARGS , "Make the DataBase modifiable again" }
+    , { "isFrozen"      , (PyCFunction)PyDataBase_isFrozen      , METH_NOARGS , "Tells if the DataBase is frozen (read-only)" }
     , { "destroy"       , (PyCFunction)PyDataBase_destroy       , METH_NOARGS
                         , "Destroy associated hurricane object The python object remains." }
     , {NULL, NULL, 0, NULL}           /* sentinel */
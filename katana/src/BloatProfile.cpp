@@ -28,6 +28,7 @@
 #include "hurricane/Instance.h"
 #include "hurricane/Plug.h"
 #include "hurricane/Path.h"
+#include "hurricane/PathIdVector.h"
 #include "hurricane/Query.h"
 #include "crlcore/Utilities.h"
 #include "crlcore/AllianceFramework.h"
@@ -45,6 +46,7 @@ namespace {
   using Hurricane::Entity;
   using Hurricane::Instance;
   using Hurricane::Path;
+  using Hurricane::PathIdVector;
   using Hurricane::Transformation;
   using Hurricane::Occurrence;
   using Etesian::BloatState;
@@ -60,47 +62,35 @@ namespace {
 
   class FlatInstance {
     public:
-      static DbU::Unit   getXFromOccurrence ( Occurrence );
-      static DbU::Unit   getYFromOccurrence ( Occurrence );
+      static Box         getAbFromOccurrence ( Occurrence, const Transformation& pathTransf );
     public:
-      inline             FlatInstance       ( Occurrence );
-      inline DbU::Unit   getX               () const;
-      inline Occurrence  getOccurrence      () const;
+      inline             FlatInstance        ( Occurrence, DbU::Unit x );
+      inline DbU::Unit   getX                () const;
+      inline Occurrence  getOccurrence       () const;
     private:
       DbU::Unit   _x;
       Occurrence  _instanceOcc;
   };
 
 
-  DbU::Unit  FlatInstance::getXFromOccurrence ( Occurrence o )
-  {
-    Instance*      instance = dynamic_cast<Instance*>( o.getEntity() );
-    Transformation transf   = instance->getTransformation();
-    o.getPath().getTransformation().applyOn( transf );
-    Box ab = instance->getMasterCell()->getAbutmentBox();
-    transf.applyOn( ab );
-    return ab.getXMin();
-  }
-
-
-  DbU::Unit  FlatInstance::getYFromOccurrence ( Occurrence o )
+  Box  FlatInstance::getAbFromOccurrence ( Occurrence o, const Transformation& pathTransf )
   {
     Instance*      instance = dynamic_cast<Instance*>( o.getEntity() );
     Transformation transf   = instance->getTransformation();
 
   //cerr << "Inst transf:" << transf << endl;
-  //cerr << "Path transf:" << o.getPath().getTransformation() << endl;
+  //cerr << "Path transf:" << pathTransf << endl;
     
-    o.getPath().getTransformation().applyOn( transf );
+    pathTransf.applyOn( transf );
     Box ab = instance->getMasterCell()->getAbutmentBox();
     transf.applyOn( ab );
-    return ab.getYMin();
+    return ab;
   }
 
 
 
-  inline  FlatInstance::FlatInstance ( Occurrence o )
-    : _x(getXFromOccurrence(o))
+  inline  FlatInstance::FlatInstance ( Occurrence o, DbU::Unit x )
+    : _x(x)
     , _instanceOcc(o)
   { }
 
@@ -122,7 +112,7 @@ namespace {
       inline bool       useStaticBloatProfile () const;
       inline uint32_t   getBloatOverloadAdd   () const;
       inline DbU::Unit  getY                  () const;
-      inline void       add                   ( Occurrence );
+      inline void       add                   ( Occurrence, DbU::Unit x );
       inline void       sort                  ();
              void       tagOverloadeds        ( size_t& count, size_t& newCount );
     private:
@@ -140,7 +130,7 @@ namespace {
 
 
   inline DbU::Unit  Slice::getY () const         { return _left->getYMin(); }
-  inline void       Slice::add  ( Occurrence o ) { _instances.push_back( o ); }
+  inline void       Slice::add  ( Occurrence o, DbU::Unit x ) { _instances.push_back( FlatInstance(o,x) ); }
   inline void       Slice::sort ()               { std::sort( _instances.begin(), _instances.end() ); }
 
 
@@ -156,10 +146,11 @@ namespace {
       inline void          sort           ();
       inline void          tagOverloadeds ();
     private:
-      KatanaEngine*   _katana;
-      Box             _cellAb;
-      DbU::Unit       _sliceHeight;
-      vector<Slice*>  _slices;
+      KatanaEngine*                 _katana;
+      Box                           _cellAb;
+      DbU::Unit                     _sliceHeight;
+      vector<Slice*>                _slices;
+      PathIdVector<Transformation>  _pathTransfs;
   };
 
 
@@ -168,6 +159,7 @@ namespace {
     , _cellAb     (_katana->getCell()->getAbutmentBox())
     , _sliceHeight(_katana->getConfiguration()->getSliceHeight())
     , _slices     ()
+    , _pathTransfs()
   {
     GCell* left     = _katana->getSouthWestGCell();
     size_t slicesNb = _cellAb.getHeight() / _sliceHeight;
@@ -215,7 +207,13 @@ namespace {
 
   inline void  Slices::add ( Occurrence o )
   {
-    DbU::Unit y      = FlatInstance::getYFromOccurrence( o );
+  // The instances sharing the same path (siblings) are numerous, compute
+  // the path transformation only once.
+    Path path = o.getPath();
+    if (not _pathTransfs.has(path)) _pathTransfs[ path ] = path.getTransformation();
+
+    Box       ab     = FlatInstance::getAbFromOccurrence( o, _pathTransfs.get(path) );
+    DbU::Unit y      = ab.getYMin();
     size_t    islice = (y - _cellAb.getYMin()) / _sliceHeight;
 
     if (islice >= _slices.size()) {
@@ -227,7 +225,7 @@ namespace {
                  );
     }
 
-    _slices[islice]->add( o );
+    _slices[islice]->add( o, ab.getXMin() );
   }
   
   
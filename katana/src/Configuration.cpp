@@ -41,7 +41,11 @@ namespace Katana {
     : Anabatic::Configuration()
     , _postEventCb         ()
     , _bloat               (Cfg::getParamString("etesian.bloat"               ,"disabled")->asString() )
+    , _dijkstraQueue       (Cfg::getParamString("katana.dijkstraQueue"        ,"heap"    )->asString() )
+    , _dijkstraSearch      (Cfg::getParamString("katana.dijkstraSearch"       ,"standard")->asString() )
     , _searchHalo          (Cfg::getParamInt   ("katana.searchHalo"           ,      1)->asInt())
+    , _globalThreads       (Cfg::getParamInt   ("katana.globalThreads"        ,      1)->asInt())
+    , _updateThreads       (Cfg::getParamInt   ("katana.updateThreads"        ,      1)->asInt())
     , _longWireUpThreshold1(Cfg::getParamInt   ("katana.longWireUpThreshold1" ,     60)->asInt())
     , _longWireUpReserve1  (Cfg::getParamDouble("katana.longWireUpReserve1"   ,    1.0)->asDouble())
     , _hTracksReservedLocal(Cfg::getParamInt   ("katana.hTracksReservedLocal" ,      3)->asInt())
@@ -59,6 +63,8 @@ namespace Katana {
     , _profileEventCosts   (Cfg::getParamBool  ("katana.profileEventCosts"    ,false  )->asBool())
     , _runRealignStage     (Cfg::getParamBool  ("katana.runRealignStage"      ,true   )->asBool())
     , _disableStackedVias  (Cfg::getParamBool  ("katana.disableStackedVias"   ,false  )->asBool())
+    , _traceEvents         (Cfg::getParamBool  ("katana.traceEvents"          ,false  )->asBool())
+    , _eventsReport        (Cfg::getParamBool  ("katana.eventsReport"         ,false  )->asBool())
   {
     _ripupLimits[StrapRipupLimit]      = Cfg::getParamInt("katana.strapRipupLimit"      ,16)->asInt();
     _ripupLimits[LocalRipupLimit]      = Cfg::getParamInt("katana.localRipupLimit"      , 7)->asInt();
@@ -95,7 +101,11 @@ namespace Katana {
     : Anabatic::Configuration(*other.base())
     , _postEventCb         (other._postEventCb)
     , _bloat               (other._bloat)
+    , _dijkstraQueue       (other._dijkstraQueue)
+    , _dijkstraSearch      (other._dijkstraSearch)
     , _searchHalo          (other._searchHalo)
+    , _globalThreads       (other._globalThreads)
+    , _updateThreads       (other._updateThreads)
     , _longWireUpThreshold1(other._longWireUpThreshold1)
     , _longWireUpReserve1  (other._longWireUpReserve1)
     , _hTracksReservedLocal(other._hTracksReservedLocal)
@@ -113,6 +123,8 @@ namespace Katana {
     , _profileEventCosts   (other._profileEventCosts)
     , _runRealignStage     (other._runRealignStage)
     , _disableStackedVias  (other._disableStackedVias)
+    , _traceEvents         (other._traceEvents)
+    , _eventsReport        (other._eventsReport)
   {
     _ripupLimits[StrapRipupLimit]      = other._ripupLimits[StrapRipupLimit];
     _ripupLimits[LocalRipupLimit]      = other._ripupLimits[LocalRipupLimit];
@@ -189,6 +201,10 @@ namespace Katana {
     cout << Dots::asString("     - Net builder style"                  ,getNetBuilderStyle()) << endl;
     cout << Dots::asString("     - Routing style"                      ,getRoutingStyle().asString()) << endl;
     cout << Dots::asUInt  ("     - Dijkstra GR search halo"            ,getSearchHalo()) << endl;
+    cout << Dots::asString("     - Dijkstra GR priority queue"         ,getDijkstraQueue()) << endl;
+    cout << Dots::asString("     - Dijkstra GR search"                 ,getDijkstraSearch()) << endl;
+    cout << Dots::asUInt  ("     - Dijkstra GR threads"                ,getGlobalThreads()) << endl;
+    cout << Dots::asUInt  ("     - QuadTree update threads"            ,getUpdateThreads()) << endl;
     cout << Dots::asBool  ("     - Use GR density estimate"            ,useGlobalEstimate()) << endl;
     cout << Dots::asBool  ("     - Use static bloat profile"           ,useStaticBloatProfile()) << endl;
     cout << Dots::asInt   ("     - GCell terminal(RP) saturate number" ,getSaturateRp()) << endl;
@@ -202,6 +218,8 @@ namespace Katana {
     cout << Dots::asUInt  ("     - Terminal saturated edge capacity"   ,_termSatReservedLocal) << endl;
     cout << Dots::asUInt  ("     - Terminal saturated GCell threshold" ,_termSatThreshold) << endl;
     cout << Dots::asULong ("     - Events limit (iterations)"          ,_eventsLimit) << endl;
+    cout << Dots::asBool  ("     - Trace every event"                  ,_traceEvents) << endl;
+    cout << Dots::asBool  ("     - Write events report"                ,_eventsReport) << endl;
     cout << Dots::asUInt  ("     - Ripup limit, straps & unbreakables" ,_ripupLimits[StrapRipupLimit]) << endl;
     cout << Dots::asUInt  ("     - Ripup limit, locals"                ,_ripupLimits[LocalRipupLimit]) << endl;
     cout << Dots::asUInt  ("     - Ripup limit, globals"               ,_ripupLimits[GlobalRipupLimit]) << endl;
@@ -232,7 +250,11 @@ namespace Katana {
     Record* record = Super::_getRecord();
     if ( record ) {
       record->add ( getSlot("_bloat"                ,_bloat                ) );
+      record->add ( getSlot("_dijkstraQueue"        ,_dijkstraQueue        ) );
+      record->add ( getSlot("_dijkstraSearch"       ,_dijkstraSearch       ) );
       record->add ( getSlot("_searchHalo"           ,_searchHalo           ) );
+      record->add ( getSlot("_globalThreads"        ,_globalThreads        ) );
+      record->add ( getSlot("_updateThreads"        ,_updateThreads        ) );
       record->add ( getSlot("_longWireUpThreshold1" ,_longWireUpThreshold1 ) );
       record->add ( getSlot("_longWireUpReserved1"  ,_longWireUpReserve1   ) );
       record->add ( getSlot("_hTracksReservedLocal" ,_hTracksReservedLocal ) );
@@ -241,6 +263,8 @@ namespace Katana {
       record->add ( getSlot("_vTracksReservedMin"   ,_vTracksReservedMin   ) );
       record->add ( getSlot("_ripupCost"            ,_ripupCost            ) );
       record->add ( getSlot("_eventsLimit"          ,_eventsLimit          ) );
+      record->add ( getSlot("_traceEvents"          ,_traceEvents          ) );
+      record->add ( getSlot("_eventsReport"         ,_eventsReport         ) );
 
       record->add ( getSlot("_ripupLimits[StrapRipupLimit]"      ,_ripupLimits[StrapRipupLimit]     ) );
       record->add ( getSlot("_ripupLimits[LocalRipupLimit]"      ,_ripupLimits[LocalRipupLimit]     ) );
@@ -14,12 +14,16 @@
 // +-----------------------------------------------------------------+
 
 
+#include <atomic>
+#include <thread>
 #include "flute.h"
 #include "hurricane/utilities/Dots.h"
 #include "hurricane/Warning.h"
 #include "hurricane/Breakpoint.h"
 #include "hurricane/RoutingPad.h"
 #include "hurricane/Cell.h"
+#include "hurricane/NetRoutingProperty.h"
+#include "hurricane/DebugSession.h"
 #include "hurricane/viewer/CellViewer.h"
 #include "crlcore/Utilities.h"
 #include "crlcore/Histogram.h"
@@ -41,11 +45,19 @@ namespace {
   using std::left;
   using std::right;
   using std::set;
+  using std::vector;
+  using std::pair;
+  using std::make_pair;
   using Hurricane::DbU;
+  using Hurricane::Box;
   using Hurricane::Interval;
   using Hurricane::DBo;
   using Hurricane::Net;
   using Hurricane::Segment;
+  using Hurricane::RoutingPad;
+  using Hurricane::DebugSession;
+  using Hurricane::NetRoutingState;
+  using Hurricane::NetRoutingExtension;
   using Utilities::Dots;
   using Anabatic::Flags;
   using Anabatic::Edge;
@@ -53,6 +65,8 @@ namespace {
   using Anabatic::Vertex;
   using Anabatic::EdgeCapacity;
   using Anabatic::AnabaticEngine;
+  using Anabatic::Dijkstra;
+  using Anabatic::NetData;
   using Etesian::BloatExtension;
   using namespace Katana;
 
@@ -360,6 +374,194 @@ namespace {
   }
   
 
+// -------------------------------------------------------------------
+// Class  :  "DisjointRouter".
+//
+// Multi-threaded global routing. Nets are grouped into batches whose
+// footprints are disjoint. The footprint (zone) of a net is the search
+// area of Dijkstra inflated by two GCells, so neither the Vertexes nor
+// the Edges read or written by a search can be shared with another
+// net of the batch. Inside a batch:
+//
+// 0. The RoutingPads components and the zones of all the nets are
+//    computed once, sequentially, before the first batch.
+// 1. Loading is sequential (it creates the GContacts). All the nets
+//    share the same stamp, which is possible as their Vertexes are
+//    disjoint.
+// 2. The searches are run concurrently, one worker Dijkstra per net.
+//    They only trace through the level guarded cdebug macros, and do
+//    not open DebugSessions.
+// 3. Materialization (Hurricane objects and Edge occupancy) is done
+//    sequentially in the net ordering.
+//
+// A net is added to a batch only if its zone is disjoint from *all*
+// the nets scanned before it (batched or deferred), so the routing is
+// equivalent to a reordering of independent nets. The batches do not
+// depend on the thread count, so the result is reproducible whatever
+// the number of threads.
+
+  class DisjointRouter {
+    public:
+                         DisjointRouter    ( KatanaEngine*, const DigitalDistance&, size_t threads );
+                        ~DisjointRouter    ();
+             void        setSearchAreaHalo ( DbU::Unit );
+             size_t      run               ( Dijkstra* master, Dijkstra::Mode );
+             uint64_t    getTotalExpandeds () const;
+    private:
+             Box         _getZone          ( NetData* ) const;
+             void        _routeBatch       ( const vector<NetData*>&, Dijkstra::Mode );
+    private:
+      static const size_t  BatchSize  = 64;
+      static const size_t  WindowSize = 256;
+    private:
+      KatanaEngine*             _katana;
+      DigitalDistance           _prototype;
+      size_t                    _threads;
+      DbU::Unit                 _halo;
+      DbU::Unit                 _marginX;
+      DbU::Unit                 _marginY;
+      vector<Dijkstra*>         _workers;
+      vector<DigitalDistance*>  _distances;
+  };
+
+
+  DisjointRouter::DisjointRouter ( KatanaEngine* katana, const DigitalDistance& prototype, size_t threads )
+    : _katana   (katana)
+    , _prototype(prototype)
+    , _threads  (threads)
+    , _halo     (0)
+    , _marginX  (0)
+    , _marginY  (0)
+    , _workers  ()
+    , _distances()
+  {
+    for ( GCell* gcell : _katana->getGCells() ) {
+      _marginX = std::max( _marginX, 2*gcell->getWidth () );
+      _marginY = std::max( _marginY, 2*gcell->getHeight() );
+    }
+  }
+
+
+  DisjointRouter::~DisjointRouter ()
+  {
+    for ( Dijkstra* worker : _workers ) delete worker;
+  }
+
+
+  uint64_t  DisjointRouter::getTotalExpandeds () const
+  {
+    uint64_t expandeds = 0;
+    for ( Dijkstra* worker : _workers ) expandeds += worker->getTotalExpandeds();
+    return expandeds;
+  }
+
+
+  void  DisjointRouter::setSearchAreaHalo ( DbU::Unit halo )
+  {
+    _halo = halo;
+    for ( Dijkstra* worker : _workers ) worker->setSearchAreaHalo( halo );
+  }
+
+
+  Box  DisjointRouter::_getZone ( NetData* netData ) const
+  {
+    Net*             net   = netData->getNet();
+    NetRoutingState* state = NetRoutingExtension::get( net );
+    if (state and state->isSymmetric())
+      return _katana->getCell()->getAbutmentBox();
+
+    Box zone;
+    for ( RoutingPad* rp : net->getRoutingPads() ) {
+      GCell* gcell = _katana->getGCellUnder( rp->getUserCenter() );
+      if (gcell) zone.merge( gcell->getBoundingBox() );
+    }
+    if (not zone.isEmpty())
+      zone.inflate( _halo + _marginX, _halo + _marginY );
+    return zone;
+  }
+
+
+  void  DisjointRouter::_routeBatch ( const vector<NetData*>& batch, Dijkstra::Mode mode )
+  {
+    for ( size_t i=0 ; i<batch.size() ; ++i ) {
+      _distances[i]->setNet( batch[i]->getNet() );
+      _workers  [i]->load( batch[i]->getNet(), (i == 0) );
+    }
+
+    vector<char>        searcheds ( batch.size(), false );
+    std::atomic<size_t> next      ( 0 );
+    auto searchLoop = [&]() {
+      for ( size_t i=next++ ; i<batch.size() ; i=next++ )
+        searcheds[i] = _workers[i]->search( mode );
+    };
+
+    size_t threadCount = std::min( _threads, batch.size() );
+    if (threadCount > 1) {
+      vector<std::thread> threads;
+      for ( size_t i=0 ; i<threadCount ; ++i ) threads.emplace_back( searchLoop );
+      for ( std::thread& thread : threads ) thread.join();
+    } else
+      searchLoop();
+
+    for ( size_t i=0 ; i<batch.size() ; ++i ) {
+      if (searcheds[i]) {
+        DebugSession::open( batch[i]->getNet(), 111, 120 );
+        _workers[i]->materialize();
+        DebugSession::close();
+      }
+      batch[i]->setGlobalRouted( true );
+    }
+  }
+
+
+  size_t  DisjointRouter::run ( Dijkstra* master, Dijkstra::Mode mode )
+  {
+    while ( _workers.size() < BatchSize ) {
+      _workers.push_back( new Dijkstra(master) );
+      _workers.back()->setSearchAreaHalo( _halo );
+      _distances.push_back( _workers.back()->setDistance( _prototype ) );
+    }
+
+  // The RoutingPads components are selected, then the zones computed, for
+  // all the nets before the first batch is started. selectRpComponent()
+  // modifies the RoutingPads and must not run alongside the searches.
+    vector< pair<NetData*,Box> > pendings;
+    for ( NetData* netData : _katana->getNetOrdering() ) {
+      if (netData->isGlobalRouted() or netData->isExcluded()) continue;
+      for ( RoutingPad* rp : netData->getNet()->getRoutingPads() )
+        _katana->getConfiguration()->selectRpComponent( rp );
+      pendings.push_back( make_pair(netData,Box()) );
+    }
+    for ( auto& pending : pendings ) pending.second = _getZone( pending.first );
+
+    size_t netCount = pendings.size();
+    while ( not pendings.empty() ) {
+      vector<NetData*>             batch;
+      vector< pair<NetData*,Box> > deferreds;
+      vector<Box>                  scanneds;
+
+      size_t i = 0;
+      for ( ; (i < pendings.size()) and (i < WindowSize) and (batch.size() < BatchSize) ; ++i ) {
+        const Box& zone     = pendings[i].second;
+        bool       disjoint = true;
+        for ( const Box& scanned : scanneds ) {
+          if (scanned.intersect(zone)) { disjoint = false; break; }
+        }
+        scanneds.push_back( zone );
+
+        if (disjoint) batch    .push_back( pendings[i].first );
+        else          deferreds.push_back( pendings[i] );
+      }
+      deferreds.insert( deferreds.end(), pendings.begin()+i, pendings.end() );
+      pendings.swap( deferreds );
+
+      _routeBatch( batch, mode );
+    }
+
+    return netCount;
+  }
+
+
 }  // Anonymous namespace.
 
 
@@ -559,6 +761,35 @@ namespace Katana {
     else
       dijkstra->setSearchAreaHalo( Session::getSliceHeight()*getSearchHalo() );
 
+    Dijkstra::Mode dijkstraMode = Dijkstra::Mode::Standart;
+    if      (getConfiguration()->getDijkstraQueue() == "bucket") dijkstraMode |= Dijkstra::Mode::UseBucketQueue;
+    else if (getConfiguration()->getDijkstraQueue() == "set"   ) dijkstraMode |= Dijkstra::Mode::UseSetQueue;
+    else if (getConfiguration()->getDijkstraQueue() != "heap"  )
+      cerr << Warning( "KatanaEngine::runGlobalRouter(): Unknown Dijkstra queue \"%s\", using \"heap\"."
+                     , getConfiguration()->getDijkstraQueue().c_str() ) << endl;
+
+    const string& dijkstraSearch = getConfiguration()->getDijkstraSearch();
+    if      (dijkstraSearch == "astar"              ) dijkstraMode |= Dijkstra::Mode::AStar;
+    else if (dijkstraSearch == "bidirectional"      ) dijkstraMode |= Dijkstra::Mode::Bidirectional;
+    else if (dijkstraSearch == "astar+bidirectional") dijkstraMode |= Dijkstra::Mode::AStar|Dijkstra::Mode::Bidirectional;
+    else if (dijkstraSearch != "standard"           )
+      cerr << Warning( "KatanaEngine::runGlobalRouter(): Unknown Dijkstra search \"%s\", using \"standard\"."
+                     , dijkstraSearch.c_str() ) << endl;
+  // DigitalDistance never costs less than the edge length, times the
+  // scaling for the horizontal ones.
+    dijkstra->setEstimateScale( getConfiguration()->getEdgeHScaling(), 1.0 );
+
+    DisjointRouter* disjointRouter = NULL;
+    if (getConfiguration()->getGlobalThreads() > 1) {
+      if (useGlobalEstimate())
+        cerr << Warning( "KatanaEngine::runGlobalRouter(): Multi-threaded global routing is not\n"
+                         "        compatible with \"katana.useGlobalEstimate\", using one thread." ) << endl;
+      else {
+        disjointRouter = new DisjointRouter ( this, *distance, getConfiguration()->getGlobalThreads() );
+        disjointRouter->setSearchAreaHalo( dijkstra->getSearchAreaHalo() );
+      }
+    }
+
     bool     globalEstimated = false;
     size_t   iteration       = 0;
     size_t   netCount        = 0;
@@ -570,37 +801,43 @@ namespace Katana {
       long   viaCount   = 0;
 
       netCount = 0;
-      for ( NetData* netData : getNetOrdering() ) {
-        if (netData->isGlobalRouted() or netData->isExcluded()) continue;
-        if (netData->isGlobalEstimated()) {
-          updateEstimateDensity( netData, -1.0 );
-          netData->setGlobalEstimated( false );
-        }
+      if (disjointRouter)
+        netCount = disjointRouter->run( dijkstra, dijkstraMode );
+      else {
+        for ( NetData* netData : getNetOrdering() ) {
+          if (netData->isGlobalRouted() or netData->isExcluded()) continue;
+          if (netData->isGlobalEstimated()) {
+            updateEstimateDensity( netData, -1.0 );
+            netData->setGlobalEstimated( false );
+          }
+
+          distance->setNet( netData->getNet() );
+          dijkstra->load( netData->getNet() );
+          dijkstra->run( dijkstraMode );
+          netData->setGlobalRouted( true );
+          cdebug_log(159,0) << "Expanded " << dijkstra->getExpandeds()
+                            << " vertexes for " << netData->getNet() << endl;
+          ++netCount;
+
+          // if (netData->getNet()->getName() == Name("mips_r3000_1m_dp_shift32_rshift_se_msb")) {
+          //   Session::close();
+          //   Breakpoint::stop( 1, "After global routing of \"mips_r3000_1m_dp_shift32_rshift_se_msb\"." );
+          //   openSession();
+          // }
 
-        distance->setNet( netData->getNet() );
-        dijkstra->load( netData->getNet() );
-        dijkstra->run();
-        netData->setGlobalRouted( true );
-        ++netCount;
-
-        // if (netData->getNet()->getName() == Name("mips_r3000_1m_dp_shift32_rshift_se_msb")) {
-        //   Session::close();
-        //   Breakpoint::stop( 1, "After global routing of \"mips_r3000_1m_dp_shift32_rshift_se_msb\"." );
-        //   openSession();
-        // }
-
-        if (useGlobalEstimate()) {
-        // Triggers the global routing when we reach nets of less than 11 terminals.
-        // High degree nets are routed straight (without taking account the smalls).
-        // See the SparsityOrder comparison function.
-          if ( (netData->getRpCount() < 11) and not globalEstimated ) {
-            for ( NetData* netData2 : getNetOrdering() ) {
-              if (netData2->isGlobalRouted() or netData2->isExcluded()) continue;
-
-              updateEstimateDensity( netData2, 1.0 );
-              netData2->setGlobalEstimated( true );
+          if (useGlobalEstimate()) {
+          // Triggers the global routing when we reach nets of less than 11 terminals.
+          // High degree nets are routed straight (without taking account the smalls).
+          // See the SparsityOrder comparison function.
+            if ( (netData->getRpCount() < 11) and not globalEstimated ) {
+              for ( NetData* netData2 : getNetOrdering() ) {
+                if (netData2->isGlobalRouted() or netData2->isExcluded()) continue;
+
+                updateEstimateDensity( netData2, 1.0 );
+                netData2->setGlobalEstimated( true );
+              }
+              globalEstimated = true;
             }
-            globalEstimated = true;
           }
         }
       }
@@ -643,6 +880,7 @@ namespace Katana {
         }
 
         dijkstra->setSearchAreaHalo( (getSearchHalo() + 3*(iteration/3)) * Session::getSliceHeight() );
+        if (disjointRouter) disjointRouter->setSearchAreaHalo( dijkstra->getSearchAreaHalo() );
       }
 
       cmess2 << " ovE:" << setw(4) << overflow << " ovWL:" << setw(5) << edgeOverflowWL;
@@ -659,6 +897,14 @@ namespace Katana {
     stopMeasures();
     printMeasures( "Dijkstra" );
 
+    uint64_t expandeds = dijkstra->getTotalExpandeds();
+    if (disjointRouter) {
+      expandeds += disjointRouter->getTotalExpandeds();
+      delete disjointRouter;
+    }
+    cmess2 << ::Dots::asULong( "     - Expanded vertexes", expandeds ) << endl;
+    addMeasure<uint64_t>( "GRExp", expandeds, 12 );
+
     uint32_t hoverflow = 0;
     uint32_t voverflow = 0;
     if (not ovEdges.empty()) {
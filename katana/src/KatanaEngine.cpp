@@ -842,6 +842,7 @@ namespace Katana {
     measuresLabels.push_back( getMeasureLabel("V-ovE"  ) );
     measuresLabels.push_back( getMeasureLabel("Globals") );
     measuresLabels.push_back( getMeasureLabel("Edges"  ) );
+    measuresLabels.push_back( getMeasureLabel("GRExp"  ) );
     measuresLabels.push_back( getMeasureLabel("assignT") );
     measuresLabels.push_back( getMeasureLabel("algoT"  ) );
     measuresLabels.push_back( getMeasureLabel("algoS"  ) );
@@ -852,6 +853,10 @@ namespace Katana {
     measuresLabels.push_back( getMeasureLabel("WLER(%)") );
     measuresLabels.push_back( getMeasureLabel("Events" ) );
     measuresLabels.push_back( getMeasureLabel("UEvents") );
+    measuresLabels.push_back( getMeasureLabel("EvAlloc") );
+    measuresLabels.push_back( getMeasureLabel("TcAlloc") );
+    measuresLabels.push_back( getMeasureLabel("TeAlloc") );
+    measuresLabels.push_back( getMeasureLabel("PoolKb" ) );
 
     const MeasuresSet* measures = Measures::get( getCell() );
 
@@ -966,6 +971,14 @@ namespace Katana {
       }
 
       Session::close();
+
+      for ( SlabAllocator* allocator : { &TrackElement::getAllocator()
+                                       , &TrackCost   ::getAllocator()
+                                       , &RoutingEvent::getAllocator() } ) {
+        if (not allocator->release())
+          cerr << Bug( "KatanaEngine::_preDestroy(): %llu %s chunks still in use, slabs not released."
+                     , (unsigned long long)allocator->getInUse(), allocator->getName() ) << endl;
+      }
     }
 
     cdebug_tabw(155,-1);
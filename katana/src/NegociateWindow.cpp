@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <fstream>
 #include <iomanip>
+#include <chrono>
 #include "hurricane/Breakpoint.h"
 #include "hurricane/DebugSession.h"
 #include "hurricane/UpdateSession.h"
@@ -253,6 +254,87 @@ namespace {
   }
 
 
+// -------------------------------------------------------------------
+// Class  :  "EventProgress".
+//
+// Rate limited display of the events processing. The clock is only
+// sampled once every (SampleMask+1) events and the status line is
+// refreshed at most once per second. When tracing is requested, the
+// old behavior (one detailed line per event) is restored.
+
+  class EventProgress {
+    public:
+      static const size_t  SampleMask = 0x3f;
+    public:
+                   EventProgress ( const char* tag, bool trace );
+      inline void  update        ( const RoutingEvent*, size_t remains );
+             void  close         ( size_t remains );
+    private:
+             void  _printStatus  ( size_t remains );
+             void  _printTrace   ( const RoutingEvent* );
+    private:
+      const char*                            _tag;
+      bool                                   _trace;
+      size_t                                 _count;
+      std::chrono::steady_clock::time_point  _last;
+  };
+
+
+  EventProgress::EventProgress ( const char* tag, bool trace )
+    : _tag  (tag)
+    , _trace(trace)
+    , _count(0)
+    , _last (std::chrono::steady_clock::now())
+  { }
+
+
+  inline void  EventProgress::update ( const RoutingEvent* event, size_t remains )
+  {
+    if (not cmess2.enabled()) return;
+    if (_trace) { _printTrace( event ); return; }
+    if (_count++ & SampleMask) return;
+
+    auto now = std::chrono::steady_clock::now();
+    if ((_count > 1) and (now - _last < std::chrono::seconds(1))) return;
+    _last = now;
+
+    _printStatus( remains );
+    if (tty::enabled()) cmess2 << tty::cr;
+    else                cmess2 << endl;
+    cmess2.flush();
+  }
+
+
+  void  EventProgress::close ( size_t remains )
+  {
+    if (not cmess2.enabled() or _trace or not _count) return;
+    _printStatus( remains );
+    cmess2 << endl;
+  }
+
+
+  void  EventProgress::_printStatus ( size_t remains )
+  {
+    cmess2 << "        <" << _tag << ":" << tty::bold << right << setw(8) << setfill('0')
+           << RoutingEvent::getProcesseds() << tty::reset
+           << " remains:" << right << setw(8) << setfill('0')
+           << remains
+           << setfill(' ') << tty::reset << ">";
+  }
+
+
+  void  EventProgress::_printTrace ( const RoutingEvent* event )
+  {
+    cmess2 << "        <" << _tag << ":" << right << setw(8) << setfill('0')
+           << RoutingEvent::getProcesseds() << setfill(' ') << " "
+           << event->getEventLevel() << ":" << event->getPriority()
+           << ":" << DbU::getValueString(event->getSegment()->getLength()) << "> "
+           << event->getSegment()
+           << endl;
+    cmess2.flush();
+  }
+
+
 } // Anonymous namespace.
 
 
@@ -282,6 +364,42 @@ namespace Katana {
   using Anabatic::perpandicularTo;
 
 
+// -------------------------------------------------------------------
+// Class  :  "Statistics".
+
+
+  void  Statistics::dump ( ostream& out ) const
+  {
+    out << "# Katana negociation events report.\n"
+        << "loaded        " << _loadedEventsCount    << "\n"
+        << "processed     " << _processedEventsCount << "\n"
+        << "unique        " << _eventsCount          << "\n"
+        << "ripups        " << ((_processedEventsCount > _loadedEventsCount)
+                                ? (_processedEventsCount - _loadedEventsCount) : 0) << "\n";
+
+    out << "# depth count\n";
+    for ( auto keyValue : _eventsCountByDepth )
+      out << "depth         " << keyValue.first << " " << keyValue.second << "\n";
+
+    out << "# level count time(ns)\n";
+    for ( size_t level=0 ; level<_eventsCountByLevel.size() ; ++level ) {
+      if (not _eventsCountByLevel[level]) continue;
+      out << "level         " << level
+          << " " << _eventsCountByLevel[level]
+          << " " << _eventsTimeByLevel [level] << "\n";
+    }
+
+    out << "# from to count\n";
+    for ( uint32_t from=0 ; from<StatesCount ; ++from ) {
+      for ( uint32_t to=0 ; to<StatesCount ; ++to ) {
+        uint64_t count = _transitions[ from*StatesCount + to ];
+        if (count) out << "transition    " << from << " " << to << " " << count << "\n";
+      }
+    }
+    out.flush();
+  }
+
+
 // -------------------------------------------------------------------
 // Class  :  "NegociateWindow".
 
@@ -660,7 +778,8 @@ namespace Katana {
     if (cdebug.enabled(9000)) _eventQueue.dump();
     _statistics.setLoadedEventsCount( _eventQueue.size() );
 
-    size_t count = 0;
+    size_t        count = 0;
+    EventProgress progress ( "event", _katana->getConfiguration()->traceEvents() );
     _katana->setStage( StageNegociate );
     while ( not _eventQueue.empty() and not isInterrupted() ) {
       RoutingEvent* event = _eventQueue.pop();
@@ -682,24 +801,8 @@ namespace Katana {
         }
       }
 
-      if (tty::enabled()) {
-        cmess2 << "        <event:" << tty::bold << right << setw(8) << setfill('0')
-               << RoutingEvent::getProcesseds() << tty::reset
-               << " remains:" << right << setw(8) << setfill('0')
-               << _eventQueue.size()
-               << setfill(' ') << tty::reset << ">" << tty::cr;
-        cmess2.flush ();
-      } else {
-        cmess2 << "        <event:" << right << setw(8) << setfill('0')
-               << RoutingEvent::getProcesseds() << setfill(' ') << " "
-               << event->getEventLevel() << ":" << event->getPriority()
-               << ":" << DbU::getValueString(event->getSegment()->getLength()) << "> "
-               << event->getSegment()
-               << endl;
-        cmess2.flush();
-      }
-
-      event->process( _eventQueue, _eventHistory, _eventLoop );
+      progress.update( event, _eventQueue.size() );
+      _processEvent( event );
       count++;
 
       // if (RoutingEvent::getProcesseds() == 446036) {
@@ -737,6 +840,7 @@ namespace Katana {
       // }
       if (RoutingEvent::getProcesseds() >= limit) setInterrupt( true );
     }
+    progress.close( _eventQueue.size() );
     _statistics.setProcessedEventsCount( RoutingEvent::getProcesseds() );
   //_pack( count, true );
     _negociateRepair();
@@ -755,24 +859,11 @@ namespace Katana {
       cmess2 << "        <realign.queue:" <<  right << setw(8) << setfill('0')
              << _eventQueue.size() << ">" << setfill(' ') << endl;
       count = 0;
+      EventProgress realignProgress ( "realign.event", _katana->getConfiguration()->traceEvents() );
       while ( not _eventQueue.empty() and not isInterrupted() ) {
         RoutingEvent* event = _eventQueue.pop();
-        if (tty::enabled()) {
-          cmess2 << "        <realign.event:" << tty::bold << setw(8) << setfill('0')
-                 << RoutingEvent::getProcesseds() << tty::reset
-                 << " remains:" << right << setw(8) << setfill('0')
-                 << _eventQueue.size() << ">"
-                 << setfill(' ') << tty::reset << tty::cr;
-          cmess2.flush();
-        } else {
-          cmess2 << "        <realign.event:" << setw(8) << setfill('0')
-                 << RoutingEvent::getProcesseds() << setfill(' ') << " "
-                 << event->getEventLevel() << ":" << event->getPriority() << "> "
-                 << event->getSegment()
-                 << endl;
-          cmess2.flush();
-        }
-        event->process( _eventQueue, _eventHistory, _eventLoop );
+        realignProgress.update( event, _eventQueue.size() );
+        _processEvent( event );
         count++;
         if (RoutingEvent::getProcesseds() >= limit) setInterrupt( true );
 
@@ -782,12 +873,11 @@ namespace Katana {
         //   UpdateSession::open();
         // }
       }
+      realignProgress.close( _eventQueue.size() );
 
       _negociateRepair();
     }
 
-    if (count and cmess2.enabled() and tty::enabled()) cmess1 << endl;
-
     size_t eventsCount = _eventHistory.size();
 
     _eventHistory.clear();
@@ -799,12 +889,27 @@ namespace Katana {
 
     if (ofprofile.is_open()) ofprofile.close();
     _statistics.setEventsCount( eventsCount );
+    if (_katana->getConfiguration()->eventsReport()) _dumpEventsReport();
     cdebug_tabw(159,-1);
 
     return eventsCount;
   }
 
 
+  void  NegociateWindow::_processEvent ( RoutingEvent* event )
+  {
+    uint32_t level = event->getEventLevel();
+    uint32_t state = event->getState();
+    auto     start = chrono::steady_clock::now();
+
+    event->process( _eventQueue, _eventHistory, _eventLoop );
+
+    auto elapsed = chrono::duration_cast<chrono::nanoseconds>( chrono::steady_clock::now() - start );
+    _statistics.addLevelEvent( level, elapsed.count() );
+    _statistics.addTransition( state, event->getState() );
+  }
+
+
   void  NegociateWindow::_negociateRepair ()
   {
     cdebug_log(159,1) << "NegociateWindow::_negociateRepair() - " << _segments.size() << endl;
@@ -828,30 +933,18 @@ namespace Katana {
     cmess2 << "        <repair.queue:" <<  right << setw(8) << setfill('0')
            << _eventQueue.size() << ">" << setfill(' ') << endl;
 
+    EventProgress progress ( "repair.event", _katana->getConfiguration()->traceEvents() );
+
     while ( not _eventQueue.empty() and not isInterrupted() ) {
       RoutingEvent* event = _eventQueue.pop();
 
-      if (tty::enabled()) {
-        cmess2 << "        <repair.event:" << tty::bold << setw(8) << setfill('0')
-               << RoutingEvent::getProcesseds() << tty::reset
-               << " remains:" << right << setw(8) << setfill('0')
-               << _eventQueue.size() << ">"
-               << setfill(' ') << tty::reset << tty::cr;
-        cmess2.flush();
-      } else {
-        cmess2 << "        <repair.event:" << setw(8) << setfill('0')
-               << RoutingEvent::getProcesseds() << setfill(' ') << " "
-               << event->getEventLevel() << ":" << event->getPriority() << "> "
-               << event->getSegment()
-               << endl;
-        cmess2.flush();
-      }
-
-      event->process( _eventQueue, _eventHistory, _eventLoop );
+      progress.update( event, _eventQueue.size() );
+      _processEvent( event );
 
       count++;
       if (RoutingEvent::getProcesseds() >= limit) setInterrupt( true );
     }
+    progress.close( _eventQueue.size() );
 
     cdebug_tabw(159,-1);
   }
@@ -913,6 +1006,19 @@ namespace Katana {
   }
 
 
+  void  NegociateWindow::_dumpEventsReport () const
+  {
+    ostringstream path;
+    path << getCell()->getName() << ".katana.events.dat";
+
+    cmess2 << "     o  Dumping events report <" << path.str() << ">." << endl;
+
+    ofstream sfile ( path.str().c_str() );
+    _statistics.dump( sfile );
+    sfile.close();
+  }
+
+
   void  NegociateWindow::printStatistics () const
   {
     float ripupRatio = 100.0 * _statistics.getRipupRatio();
@@ -938,12 +1044,35 @@ namespace Katana {
       cmess1 << Dots::asString( title.str(), result.str() ) << endl;
     }
     
+    const Statistics::Counters& levelCounts = _statistics.getLevelEventsCounts();
+    const Statistics::Counters& levelTimes  = _statistics.getLevelTimes();
+    for ( size_t level=0 ; level<levelCounts.size() ; ++level ) {
+      if (not levelCounts[level]) continue;
+      ostringstream title;
+      title << "     - Processeds Events at level " << level;
+
+      ostringstream result;
+      result << levelCounts[level] << setprecision(3) << fixed
+             << " (" << ((double)levelTimes[level] / 1.0e9) << "s)";
+      cmess2 << Dots::asString( title.str(), result.str() ) << endl;
+    }
+    
     cmess1 << Dots::asSizet("     - # of GCells",_statistics.getGCellsCount()) << endl;
     _katana->printCompletion();
 
     _katana->addMeasure<size_t>( "Events" , totalEvents, 12 );
     _katana->addMeasure<size_t>( "UEvents", totalEvents-RoutingEvent::getCloneds(), 12 );
 
+    const SlabAllocator& eventPool   = RoutingEvent::getAllocator();
+    const SlabAllocator& costPool    = TrackCost   ::getAllocator();
+    const SlabAllocator& elementPool = TrackElement::getAllocator();
+    _katana->addMeasure<size_t>( "EvAlloc", eventPool  .getAllocateds(), 12 );
+    _katana->addMeasure<size_t>( "TcAlloc", costPool   .getAllocateds(), 12 );
+    _katana->addMeasure<size_t>( "TeAlloc", elementPool.getAllocateds(), 12 );
+    _katana->addMeasure<size_t>( "PoolKb"
+                               , (eventPool.getMemory() + costPool.getMemory() + elementPool.getMemory()) / 1024
+                               , 12 );
+
     Histogram* densityHistogram = new Histogram ( 1.0, 0.1, 2 );
     _katana->addMeasure<Histogram>( "GCells Density Histogram", densityHistogram );
 
@@ -185,6 +185,22 @@ namespace Katana {
   void      RoutingEvent::resetProcesseds () { _processeds = 0; }
 
 
+  SlabAllocator& RoutingEvent::getAllocator ()
+  {
+  // Never destroyed, objects may outlive the static destructors.
+    static SlabAllocator* allocator = new SlabAllocator ( "RoutingEvent" );
+    return *allocator;
+  }
+
+
+  void* RoutingEvent::operator new ( size_t size )
+  { return getAllocator().allocate( size ); }
+
+
+  void  RoutingEvent::operator delete ( void* memory, size_t size )
+  { getAllocator().deallocate( memory, size ); }
+
+
   RoutingEvent::RoutingEvent ( TrackElement* segment )
     : _cloned              (false)
     , _processed           (false)
@@ -19,6 +19,7 @@
 #include "hurricane/Point.h"
 #include "hurricane/Error.h"
 #include "hurricane/RoutingPad.h"
+#include "hurricane/UpdateSession.h"
 #include "anabatic/AutoContactTerminal.h"
 #include "katana/Session.h"
 #include "katana/Track.h"
@@ -116,7 +117,12 @@ namespace Katana {
 
   void  Session::_preDestroy ()
   {
+  // The bulk UpdateSession is closed by Anabatic, the Slices QuadTrees
+  // are then filled on "katana.updateThreads" threads.
+    unsigned int threads = UpdateSession::getThreads();
+    UpdateSession::setThreads( _getKatanaEngine()->getConfiguration()->getUpdateThreads() );
     Super::_preDestroy();
+    UpdateSession::setThreads( threads );
     _isEmpty();
   }
 
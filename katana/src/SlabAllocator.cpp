@@ -0,0 +1,107 @@
+// -*- C++ -*-
+//
+// This file is part of the Coriolis Software.
+// Copyright (c) Sorbonne Université 2024-2024, All Rights Reserved
+//
+// +-----------------------------------------------------------------+
+// |                   C O R I O L I S                               |
+// |      K i t e  -  D e t a i l e d   R o u t e r                  |
+// |                                                                 |
+// |  Author      :                    Jean-Paul CHAPUT              |
+// |  E-mail      :            Jean-Paul.Chaput@lip6.fr              |
+// | =============================================================== |
+// |  C++ Module  :       "./SlabAllocator.cpp"                      |
+// +-----------------------------------------------------------------+
+
+
+#include <new>
+#include "katana/SlabAllocator.h"
+
+
+namespace Katana {
+
+
+// -------------------------------------------------------------------
+// Class  :  "SlabAllocator".
+
+
+  SlabAllocator::SlabAllocator ( const char* name )
+    : _name      (name)
+    , _slabs     ()
+    , _freeLists (MaxChunkSize/Alignment+1,NULL)
+    , _current   (NULL)
+    , _remaining (0)
+    , _allocateds(0)
+    , _inUse     (0)
+    , _peakInUse (0)
+  { }
+
+
+  SlabAllocator::~SlabAllocator ()
+  {
+  // Objects still alive at exit are leaked on purpose, the slabs are
+  // only freed when they are all gone.
+    if (not _inUse) release();
+  }
+
+
+  void* SlabAllocator::allocate ( size_t size )
+  {
+    ++_allocateds;
+    if (++_inUse > _peakInUse) _peakInUse = _inUse;
+
+    if (size > MaxChunkSize) return ::operator new( size );
+
+    size_t index = (size + Alignment - 1) / Alignment;
+    Chunk* chunk = _freeLists[index];
+    if (chunk) {
+      _freeLists[index] = chunk->_next;
+      return chunk;
+    }
+
+    size_t chunkSize = index * Alignment;
+    if (_remaining < chunkSize) {
+      _current   = static_cast<char*>( ::operator new( SlabSize ) );
+      _remaining = SlabSize;
+      _slabs.push_back( _current );
+    }
+
+    void* memory = _current;
+    _current   += chunkSize;
+    _remaining -= chunkSize;
+    return memory;
+  }
+
+
+  void  SlabAllocator::deallocate ( void* memory, size_t size )
+  {
+    if (not memory) return;
+    --_inUse;
+
+    if (size > MaxChunkSize) { ::operator delete( memory ); return; }
+
+    size_t index = (size + Alignment - 1) / Alignment;
+    Chunk* chunk = static_cast<Chunk*>( memory );
+    chunk->_next = _freeLists[index];
+    _freeLists[index] = chunk;
+  }
+
+
+  bool  SlabAllocator::release ()
+  {
+  // The counters are per routing run, they are reset even when the
+  // slabs cannot be given back.
+    _allocateds = 0;
+    _peakInUse  = _inUse;
+    if (_inUse) return false;
+
+    for ( char* slab : _slabs ) ::operator delete( slab );
+    _slabs.clear();
+    _freeLists.assign( _freeLists.size(), NULL );
+    _current   = NULL;
+    _remaining = 0;
+    return true;
+  }
+
+
+}  // Katana namespace.
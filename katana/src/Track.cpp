@@ -167,11 +167,6 @@ namespace {
 
   
 
-  struct isDetachedSegment {
-      bool operator() ( const TrackElement* s ) { return not s->getTrack(); };
-  };
-
-
   // DbU::Unit  getPositionByIterator ( const vector<TrackElement*>& v, size_t i )
   // { return (*(v.begin()+i))->getSourceU(); }
 
@@ -284,6 +279,9 @@ namespace Katana {
     , _min          (routingPlane->getTrackMin())
     , _max          (routingPlane->getTrackMax())
     , _segments     ()
+    , _sourcesU     ()
+    , _targetsU     ()
+    , _nets         ()
     , _markers      ()
     , _localAssigned(false)
     , _segmentsValid(false)
@@ -389,7 +387,7 @@ namespace Katana {
   TrackElement* Track::getNext ( size_t& index, Net* net ) const
   {
     for ( index++ ; index < _segments.size() ; index++ ) {
-      if (_segments[index]->getNet() == net) continue;
+      if (_nets[index] == net) continue;
       return _segments[index];
     }
     index = npos;
@@ -405,7 +403,7 @@ namespace Katana {
     do {
       --index;
       cdebug_log(155,0) << "| " << index << ":" << _segments[index] << endl;
-      if (_segments[index]->getNet() != net) return _segments[index];
+      if (_nets[index] != net) return _segments[index];
     } while ( index != 0 );
     index = npos;
     return NULL;
@@ -473,18 +471,15 @@ namespace Katana {
       return;
     }
 
-    vector<TrackElement*>::const_iterator  lowerBound
-      = lower_bound( _segments.begin(), _segments.end(), position, SourceCompare() );
-    begin = lowerBound - _segments.begin();
+    begin = _lowerBound( position );
     cdebug_log(155,0) << "  lower_bound begin=" << begin << endl;
 
     size_t sameNetDelta = 0;
     if (begin < _segments.size()) {
-      Interval span     = _segments[begin]->getCanonicalInterval();
+      Interval span     = _getSpan( begin );
       size_t   minBegin = begin;
-      for ( size_t i=begin; (i > 0) and (_segments[i-1]->getNet() == _segments[i]->getNet())
-            ; --i ) {
-        Interval current = _segments[i-1]->getCanonicalInterval();
+      for ( size_t i=begin; (i > 0) and (_nets[i-1] == _nets[i]) ; --i ) {
+        Interval current = _getSpan( i-1 );
         if (current.intersect(span)) {
           span.merge( current );
           minBegin = i - 1;
@@ -495,7 +490,7 @@ namespace Katana {
     }
 
     state = 0;
-    if ( (begin == 0) and (position < _segments[0]->getSourceU()) ) {
+    if ( (begin == 0) and (position < _sourcesU[0]) ) {
       state = BeforeFirstElement;
     } else {
       cdebug_log(155,0) << "  Expanding from begin=" << begin << endl;
@@ -539,7 +534,7 @@ namespace Katana {
 
     getBeginIndex( interval.getVMax(), end, iState );
     for ( ; end < _segments.size() ; ++end ) {
-      if (_segments[end]->getSourceU() >= interval.getVMax()) break;
+      if (_sourcesU[end] >= interval.getVMax()) break;
     }
 
     cdebug_log(155,0) << "Track::getOverlapBounds(): begin:" << begin << " end:" << end << " AfterLastElement:" << (iState == AfterLastElement) << endl;
@@ -597,10 +592,10 @@ namespace Katana {
 
     if (begin == npos) {
       if (not _segments.empty()
-         and (_segments.back()->getNet() == cost.getNet())
+         and (_nets.back() == cost.getNet())
          and (cost.getRefElement()->getAxis() != getAxis())
          ) {
-        Interval overlap = interval.getIntersection( _segments.back()->getCanonicalInterval() );
+        Interval overlap = interval.getIntersection( _getSpan(_segments.size()-1) );
         cdebug_log(155,0) << "overlap:" << overlap
                           << " size:" << DbU::getValueString(overlap.getSize()) << endl;
         if (overlap.getSize() > 0) {
@@ -615,12 +610,12 @@ namespace Katana {
     }
 
     for ( ; begin < end ; begin++ ) {
-      Interval overlap = interval.getIntersection( _segments[begin]->getCanonicalInterval() );
+      Interval overlap = interval.getIntersection( _getSpan(begin) );
       cdebug_log(155,0) << "overlap:" << overlap
                         << " size:" << DbU::getValueString(overlap.getSize()) << endl;
       if (overlap.getSize() == 0) continue;
       
-      if (    (_segments[begin]->getNet() == cost.getNet())
+      if (    (_nets[begin] == cost.getNet())
          and ((cost.getRefElement()->getAxis() != getAxis())
              or not _segments[begin]->isNonPref() ) ) {
         if (  (_segments[begin] == cost.getRefElement())
@@ -681,18 +676,9 @@ namespace Katana {
   {
     if (_segments.empty()) return npos;
 
-    vector<TrackElement*>::const_iterator  lowerBound
-      = lower_bound( _segments.begin()
-                   , _segments.end()
-                   , segment
-                   , SegmentCompare()
-                   );
-
-    if (lowerBound != _segments.end()) {
-      while ( segment->getSourceU() == (*lowerBound)->getSourceU() ) {
-        if (*lowerBound == segment) return (size_t)(lowerBound-_segments.begin());
-        lowerBound++;
-      }
+    DbU::Unit source = segment->getSourceU();
+    for ( size_t i=_lowerBound(source) ; (i<_segments.size()) and (_sourcesU[i] == source) ; ++i ) {
+      if (_segments[i] == segment) return i;
     }
 
     return npos;
@@ -712,7 +698,7 @@ namespace Katana {
     if (_segments.empty()) return Interval(_min,_max);
 
     getBeginIndex( position, begin, state );
-    if ( (state == InsideElement) and (_segments[begin]->getNet() != net) ) {
+    if ( (state == InsideElement) and (_nets[begin] != net) ) {
       cdebug_log(155,0) << "Track::getFreeInterval(): Inside other element @" << begin
                         << " - " << _segments[begin] << endl;
       return Interval();
@@ -734,7 +720,7 @@ namespace Katana {
     cdebug_log(155,0) << "minFree:" << DbU::getValueString(minFree) << " (track min)" << endl;
 
     if (not (state & BeginIsTrackMin) and (begin > 0)) {
-      if ((_segments[begin]->getNet() == net) or _segments[begin]->isNonPref())
+      if ((_nets[begin] == net) or _segments[begin]->isNonPref())
         getPrevious( begin, net );
 
       if (begin != npos) {
@@ -743,7 +729,7 @@ namespace Katana {
       }
     } else {
       if (state & BeginIsSegmentMax) {
-        if (_segments[begin]->getNet() != net)
+        if (_nets[begin] != net)
           minFree = getOccupiedInterval(begin).getVMax();
       }
     }
@@ -751,7 +737,7 @@ namespace Katana {
     if (not (state & EndIsTrackMax) ) {
       if (state & EndIsNextSegmentMin) ++end;
  
-      if ((_segments[end]->getNet() == net) or _segments[end]->isNonPref()) {
+      if ((_nets[end] == net) or _segments[end]->isNonPref()) {
         getNext( end, net );
         if (end != npos) {
           cdebug_log(155,0) << "| same net, end:" << end << " " << _segments[end] << endl;
@@ -800,7 +786,7 @@ namespace Katana {
     }
 
     cdebug_log(159,0) << "Insert in [" << 0 << "] " << this << segment << endl;
-    _segments.push_back( segment );
+    _pushSegment( segment );
     _segmentsValid = false;
     updateInvalidBounds( segment );
 
@@ -809,7 +795,7 @@ namespace Katana {
       Track* wtrack = getNextTrack();
       for ( size_t i=1 ; wtrack and (i<segment->getTrackSpan()) ; ++i ) {
         cdebug_log(159,0) << "Insert in [" << i << "] " << wtrack << segment << endl;
-        wtrack->_segments.push_back ( segment );
+        wtrack->_pushSegment( segment );
         wtrack->_segmentsValid = false;
         wtrack->updateInvalidBounds( segment );
         wtrack = wtrack->getNextTrack();
@@ -825,6 +811,9 @@ namespace Katana {
   {
     if ( index >= _segments.size() ) return;
     _segments[index] = segment;
+    _sourcesU[index] = segment->getSourceU();
+    _targetsU[index] = segment->getTargetU();
+    _nets    [index] = segment->getNet();
   }
 
 
@@ -905,7 +894,7 @@ namespace Katana {
   {
     if ( i == npos) return 0;
 
-    return _segments[i]->getSourceU();
+    return _sourcesU[i];
   }
 
 
@@ -923,8 +912,8 @@ namespace Katana {
 
     switch ( state & BeginMask ) {
       case BeginIsTrackMin:   return _min;
-      case BeginIsSegmentMin: return _segments[index]->getSourceU ();
-      case BeginIsSegmentMax: return _segments[index]->getTargetU ();
+      case BeginIsSegmentMin: return _sourcesU[index];
+      case BeginIsSegmentMax: return _targetsU[index];
     }
 
     cerr << Bug( " Track::getMinimalPosition(size_t,uint32_t) :"
@@ -940,10 +929,10 @@ namespace Katana {
 
     switch ( state & EndMask ) {
       case EndIsTrackMax:       return _max;
-      case EndIsSegmentMin:     return _segments[index  ]->getSourceU ();
+      case EndIsSegmentMin:     return _sourcesU[index  ];
       case EndIsNextSegmentMin: if (index+1 >= getSize()) return _max;
-                                return _segments[index+1]->getSourceU ();
-      case EndIsSegmentMax:     return _segments[index  ]->getTargetU ();
+                                return _sourcesU[index+1];
+      case EndIsSegmentMax:     return _targetsU[index  ];
     }
 
     cerr << Bug( " Track::getMaximalPosition(size_t,uint32_t) :"
@@ -994,19 +983,18 @@ namespace Katana {
     if (begin == npos) return Interval();
 
     size_t  seed  = begin;
-    Net*    owner = _segments[seed]->getNet();
+    Net*    owner = _nets[seed];
 
     Interval  segmentInterval;
-    Interval  mergedInterval;
-    _segments[seed]->getCanonical( mergedInterval );
+    Interval  mergedInterval  = _getSpan( seed );
 
     cdebug_log(155,0) << "| seed:" << mergedInterval << " " << _segments[seed] << endl;
 
     size_t i = seed;
     while ( --i != npos ) {
-      if (_segments[i]->getNet() != owner) break;
+      if (_nets[i] != owner) break;
 
-      _segments[i]->getCanonical ( segmentInterval );
+      segmentInterval = _getSpan( i );
       if (segmentInterval.getVMax() >= mergedInterval.getVMin()) {
         cdebug_log(155,0) << "| merge (prev):" << segmentInterval << " " << _segments[i] << endl;
 
@@ -1017,9 +1005,9 @@ namespace Katana {
 
     i = seed;
     while ( ++i < _segments.size() ) {
-      if (_segments[i]->getNet() != owner) break;
+      if (_nets[i] != owner) break;
 
-      _segments[i]->getCanonical( segmentInterval );
+      segmentInterval = _getSpan( i );
       if (segmentInterval.getVMin() > mergedInterval.getVMax()) break;
 
       cdebug_log(155,0) << "| merge (next):" << _segments[i] << endl;
@@ -1035,12 +1023,22 @@ namespace Katana {
   {
     cdebug_log(155,1) << "Track::doRemoval() - " << this << endl;
 
-    size_t  size = _segments.size();
-
-    vector<TrackElement*>::iterator  beginRemove
-      = remove_if( _segments.begin(), _segments.end(), isDetachedSegment() );
-
-    _segments.erase( beginRemove, _segments.end() );
+    size_t size = _segments.size();
+    size_t kept = 0;
+    for ( size_t i=0 ; i<size ; ++i ) {
+      if (not _segments[i]->getTrack()) continue;
+      if (kept != i) {
+        _segments[kept] = _segments[i];
+        _sourcesU[kept] = _sourcesU[i];
+        _targetsU[kept] = _targetsU[i];
+        _nets    [kept] = _nets    [i];
+      }
+      ++kept;
+    }
+    _segments.resize( kept );
+    _sourcesU.resize( kept );
+    _targetsU.resize( kept );
+    _nets    .resize( kept );
 
     cdebug_log(155,0) << "After doRemoval " << this << endl;
     cdebug_tabw(155,-1);
@@ -1054,9 +1052,29 @@ namespace Katana {
     cdebug_log(155,0) << "Track::doReorder() " << this << endl;
 
     if (not _segmentsValid) {
-      std::sort( _segments.begin(), _segments.end(), SegmentCompare() );
+    // The track is almost always nearly sorted (a few inserted or moved
+    // segments). Keep the ordered ones in place, sort only the misplaced
+    // ones and merge them back.
+      vector<TrackElement*> misplaceds;
+      size_t                kept = 0;
+      for ( size_t i=0 ; i<_segments.size() ; ++i ) {
+        TrackElement* segment = _segments[i];
+        if (   ((kept > 0) and SegmentCompare()(segment,_segments[kept-1]))
+           or  ((i+1 < _segments.size()) and SegmentCompare()(_segments[i+1],segment)) ) {
+          misplaceds.push_back( segment );
+          continue;
+        }
+        _segments[kept++] = segment;
+      }
+      if (not misplaceds.empty()) {
+        std::sort( misplaceds.begin(), misplaceds.end(), SegmentCompare() );
+        _segments.resize( kept );
+        _segments.insert( _segments.end(), misplaceds.begin(), misplaceds.end() );
+        std::inplace_merge( _segments.begin(), _segments.begin()+kept, _segments.end(), SegmentCompare() );
+      }
       _segmentsValid = true;
     }
+    _syncSpans();
     // Net*      blockageNet = Session::getBlockageNet();
     // uint32_t  state       = 0;
     // size_t    i           = 0;
@@ -1087,6 +1105,24 @@ namespace Katana {
   }
 
 
+  void  Track::_syncSpans ()
+  {
+  // Spans and nets are mirrored in flat arrays, in the same order as
+  // _segments, so that the lookups do not have to dereference (and
+  // virtually call) each TrackElement. They are refreshed each time
+  // the track is reordered, which happens after any segment change.
+    size_t size = _segments.size();
+    _sourcesU.resize( size );
+    _targetsU.resize( size );
+    _nets    .resize( size );
+    for ( size_t i=0 ; i<size ; ++i ) {
+      _sourcesU[i] = _segments[i]->getSourceU();
+      _targetsU[i] = _segments[i]->getTargetU();
+      _nets    [i] = _segments[i]->getNet();
+    }
+  }
+
+
   uint32_t  Track::repair () const
   {
     if (getLayerGauge()->getType() != Constant::LayerGaugeType::Default) return 0;
@@ -33,6 +33,21 @@ namespace Katana {
 // -------------------------------------------------------------------
 // Class  :  "TrackCost".
 
+  SlabAllocator& TrackCost::getAllocator ()
+  {
+    static SlabAllocator* allocator = new SlabAllocator ( "TrackCost" );
+    return *allocator;
+  }
+
+
+  void* TrackCost::operator new ( size_t size )
+  { return getAllocator().allocate( size ); }
+
+
+  void  TrackCost::operator delete ( void* memory, size_t size )
+  { getAllocator().deallocate( memory, size ); }
+
+
   TrackCost::TrackCost ( TrackElement* refSegment
                        , TrackElement* symSegment
                        , Track*        refTrack
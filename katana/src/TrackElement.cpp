@@ -99,6 +99,21 @@ namespace Katana {
   SegmentOverlapCostCB* TrackElement::_overlapCostCallback = dummyOverlapCost;
 
 
+  SlabAllocator& TrackElement::getAllocator ()
+  {
+    static SlabAllocator* allocator = new SlabAllocator ( "TrackElement" );
+    return *allocator;
+  }
+
+
+  void* TrackElement::operator new ( size_t size )
+  { return getAllocator().allocate( size ); }
+
+
+  void  TrackElement::operator delete ( void* memory, size_t size )
+  { getAllocator().deallocate( memory, size ); }
+
+
   SegmentOverlapCostCB* TrackElement::setOverlapCostCB ( SegmentOverlapCostCB* cb )
   {
     SegmentOverlapCostCB* oldCb = _overlapCostCallback;
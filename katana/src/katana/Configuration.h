@@ -68,15 +68,21 @@ namespace Katana {
       inline        bool                       profileEventCosts       () const;
       inline        bool                       runRealignStage         () const;
       inline        bool                       disableStackedVias      () const;
+      inline        bool                       traceEvents             () const;
+      inline        bool                       eventsReport            () const;
     // Methods.                                                  
       inline        Anabatic::Configuration*   base                    ();
       inline  const Anabatic::Configuration*   base                    () const;
       inline        PostEventCb_t&             getPostEventCb          ();
       inline        std::string                getBloat                () const;
+      inline        std::string                getDijkstraQueue        () const;
+      inline        std::string                getDijkstraSearch       () const;
       inline        uint64_t                   getEventsLimit          () const;
       inline        uint32_t                   getRipupCost            () const;
                     uint32_t                   getRipupLimit           ( uint32_t type ) const;
       inline        uint32_t                   getSearchHalo           () const;
+      inline        uint32_t                   getGlobalThreads        () const;
+      inline        uint32_t                   getUpdateThreads        () const;
       inline        uint32_t                   getBloatOverloadAdd     () const;
       inline        uint32_t                   getLongWireUpThreshold1 () const;
       inline        double                     getLongWireUpReserve1   () const;
@@ -108,7 +114,11 @@ namespace Katana {
     // Attributes.
              PostEventCb_t  _postEventCb;
              std::string    _bloat;
+             std::string    _dijkstraQueue;
+             std::string    _dijkstraSearch;
              uint32_t       _searchHalo;
+             uint32_t       _globalThreads;
+             uint32_t       _updateThreads;
              uint32_t       _longWireUpThreshold1;
              double         _longWireUpReserve1;
              uint32_t       _hTracksReservedLocal;
@@ -126,6 +136,8 @@ namespace Katana {
              bool           _profileEventCosts;
              bool           _runRealignStage;
              bool           _disableStackedVias;
+             bool           _traceEvents;
+             bool           _eventsReport;
     private:
                      Configuration ( const Configuration& other );
       Configuration& operator=     ( const Configuration& );
@@ -137,8 +149,12 @@ namespace Katana {
   inline       Anabatic::Configuration*      Configuration::base                    () { return dynamic_cast<Anabatic::Configuration*>(this); }
   inline       Configuration::PostEventCb_t& Configuration::getPostEventCb          () { return _postEventCb; }
   inline       std::string                   Configuration::getBloat                () const { return _bloat; }
+  inline       std::string                   Configuration::getDijkstraQueue        () const { return _dijkstraQueue; }
+  inline       std::string                   Configuration::getDijkstraSearch       () const { return _dijkstraSearch; }
   inline       uint64_t                      Configuration::getEventsLimit          () const { return _eventsLimit; }
   inline       uint32_t                      Configuration::getSearchHalo           () const { return _searchHalo; }
+  inline       uint32_t                      Configuration::getGlobalThreads        () const { return _globalThreads; }
+  inline       uint32_t                      Configuration::getUpdateThreads        () const { return _updateThreads; }
   inline       uint32_t                      Configuration::getRipupCost            () const { return _ripupCost; }
   inline       uint32_t                      Configuration::getBloatOverloadAdd     () const { return _bloatOverloadAdd; }
   inline       uint32_t                      Configuration::getLongWireUpThreshold1 () const { return _longWireUpThreshold1; }
@@ -160,6 +176,8 @@ namespace Katana {
   inline       bool                          Configuration::profileEventCosts       () const { return _profileEventCosts; }
   inline       bool                          Configuration::runRealignStage         () const { return _runRealignStage; }
   inline       bool                          Configuration::disableStackedVias      () const { return _disableStackedVias; }
+  inline       bool                          Configuration::traceEvents             () const { return _traceEvents; }
+  inline       bool                          Configuration::eventsReport            () const { return _eventsReport; }
   inline       void                          Configuration::setFlags                ( unsigned int flags ) { _flags |=  flags; }
   inline       void                          Configuration::unsetFlags              ( unsigned int flags ) { _flags &= ~flags; }
   inline       void                          Configuration::setProfileEventCosts    ( bool state ) { _profileEventCosts = state; }
@@ -18,11 +18,13 @@
 #include <set>
 #include <queue>
 #include <vector>
+#include <iosfwd>
 
 namespace Hurricane {
   class Cell;
 }
 
+#include "katana/DataNegociate.h"
 #include "katana/RoutingEventQueue.h"
 #include "katana/RoutingEventHistory.h"
 #include "katana/RoutingEventLoop.h"
@@ -40,6 +42,8 @@ namespace Katana {
   class Statistics {
     public:
       typedef std::map< size_t, size_t >  EventsMap;
+      typedef std::vector< uint64_t >     Counters;
+      static const uint32_t  StatesCount = DataNegociate::RepairFailed + 1;
     public:
       inline                  Statistics              ();
       inline size_t           getGCellsCount          () const;
@@ -49,6 +53,9 @@ namespace Katana {
       inline size_t           getProcessedEventsCount () const;
       inline float            getRipupRatio           () const;
       inline const EventsMap& getEventsMap            () const;
+      inline const Counters&  getLevelEventsCounts    () const;
+      inline const Counters&  getLevelTimes           () const;
+      inline uint64_t         getTransitionsCount     ( uint32_t from, uint32_t to ) const;
       inline void             setGCellsCount          ( size_t );
       inline void             setSegmentsCount        ( size_t );
       inline void             setEventsCount          ( size_t );
@@ -57,6 +64,9 @@ namespace Katana {
       inline void             incGCellCount           ( size_t );
       inline void             incSegmentsCount        ( size_t );
       inline void             incEventsCount          ( size_t count, size_t depth );
+      inline void             addLevelEvent           ( uint32_t level, uint64_t ns );
+      inline void             addTransition           ( uint32_t from, uint32_t to );
+             void             dump                    ( std::ostream& ) const;
       inline Statistics&      operator+=              ( const Statistics& );
     private:
       size_t     _gcellsCount;
@@ -65,6 +75,9 @@ namespace Katana {
       size_t     _loadedEventsCount;
       size_t     _processedEventsCount;
       EventsMap  _eventsCountByDepth;
+      Counters   _eventsCountByLevel;
+      Counters   _eventsTimeByLevel;
+      Counters   _transitions;
   };
 
 
@@ -75,6 +88,9 @@ namespace Katana {
     , _loadedEventsCount   (0)
     , _processedEventsCount(0)
     , _eventsCountByDepth  ()
+    , _eventsCountByLevel  ()
+    , _eventsTimeByLevel   ()
+    , _transitions         (StatesCount*StatesCount,0)
   { }
 
   inline size_t  Statistics::getGCellsCount          () const { return _gcellsCount; }
@@ -95,6 +111,31 @@ namespace Katana {
   inline const Statistics::EventsMap& Statistics::getEventsMap () const
   { return _eventsCountByDepth; }
 
+  inline const Statistics::Counters& Statistics::getLevelEventsCounts () const
+  { return _eventsCountByLevel; }
+
+  inline const Statistics::Counters& Statistics::getLevelTimes () const
+  { return _eventsTimeByLevel; }
+
+  inline uint64_t  Statistics::getTransitionsCount ( uint32_t from, uint32_t to ) const
+  { return ((from < StatesCount) and (to < StatesCount)) ? _transitions[from*StatesCount+to] : 0; }
+
+  inline void  Statistics::addLevelEvent ( uint32_t level, uint64_t ns )
+  {
+    if (level >= _eventsCountByLevel.size()) {
+      _eventsCountByLevel.resize( level+1, 0 );
+      _eventsTimeByLevel .resize( level+1, 0 );
+    }
+    _eventsCountByLevel[level] += 1;
+    _eventsTimeByLevel [level] += ns;
+  }
+
+  inline void  Statistics::addTransition ( uint32_t from, uint32_t to )
+  {
+    if ((from < StatesCount) and (to < StatesCount))
+      _transitions[from*StatesCount+to] += 1;
+  }
+
   inline Statistics& Statistics::operator+= ( const Statistics& other )
   {
     _gcellsCount   += other._gcellsCount;
@@ -131,6 +172,8 @@ namespace Katana {
              void                          _associateSymmetrics ();
              void                          _pack                ( size_t& count, bool last );
              size_t                        _negociate           ();
+             void                          _processEvent        ( RoutingEvent* );
+             void                          _dumpEventsReport    () const;
              void                          _negociateRepair     ();
              Hurricane::Record*            _getRecord           () const;
              std::string                   _getString           () const;
@@ -25,6 +25,7 @@ namespace Hurricane {
   class Net;
 }
 
+#include "katana/SlabAllocator.h"
 #include "katana/TrackCost.h"
 #include "katana/TrackElement.h"
 #include "katana/DataNegociate.h"
@@ -96,6 +97,9 @@ namespace Katana {
       static  uint32_t                     getProcesseds         ();
       static  uint32_t                     getCloneds            ();
       static  void                         resetProcesseds       ();
+      static  SlabAllocator&               getAllocator          ();
+      static  void*                        operator new          ( size_t );
+      static  void                         operator delete       ( void*, size_t );
     public:                                                      
       static  RoutingEvent*                create                ( TrackElement* );
               RoutingEvent*                clone                 () const;
@@ -0,0 +1,77 @@
+// -*- C++ -*-
+//
+// This file is part of the Coriolis Software.
+// Copyright (c) Sorbonne Université 2024-2024, All Rights Reserved
+//
+// +-----------------------------------------------------------------+
+// |                   C O R I O L I S                               |
+// |      K i t e  -  D e t a i l e d   R o u t e r                  |
+// |                                                                 |
+// |  Author      :                    Jean-Paul CHAPUT              |
+// |  E-mail      :            Jean-Paul.Chaput@lip6.fr              |
+// | =============================================================== |
+// |  C++ Header  :  "./katana/SlabAllocator.h"                      |
+// +-----------------------------------------------------------------+
+
+
+#pragma  once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace Katana {
+
+
+// -------------------------------------------------------------------
+// Class  :  "SlabAllocator".
+//
+// Fixed size chunks carved out of big slabs, with one free list per
+// size class (rounded up to Alignment). Freed chunks are recycled,
+// the slabs themselves are only given back in bulk by release(),
+// which is only allowed when no chunk is in use anymore. It returns
+// false (leaked chunks) otherwise, but always resets the counters.
+
+  class SlabAllocator {
+    public:
+      static const size_t  Alignment    = 16;
+      static const size_t  SlabSize     = 256*1024;
+      static const size_t  MaxChunkSize = 1024;
+    public:
+                         SlabAllocator   ( const char* name );
+                        ~SlabAllocator   ();
+      inline const char* getName         () const;
+      inline uint64_t    getAllocateds   () const;
+      inline uint64_t    getInUse        () const;
+      inline uint64_t    getPeakInUse    () const;
+      inline size_t      getSlabsCount   () const;
+      inline size_t      getMemory       () const;
+             void*       allocate        ( size_t );
+             void        deallocate      ( void*, size_t );
+             bool        release         ();
+    private:
+      struct Chunk { Chunk* _next; };
+    private:
+      const char*          _name;
+      std::vector<char*>   _slabs;
+      std::vector<Chunk*>  _freeLists;
+      char*                _current;
+      size_t               _remaining;
+      uint64_t             _allocateds;
+      uint64_t             _inUse;
+      uint64_t             _peakInUse;
+    private:
+                     SlabAllocator ( const SlabAllocator& );
+      SlabAllocator& operator=     ( const SlabAllocator& );
+  };
+
+
+  inline const char* SlabAllocator::getName       () const { return _name; }
+  inline uint64_t    SlabAllocator::getAllocateds () const { return _allocateds; }
+  inline uint64_t    SlabAllocator::getInUse      () const { return _inUse; }
+  inline uint64_t    SlabAllocator::getPeakInUse  () const { return _peakInUse; }
+  inline size_t      SlabAllocator::getSlabsCount () const { return _slabs.size(); }
+  inline size_t      SlabAllocator::getMemory     () const { return _slabs.size() * SlabSize; }
+
+
+}  // Katana namespace.
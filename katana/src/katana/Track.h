@@ -127,6 +127,9 @@ namespace Katana {
       DbU::Unit                   _min;
       DbU::Unit                   _max;
       std::vector<TrackElement*>  _segments;
+      std::vector<DbU::Unit>      _sourcesU;
+      std::vector<DbU::Unit>      _targetsU;
+      std::vector<Net*>           _nets;
       std::vector<TrackMarker*>   _markers;
       bool                        _localAssigned;
       bool                        _segmentsValid;
@@ -147,6 +150,10 @@ namespace Katana {
     // Protected functions.
       inline  uint32_t  setMinimalFlags ( uint32_t& state, uint32_t flags ) const;
       inline  uint32_t  setMaximalFlags ( uint32_t& state, uint32_t flags ) const;
+      inline  size_t    _lowerBound     ( DbU::Unit position ) const;
+      inline  Interval  _getSpan        ( size_t index ) const;
+      inline  void      _pushSegment    ( TrackElement* );
+              void      _syncSpans      ();
 
     protected:
     // Sub-Classes.
@@ -223,6 +230,35 @@ namespace Katana {
   }
 
 
+// Branchless lower bound over the flat array of source positions.
+  inline size_t  Track::_lowerBound ( DbU::Unit position ) const
+  {
+    if (_sourcesU.empty()) return 0;
+
+    const DbU::Unit* base   = _sourcesU.data();
+          size_t     length = _sourcesU.size();
+    while (length > 1) {
+      size_t half = length / 2;
+      base    = (base[half] < position) ? base+half : base;
+      length -= half;
+    }
+    return (base - _sourcesU.data()) + (*base < position);
+  }
+
+
+  inline Interval  Track::_getSpan ( size_t index ) const
+  { return Interval( _sourcesU[index], _targetsU[index] ); }
+
+
+  inline void  Track::_pushSegment ( TrackElement* element )
+  {
+    _segments.push_back( element );
+    _sourcesU.push_back( element->getSourceU() );
+    _targetsU.push_back( element->getTargetU() );
+    _nets    .push_back( element->getNet() );
+  }
+
+
   inline  void  Track::updateInvalidBounds ( TrackElement* element )
   {
     _minInvalid = std::min( _minInvalid, element->getSourceU() );
@@ -18,6 +18,7 @@
 #include <string>
 #include <tuple>
 #include "hurricane/Interval.h"
+#include "katana/SlabAllocator.h"
 namespace Hurricane {
   class Net;
 }
@@ -90,6 +91,9 @@ namespace Katana {
                                                      , DbU::Unit     symCandidateAxis
                                                      );
                                 ~TrackCost           ();
+      static       SlabAllocator& getAllocator       ();
+      static       void*         operator new        ( size_t );
+      static       void          operator delete     ( void*, size_t );
       inline       bool          isForGlobal         () const;
       inline       bool          isBlockage          () const;
       inline       bool          isAnalog            () const;
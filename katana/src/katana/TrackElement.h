@@ -29,6 +29,7 @@ namespace Hurricane {
 
 #include  "anabatic/AutoSegment.h"
 #include  "katana/Constants.h"
+#include  "katana/SlabAllocator.h"
 #include  "katana/Session.h"
 #include  "katana/TrackCost.h"
 #include  "katana/TrackElements.h"
@@ -96,6 +97,9 @@ namespace Katana {
     public:
       static  SegmentOverlapCostCB*   setOverlapCostCB       ( SegmentOverlapCostCB* );
       static  void                    notify                 ( TrackElement*, unsigned int flags );
+      static  SlabAllocator&          getAllocator           ();
+      static  void*                   operator new           ( size_t );
+      static  void                    operator delete        ( void*, size_t );
     public:                                                  
               void                    destroy                ();
       virtual AutoSegment*            base                   () const;
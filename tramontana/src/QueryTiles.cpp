@@ -33,6 +33,9 @@ namespace Tramontana {
     , _sweepLine      (sweepLine)
     , _goMatchCount   (0)
     , _processedLayers(0)
+    , _deferred       (false)
+    , _occurrences    ()
+    , _outsides       ()
   {
     setCell  ( sweepLine->getCell() );
     setArea  ( sweepLine->getCell()->getBoundingBox() );
@@ -77,9 +80,39 @@ namespace Tramontana {
   { return true; }
 
 
+// The clones used by Query::doParallelQuery() only collect the
+// occurrences, the Tiles are created and the out of window components
+// reported by merge() in the main thread.
+  Query* QueryTiles::clone () const
+  {
+    QueryTiles* query = new QueryTiles ( _sweepLine );
+    query->_processedLayers = _processedLayers;
+    query->_deferred        = true;
+    return query;
+  }
+
+
+  void  QueryTiles::merge ( Query* query )
+  {
+    QueryTiles* other = static_cast<QueryTiles*>( query );
+    for ( const Occurrence& occurrence : other->_outsides )
+      _reportOutside( occurrence );
+    for ( const Occurrence& occurrence : other->_occurrences )
+      _createTiles( occurrence );
+  }
+
+
+  void  QueryTiles::_reportOutside ( const Occurrence& occurrence ) const
+  {
+    Component* component = static_cast<Component*>( occurrence.getEntity() );
+    cerr << "Outside, on the right, of area window " << component->getBoundingBox() << " vs. " << getArea() << endl;
+    cerr << "  getPath() " << occurrence.getPath() << endl;
+    cerr << "  go " << component << endl;
+  }
+
+
   void  QueryTiles::goCallback ( Go* go )
   {
-    Tile*      rootTile  = nullptr;
     Component* component = dynamic_cast<Component*>( go );
     if (not component) return;
     if (component->getNet()->isBlockage()) return;
@@ -95,14 +128,22 @@ namespace Tramontana {
     if (not isLeftMostWindow() and (bb.getXMin() < getArea().getXMin())) {
       return;
     }
+    Occurrence occurrence = Occurrence( go, getPath() );
     if (not isRightMostWindow() and (bb.getXMin() >= getArea().getXMax())) {
-      cerr << "Outside, on the right, of area window " << bb << " vs. " << getArea() << endl;
-      cerr << "  getPath() " << getPath() << endl;
-      cerr << "  go " << go << endl;
+      if (_deferred) _outsides.push_back( occurrence );
+      else           _reportOutside( occurrence );
       return;
     }
     
-    Occurrence occurrence = Occurrence( go, getPath() );
+    if (_deferred) _occurrences.push_back( occurrence );
+    else           _createTiles( occurrence );
+  }
+
+
+  void  QueryTiles::_createTiles ( const Occurrence& occurrence )
+  {
+    Tile*      rootTile  = nullptr;
+    Component* component = static_cast<Component*>( occurrence.getEntity() );
     for ( const BasicLayer* layer : _sweepLine->getExtracteds() ) {
       if (not component->getLayer()->getMask().intersect(layer->getMask())) continue;
       Tile* tile = Tile::create( occurrence
@@ -133,11 +174,12 @@ namespace Tramontana {
 
   uint32_t  QueryTiles::doAreaQuery ( SweepLine* sweepLine, const Box& area )
   {
+  // The Cell has been prepared for the concurrent walks by SweepLine::run().
     QueryTiles query ( sweepLine );
     query.setArea( area );
     for ( const BasicLayer* layer : sweepLine->getExtracteds() ) {
       query.setBasicLayer( layer );
-      query.doQuery();
+      query.doParallelQuery( sweepLine->getThreads(), true );
     }
     return query.getGoMatchCount();
   }
@@ -117,7 +117,10 @@ namespace Tramontana {
     Interval  sweepSpan  = Interval( ab.getXMin(), ab.getXMax() );
     size_t    processeds = 0;
     DbU::Unit xSweepLine = sweepSpan.getVMin();
-    
+
+  // The sweep does not modify the QuadTrees, so the Cell is prepared only
+  // once for all the concurrent area queries.
+    if (getThreads() > 1) Query::prepareConcurrent( getCell() );
     loadNextWindow();
     do {
       Tile::timeTick();
@@ -252,7 +252,7 @@ namespace Tramontana {
 
   bool  TramontanaEngine::isExtractable ( const Net* net ) const
   {
-    for ( Component* component : net->getComponents() ) {
+    for ( Component* component : net->getComponentRange() ) {
       if (isExtractable(component->getLayer())) return true;
     }
     return false;
@@ -396,7 +396,7 @@ namespace Tramontana {
     for ( Equipotential* equi : _equipotentials )
       equi->consolidate();
 
-    for ( Net* net : getCell()->getNets() ) {
+    for ( Net* net : getCell()->getNetRange() ) {
       if (net->isSupply() or net->isFused() or net->isBlockage()) continue;
       if (net->getProperty(EquipotentialRelation::staticGetName())) continue;
       if (not isExtractable(net)) continue;
@@ -45,6 +45,7 @@ namespace Tramontana {
     // Methods.                                         
       inline bool             doMergeSupplies           () const;
       inline uint32_t         getInstancesPerWindows    () const;
+      inline uint32_t         getThreads                () const;
              void             print                     ( Cell* ) const;
              Record*          _getRecord                () const;
              string           _getString                () const;
@@ -53,6 +54,7 @@ namespace Tramontana {
     // Attributes.
       bool      _mergeSupplies;
       uint32_t  _instancesPerWindows;
+      uint32_t  _threads;
     private:
                              Configuration ( const Configuration& );
       Configuration& operator=             ( const Configuration& );
@@ -61,6 +63,7 @@ namespace Tramontana {
 
   inline bool      Configuration::doMergeSupplies        () const { return _mergeSupplies; }
   inline uint32_t  Configuration::getInstancesPerWindows () const { return _instancesPerWindows; }
+  inline uint32_t  Configuration::getThreads             () const { return _threads; }
 
 
 } // Tramontana namespace.
@@ -17,6 +17,7 @@
 
 
 #pragma  once
+#include <vector>
 #include "hurricane/Query.h"
 
 
@@ -29,6 +30,7 @@ namespace Tramontana {
   using Hurricane::Go;
   using Hurricane::Component;
   using Hurricane::Rubber;
+  using Hurricane::Occurrence;
   using Hurricane::Query;
   class SweepLine;
 
@@ -50,11 +52,19 @@ namespace Tramontana {
       virtual void      rubberCallback      ( Rubber* );
       virtual void      extensionGoCallback ( Go*     );
       virtual void      masterCellCallback  ();
+      virtual Query*    clone               () const;
+      virtual void      merge               ( Query* );
       inline  uint32_t  getGoMatchCount     () const;
     private:
-      SweepLine*   _sweepLine;
-      uint32_t     _goMatchCount;
-      Layer::Mask  _processedLayers;
+              void      _createTiles        ( const Occurrence& );
+              void      _reportOutside      ( const Occurrence& ) const;
+    private:
+      SweepLine*               _sweepLine;
+      uint32_t                 _goMatchCount;
+      Layer::Mask              _processedLayers;
+      bool                     _deferred;
+      std::vector<Occurrence>  _occurrences;
+      std::vector<Occurrence>  _outsides;
   };
 
 
@@ -74,6 +74,7 @@ namespace Tramontana {
       inline  const std::vector<const BasicLayer*>&
                                 getExtracteds       () const;
       inline  Layer::Mask       getExtractedMask    () const;
+      inline  uint32_t          getThreads          () const;
       inline  const TramontanaEngine::LayerSet&
                                 getCutConnexLayers  ( const BasicLayer* ) const;
               void              run                 ( bool isTopLevel );
@@ -126,6 +127,7 @@ namespace Tramontana {
   inline        bool                            SweepLine::isRightMostWindow   () const { return _flags & IsRightMostWindow; }
   inline        Cell*                           SweepLine::getCell             () { return _tramontana->getCell(); }
   inline        Layer::Mask                     SweepLine::getExtractedMask    () const { return _tramontana->getExtractedMask(); }
+  inline        uint32_t                        SweepLine::getThreads          () const { return _tramontana->getConfiguration()->getThreads(); }
   inline  const std::vector<const BasicLayer*>& SweepLine::getExtracteds       () const { return _tramontana->getExtracteds(); }
 
   inline  const TramontanaEngine::LayerSet& SweepLine::getCutConnexLayers ( const BasicLayer* cutLayer ) const
@@ -86,6 +86,7 @@ int main ( int argc, char *argv[] )
     bool          dumpMeasures;
     bool          exportDef;
     bool          saveImport;
+    bool          bulkLoad;
 
     bopts::options_description options ("Command line arguments & options");
     options.add_options()
@@ -141,6 +142,8 @@ int main ( int argc, char *argv[] )
                              , "Export the design in DEF format.")
       ( "import-def"         , bopts::value<string>()
                              , "Import the design in DEF format.")
+      ( "bulk-load"          , bopts::bool_switch(&bulkLoad)->default_value(false)
+                             , "Import the DEF design in one bulk UpdateSession (faster on large designs).")
       ( "importk-ispd04-bk"  , bopts::value<string>()
                              , "The name of the ISPD04 benchmark to import (Bookshelf .aux), without extension." )
       ( "import-iccad04-def" , bopts::value<string>()
@@ -205,7 +208,7 @@ int main ( int argc, char *argv[] )
 
     if ( (cell == NULL) and arguments.count("import-def") ) {
       cell = DefImport::load ( arguments["import-def"].as<string>().c_str()
-                             , DefImport::FitAbOnCells
+                             , DefImport::FitAbOnCells | ((bulkLoad) ? DefImport::BulkLoad : 0)
                              );
     }
 
@@ -1,13 +1,47 @@
 
 
+#include  <sys/stat.h>
+#include  <set>
+#include  <map>
+#include  <fstream>
+#include  <chrono>
+#include  <random>
+#include  <thread>
 #include  <boost/program_options.hpp>
 namespace boptions = boost::program_options;
 
 #include "hurricane/DebugSession.h"
+#include "hurricane/SharedName.h"
 #include "hurricane/Interval.h"
 #include "hurricane/RbTree.h"
 #include "hurricane/IntervalTree.h"
+#include "hurricane/Timer.h"
+#include "hurricane/JsonWriter.h"
+#include "hurricane/Snapshot.h"
+#include "hurricane/Cell.h"
+#include "hurricane/Net.h"
+#include "hurricane/Plug.h"
+#include "hurricane/Horizontal.h"
+#include "hurricane/Vertical.h"
+#include "hurricane/NetExternalComponents.h"
+#include "hurricane/Technology.h"
+#include "hurricane/BasicLayer.h"
+#include "hurricane/Slice.h"
+#include "hurricane/Instance.h"
+#include "hurricane/PathIdVector.h"
+#include "hurricane/HyperNetIndex.h"
+#include "hurricane/UpdateSession.h"
+#include "hurricane/Query.h"
+#include "hurricane/DataBase.h"
+#include "hurricane/Library.h"
+#include "hurricane/configuration/Configuration.h"
 #include "crlcore/Utilities.h"
+#include "crlcore/AllianceFramework.h"
+#include "crlcore/SearchPath.h"
+#include "crlcore/Gds.h"
+#include "crlcore/DefImport.h"
+#include "anabatic/AnabaticEngine.h"
+#include "anabatic/Dijkstra.h"
 
 namespace Hurricane {
 
@@ -28,6 +62,7 @@ INSPECTOR_PR_SUPPORT(Hurricane::IntervalTreeString::Node);
 using namespace std;
 using namespace Hurricane;
 using namespace CRL;
+using namespace Anabatic;
 
 
 namespace {
@@ -37,6 +72,104 @@ namespace {
 
 
   inline DbU::Unit  l ( long v ) { return DbU::fromLambda(v); }
+
+
+// -------------------------------------------------------------------
+// Design  :  "generateCell".
+//
+// Self-contained design for the tests registered in the build, which
+// cannot rely on a configured AllianceFramework. A bare Technology
+// with two metal layers is created, then a flat Cell named after the
+// argument: a grid of instances of two terminal netlist Cells, chained
+// by nets, each one with a wire at the top level. When --generate is
+// not given, the Cells are loaded through the AllianceFramework.
+
+
+  bool  generateCells = false;
+
+
+  Cell* generateMaster ( Library* library, const string& name, bool vertical )
+  {
+    Cell* master = library->getCell( name );
+    if (master) return master;
+
+    Technology* technology = DataBase::getDB()->getTechnology();
+    master = Cell::create( library, name );
+    master->setAbutmentBox( Box( 0, 0, l(10), l(50) ));
+    for ( const char* netName : { "i", "q" } ) {
+      Net* net = Net::create( master, netName );
+      net->setExternal ( true );
+      net->setDirection( (netName[0] == 'i') ? Net::Direction::IN : Net::Direction::OUT );
+      Component* component = NULL;
+      DbU::Unit  offset    = (netName[0] == 'i') ? l(3) : l(7);
+      if (vertical)
+        component = Vertical  ::create( net, technology->getLayer("metal1"), offset, l(2), l(5), l(45) );
+      else
+        component = Horizontal::create( net, technology->getLayer("metal1"), offset*5, l(2), l(1), l(9) );
+      NetExternalComponents::setExternal( component );
+    }
+    master->setTerminalNetlist( true );
+    return master;
+  }
+
+
+  Cell* generateCell ( const string& cellName )
+  {
+    DataBase* db = DataBase::getDB();
+    if (not db) db = DataBase::create();
+    if (not db->getTechnology()) {
+      Technology* technology = Technology::create( db, "generated" );
+      BasicLayer::create( technology, "metal1", BasicLayer::Material::metal, 1, 0, l(2), l(2) )->setGds2Layer( 1 );
+      BasicLayer::create( technology, "metal2", BasicLayer::Material::metal, 2, 0, l(2), l(2) )->setGds2Layer( 2 );
+    }
+    Library* library = db->getRootLibrary();
+    if (not library) library = Library::create( db, "RootLibrary" );
+
+    Cell* cell = library->getCell( cellName );
+    if (cell) return cell;
+
+    const long  side      = 40;
+    Cell*       masters[] = { generateMaster( library, "gen_vbuf", true  )
+                            , generateMaster( library, "gen_hbuf", false ) };
+    const Layer* metal2   = db->getTechnology()->getLayer( "metal2" );
+
+    UpdateSession::open();
+    cell = Cell::create( library, cellName );
+    cell->setAbutmentBox( Box( 0, 0, side*l(10), side*l(50) ));
+
+    Instance* previous = NULL;
+    for ( long row=0 ; row<side ; ++row ) {
+      for ( long column=0 ; column<side ; ++column ) {
+        Transformation::Orientation orientation = (row % 2) ? Transformation::Orientation::MY
+                                                            : Transformation::Orientation::ID;
+        DbU::Unit y = (row % 2) ? (row+1)*l(50) : row*l(50);
+        Instance* instance = Instance::create( cell
+                                             , "inst_" + getString(row) + "_" + getString(column)
+                                             , masters[ (row+column) % 2 ]
+                                             , Transformation( column*l(10), y, orientation )
+                                             , Instance::PlacementStatus::PLACED );
+        if (previous) {
+          Net* net = Net::create( cell, "net_" + getString(row) + "_" + getString(column) );
+          previous->getPlug( previous->getMasterCell()->getNet("q") )->setNet( net );
+          instance->getPlug( instance->getMasterCell()->getNet("i") )->setNet( net );
+
+          DbU::Unit x1 = previous->getAbutmentBox().getXCenter();
+          DbU::Unit x2 = instance->getAbutmentBox().getXCenter();
+          Horizontal::create( net, metal2, row*l(50) + l(25), l(2), std::min(x1,x2), std::max(x1,x2) );
+        }
+        previous = instance;
+      }
+    }
+    UpdateSession::close();
+    return cell;
+  }
+
+
+  Cell* loadCell ( const string& cellName )
+  {
+    if (generateCells) return generateCell( cellName );
+    return AllianceFramework::get()->getCell( cellName, Catalog::State::Views );
+  }
   
   
 // -------------------------------------------------------------------
@@ -137,6 +270,1001 @@ namespace {
     return 0;
   }
 
+
+// -------------------------------------------------------------------
+// Benchmark  :  "benchSnapshot".
+//
+// Compare the JSON save/restore with the binary snapshot one. As
+// Cell::fromJson() only restores one Cell, the design must be flat
+// (instances of terminal netlist Cells only). The original Cell and
+// the JSON restored one are renamed aside before each reload. The
+// snapshot is loaded lazily, so the time of the first materialize(),
+// which creates the components, is reported apart.
+
+
+  size_t  getFileSize ( const string& path )
+  {
+    struct stat status;
+    return (stat(path.c_str(),&status) == 0) ? status.st_size : 0;
+  }
+
+
+  int  benchSnapshot ( const string& cellName )
+  {
+    Cell* cell = loadCell( cellName );
+    if (not cell) {
+      cerr << Error( "benchSnapshot(): Unable to load Cell \"%s\".", cellName.c_str() ) << endl;
+      return 1;
+    }
+    for ( Instance* instance : cell->getInstances() ) {
+      if (not instance->getMasterCell()->isTerminalNetlist()) {
+        cerr << Error( "benchSnapshot(): \"%s\" is not a flat design.", cellName.c_str() ) << endl;
+        return 1;
+      }
+    }
+
+    string jsonFile = cellName + ".json";
+    string snapFile = cellName + ".snapshot";
+    Timer  timer;
+
+    timer.start();
+    { JsonWriter writer ( jsonFile ); jsonWrite( &writer, cell ); }
+    timer.stop();
+    cerr << "  o  JSON     save: " << Timer::getStringTime(timer.getCombTime())
+         << " (" << Timer::getStringMemory(getFileSize(jsonFile)) << ")" << endl;
+
+    timer.start();
+    Snapshot::save( cell, snapFile );
+    timer.stop();
+    cerr << "  o  Snapshot save: " << Timer::getStringTime(timer.getCombTime())
+         << " (" << Timer::getStringMemory(getFileSize(snapFile)) << ")" << endl;
+
+    cell->setName( cellName + "_orig" );
+    timer.start();
+    Cell* jsonCell = Cell::fromJson( jsonFile );
+    timer.stop();
+    cerr << "  o  JSON     load: " << Timer::getStringTime(timer.getCombTime()) << endl;
+    if (not jsonCell) return 1;
+
+    jsonCell->setName( cellName + "_json" );
+    timer.start();
+    Cell* snapCell = Snapshot::load( snapFile );
+    timer.stop();
+    cerr << "  o  Snapshot load: " << Timer::getStringTime(timer.getCombTime()) << endl;
+    if (not snapCell) return 1;
+
+    timer.start();
+    snapCell->materialize();
+    timer.stop();
+    cerr << "     materialize: " << Timer::getStringTime(timer.getCombTime()) << endl;
+    if (Snapshot::isLazy(snapCell)) {
+      cerr << Error( "benchSnapshot(): Components still pending after materialize()." ) << endl;
+      return 1;
+    }
+
+    size_t components     = cell->getComponents().getSize();
+    size_t jsonComponents = jsonCell->getComponents().getSize();
+    size_t snapComponents = snapCell->getComponents().getSize();
+    cerr << "     Components: " << components
+         << " (JSON:"           << jsonComponents
+         << ", Snapshot:"       << snapComponents << ")" << endl;
+    if (snapComponents != components) {
+      cerr << Error( "benchSnapshot(): The reloaded snapshot has %u components instead of %u."
+                   , (unsigned)snapComponents, (unsigned)components ) << endl;
+      return 1;
+    }
+    return 0;
+  }
+
+
+// -------------------------------------------------------------------
+// Benchmark  :  "benchGds".
+//
+// Throughput of the GDSII loader, in MB/s of stream (compressed size
+// for a gzip file), sequential then with the given number of threads
+// for the STRUCTUREs decoding. Wall clock time, as the processor time
+// sums up over the threads. Each run loads in a new Library, which
+// contents must be identical to the sequential one. With --generate,
+// the argument is the name of a generated Cell, first saved in GDSII.
+
+
+  struct GdsSignature {
+    inline bool  operator== ( const GdsSignature& other ) const;
+    size_t     _instances;
+    size_t     _nets;
+    size_t     _components;
+    DbU::Unit  _checksum;
+  };
+
+
+  inline bool  GdsSignature::operator== ( const GdsSignature& other ) const
+  {
+    return (_instances  == other._instances )
+       and (_nets       == other._nets      )
+       and (_components == other._components)
+       and (_checksum   == other._checksum  );
+  }
+
+
+  map<string,GdsSignature>  getGdsSignatures ( Library* library )
+  {
+    map<string,GdsSignature> signatures;
+    for ( Cell* cell : library->getCells() ) {
+      GdsSignature signature = { 0, 0, 0, 0 };
+      for ( Instance* instance : cell->getInstances() ) {
+        Point translation = instance->getTransformation().getTranslation();
+        ++signature._instances;
+        signature._checksum += translation.getX() + 3*translation.getY()
+                             + instance->getTransformation().getOrientation().getCode();
+      }
+      for ( Net* net : cell->getNets() ) {
+        ++signature._nets;
+        for ( Component* component : net->getComponents() ) {
+          Box bb = component->getBoundingBox();
+          ++signature._components;
+          signature._checksum += bb.getXMin() + 3*bb.getYMin() + 5*bb.getXMax() + 7*bb.getYMax();
+        }
+      }
+      signatures[ getString(cell->getName()) ] = signature;
+    }
+    return signatures;
+  }
+
+
+  int  benchGds ( string gdsPath, unsigned int threads )
+  {
+    if (generateCells) {
+      Cell* cell = loadCell( gdsPath );
+      Cfg::getParamInt( "gds.threads", 1 )->setInt( 1 );
+      if (not cell or not Gds::save(cell)) {
+        cerr << Error( "benchGds(): Unable to save the generated Cell \"%s\".", gdsPath.c_str() ) << endl;
+        return 1;
+      }
+      gdsPath += ".gds";
+    }
+
+    size_t bytes = getFileSize( gdsPath );
+    if (not bytes) {
+      cerr << Error( "benchGds(): Unable to stat \"%s\".", gdsPath.c_str() ) << endl;
+      return 1;
+    }
+
+    int                      failures = 0;
+    map<string,GdsSignature> reference;
+    vector<unsigned int>     runs     ( 1, 1 );
+    if (threads > 1) runs.push_back( threads );
+    for ( unsigned int runThreads : runs ) {
+      Cfg::getParamInt( "gds.threads", 1 )->setInt( runThreads );
+      Library* library = Library::create( DataBase::getDB()->getRootLibrary()
+                                        , "gds_bench_" + getString(runThreads) );
+
+      auto start = std::chrono::steady_clock::now();
+      Gds::load( library, gdsPath );
+      double seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+
+      cerr << "  o  GDS load, " << runThreads << " thread(s): "
+           << Timer::getStringTime(seconds) << ", "
+           << ((double)bytes / (1 << 20)) / seconds << " MB/s ("
+           << library->getCells().getSize() << " Cells)" << endl;
+
+      map<string,GdsSignature> signatures = getGdsSignatures( library );
+      if (runThreads == 1) {
+        reference = signatures;
+        if (reference.empty()) {
+          cerr << Error( "benchGds(): No Cell loaded from \"%s\".", gdsPath.c_str() ) << endl;
+          ++failures;
+        }
+      } else if (not (signatures == reference)) {
+        cerr << Error( "benchGds(): The load on %u threads differs from the sequential one."
+                     , runThreads ) << endl;
+        ++failures;
+      }
+    }
+    Cfg::getParamInt( "gds.threads", 1 )->setInt( 1 );
+    return (failures) ? 1 : 0;
+  }
+
+
+// -------------------------------------------------------------------
+// Benchmark  :  "benchDefImport".
+//
+// Load time of a DEF design through the AllianceFramework, with the
+// plain UpdateSession then with DefImport::BulkLoad (QuadTrees filled
+// once at the end). Both loads must give the same netlist and number
+// of components. The first loaded Cell is renamed aside.
+
+
+  int  benchDefImport ( const string& design )
+  {
+    unsigned int runs[]      = { DefImport::FitAbOnCells, DefImport::FitAbOnCells|DefImport::BulkLoad };
+    size_t       counts[2][3];
+    for ( size_t i=0 ; i<2 ; ++i ) {
+      auto   start   = std::chrono::steady_clock::now();
+      Cell*  cell    = DefImport::load( design, runs[i] );
+      double seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+      if (not cell) {
+        cerr << Error( "benchDefImport(): Unable to load DEF \"%s\".", design.c_str() ) << endl;
+        return 1;
+      }
+      counts[i][0] = cell->getInstances ().getSize();
+      counts[i][1] = cell->getNets      ().getSize();
+      counts[i][2] = cell->getComponents().getSize();
+      cerr << "  o  DEF load" << ((runs[i] & DefImport::BulkLoad) ? " (bulk): " : ": ")
+           << Timer::getStringTime(seconds) << " ("
+           << counts[i][0] << " instances, " << counts[i][1] << " nets, "
+           << counts[i][2] << " components)" << endl;
+      if (not i) cell->setName( getString(cell->getName()) + "_plain" );
+    }
+    if (   (counts[0][0] != counts[1][0])
+        or (counts[0][1] != counts[1][1])
+        or (counts[0][2] != counts[1][2])) {
+      cerr << Error( "benchDefImport(): The bulk load differs from the plain one." ) << endl;
+      return 1;
+    }
+    return 0;
+  }
+
+
+// -------------------------------------------------------------------
+// Test  :  "testGdsDedup".
+//
+// Two distinct Cells whose STRUCTUREs are empty (they only hold a
+// placed instance of a Cell without layout) must not be merged by
+// the GDSII deduplication, both must be found back after a reload.
+
+
+  int  testGdsDedup ( const string& cellName )
+  {
+    Cell* top = loadCell( cellName );
+    if (not top) {
+      cerr << Error( "testGdsDedup(): Unable to load Cell \"%s\".", cellName.c_str() ) << endl;
+      return 1;
+    }
+    Library* library = top->getLibrary();
+    Cell*    empty   = Cell::create( library, cellName + "_void" );
+    empty->setAbutmentBox( Box( 0, 0, l(10), l(50) ));
+
+    UpdateSession::open();
+    vector<string> names = { cellName + "_empty_a", cellName + "_empty_b" };
+    for ( const string& name : names ) {
+      Cell* cell = Cell::create( library, name );
+      cell->setAbutmentBox( Box( 0, 0, l(10), l(50) ));
+      Instance::create( cell, "void", empty, Transformation(), Instance::PlacementStatus::PLACED );
+      Instance::create( top, name, cell, Transformation(), Instance::PlacementStatus::PLACED );
+    }
+    UpdateSession::close();
+
+    Cfg::getParamInt( "gds.threads", 1 )->setInt( 1 );
+    if (not Gds::save(top,Gds::Deduplicate)) {
+      cerr << Error( "testGdsDedup(): Unable to save \"%s\".", cellName.c_str() ) << endl;
+      return 1;
+    }
+    Library* reloaded = Library::create( DataBase::getDB()->getRootLibrary(), "gds_dedup" );
+    Gds::load( reloaded, cellName + ".gds" );
+
+    int failures = 0;
+    for ( const string& name : names ) {
+      if (reloaded->getCell(name)) continue;
+      cerr << Error( "testGdsDedup(): Empty structure \"%s\" has been merged.", name.c_str() ) << endl;
+      ++failures;
+    }
+    cerr << "  o  GDS deduplication of empty structures: " << failures << " failure(s)." << endl;
+    return (failures) ? 1 : 0;
+  }
+
+
+// -------------------------------------------------------------------
+// Benchmark  :  "benchRTree".
+//
+// Area queries on the Instances & the Slices of a Cell, through the
+// QuadTree then through the packed R-tree index. The windows are
+// drawn randomly (fixed seed) with a side of 1% of the Cell. Then a
+// tenth of the Instances are moved away and back, which leaves
+// tombstones in the R-tree, and the queries are done again. The
+// three runs must find the same Gos.
+
+
+  size_t  queryWindows ( Cell* cell, const vector<Box>& windows )
+  {
+    size_t found = 0;
+    for ( const Box& window : windows ) {
+      for ( Instance* instance : cell->getInstancesUnder(window) ) { (void)instance; ++found; }
+      for ( Slice* slice : cell->getSlices() ) {
+        for ( Go* go : slice->getGosUnder(window) ) { (void)go; ++found; }
+      }
+    }
+    return found;
+  }
+
+
+  int  benchRTree ( const string& cellName )
+  {
+    Cell* cell = loadCell( cellName );
+    if (not cell) {
+      cerr << Error( "benchRTree(): Unable to load Cell \"%s\".", cellName.c_str() ) << endl;
+      return 1;
+    }
+
+    Box                                  bb      = cell->getBoundingBox();
+    DbU::Unit                            side    = std::max( bb.getWidth(), bb.getHeight() ) / 100;
+    std::mt19937                         random  ( 0 );
+    std::uniform_int_distribution<long>  xrandom ( bb.getXMin(), bb.getXMax() );
+    std::uniform_int_distribution<long>  yrandom ( bb.getYMin(), bb.getYMax() );
+    vector<Box>                          windows;
+    for ( size_t i=0 ; i<10000 ; ++i ) {
+      DbU::Unit x = xrandom( random );
+      DbU::Unit y = yrandom( random );
+      windows.push_back( Box( x, y, x+side, y+side ));
+    }
+
+    bool           indexed = cell->isRTreeIndexed();
+    vector<size_t> founds;
+    const char*    labels[3] = { "QuadTree      ", "R-tree        ", "R-tree (dead) " };
+    for ( size_t run=0 ; run<3 ; ++run ) {
+      if (run < 2) cell->setRTreeIndex( (run == 1) );
+      if (run == 2) {
+        vector<Instance*> moveds;
+        size_t            count  = 0;
+        for ( Instance* instance : cell->getInstances() ) {
+          if (count++ % 10 == 0) moveds.push_back( instance );
+        }
+        for ( DbU::Unit dx : { 2*bb.getWidth(), -2*bb.getWidth() } ) {
+          UpdateSession::open();
+          for ( Instance* instance : moveds ) {
+            Transformation transf = instance->getTransformation();
+            instance->setTransformation( Transformation( transf.getTx()+dx, transf.getTy(), transf.getOrientation() ));
+          }
+          UpdateSession::close();
+        }
+      }
+
+      auto   start = std::chrono::steady_clock::now();
+      founds.push_back( queryWindows( cell, windows ) );
+      double seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+      cerr << "  o  " << labels[run] << " queries: " << Timer::getStringTime(seconds)
+           << " (" << windows.size() << " windows, " << founds.back() << " Gos)" << endl;
+    }
+    cell->setRTreeIndex( indexed );
+
+    if ((founds[1] != founds[0]) or (founds[2] != founds[0])) {
+      cerr << Error( "benchRTree(): R-tree queries differ from the QuadTree ones." ) << endl;
+      return 1;
+    }
+    return 0;
+  }
+
+
+// -------------------------------------------------------------------
+// Test  :  "testFrozen".
+//
+// Stress the frozen (read-only) mode of the DataBase with concurrent
+// readers. Each thread walks the hierarchy of the Cell with a Query,
+// and through the terminal netlist instance occurrences (Path building,
+// occurrence names & properties, Name interning). All of them must
+// get the result of a sequential walk done before freezing. Creating
+// a DBo while frozen must throw.
+
+
+  class FrozenQuery : public Query {
+    public:
+      inline        FrozenQuery         ();
+      virtual bool  hasGoCallback       () const;
+      virtual void  goCallback          ( Go* );
+      virtual void  extensionGoCallback ( Go* );
+      virtual void  masterCellCallback  ();
+    public:
+      size_t     _gos;
+      DbU::Unit  _checksum;
+  };
+
+
+  inline FrozenQuery::FrozenQuery ()
+    : Query    ()
+    , _gos     (0)
+    , _checksum(0)
+  { }
+
+
+  bool  FrozenQuery::hasGoCallback () const { return true; }
+
+
+  void  FrozenQuery::goCallback ( Go* go )
+  {
+    Box bb = getTransformation().getBox( go->getBoundingBox() );
+    ++_gos;
+    _checksum += bb.getXMin() + bb.getYMax();
+  }
+
+
+  void  FrozenQuery::extensionGoCallback ( Go* ) { }
+  void  FrozenQuery::masterCellCallback  () { }
+
+
+  struct FrozenResult {
+    inline bool  operator== ( const FrozenResult& other ) const;
+    size_t     _gos;
+    DbU::Unit  _checksum;
+    size_t     _occurrences;
+    size_t     _names;
+    size_t     _properties;
+  };
+
+
+  inline bool  FrozenResult::operator== ( const FrozenResult& other ) const
+  {
+    return (_gos         == other._gos        )
+       and (_checksum    == other._checksum   )
+       and (_occurrences == other._occurrences)
+       and (_names       == other._names      )
+       and (_properties  == other._properties );
+  }
+
+
+  FrozenResult  readFrozen ( Cell* cell )
+  {
+    FrozenResult result = { 0, 0, 0, 0, 0 };
+
+    FrozenQuery query;
+    for ( BasicLayer* layer : DataBase::getDB()->getTechnology()->getBasicLayers() ) {
+      query.setQuery( cell, cell->getBoundingBox(), Transformation(), layer, 0, Query::DoComponents );
+      query.doQuery();
+    }
+    result._gos      = query._gos;
+    result._checksum = query._checksum;
+
+  // Names are summed, the hash is independant from the walk order.
+    for ( Occurrence occurrence : cell->getTerminalNetlistInstanceOccurrences() ) {
+      Path path = occurrence.getPath();
+      Path head = Path( path.getHeadPath(), path.getTailInstance() );
+      if (head != path) return FrozenResult { 0, 0, 0, 0, 0 };
+      ++result._occurrences;
+      result._names      += std::hash<string>()( occurrence.getName() );
+      result._properties += occurrence.getProperties().getSize();
+    }
+    for ( Net* net : cell->getNets() ) {
+      Name name ( getString(net->getName()) + "_frozen" );
+      result._names += std::hash<string>()( getString(name) );
+    }
+    return result;
+  }
+
+
+  int  testFrozen ( const string& cellName, unsigned int threads )
+  {
+    Cell* cell = loadCell( cellName );
+    if (not cell) {
+      cerr << Error( "testFrozen(): Unable to load Cell \"%s\".", cellName.c_str() ) << endl;
+      return 1;
+    }
+
+    FrozenResult reference = readFrozen( cell );
+    DataBase::getDB()->freeze();
+
+    vector<FrozenResult> results ( threads );
+    vector<std::thread>  readers;
+    for ( unsigned int i=0 ; i<threads ; ++i )
+      readers.push_back( std::thread( [&results,cell,i]() { results[i] = readFrozen( cell ); } ));
+    for ( std::thread& reader : readers ) reader.join();
+
+    bool creationThrown = false;
+    try {
+      Net::create( cell, "frozen_net" );
+    } catch ( Error& e ) {
+      creationThrown = true;
+    }
+    DataBase::getDB()->unfreeze();
+
+    int failures = (creationThrown) ? 0 : 1;
+    if (not creationThrown)
+      cerr << Error( "testFrozen(): Net creation did not throw in frozen mode." ) << endl;
+    if (not reference._gos) {
+      cerr << Error( "testFrozen(): The Query did not reach any Go." ) << endl;
+      ++failures;
+    }
+    for ( unsigned int i=0 ; i<threads ; ++i ) {
+      if (results[i] == reference) continue;
+      cerr << Error( "testFrozen(): Reader %d differs from the sequential walk.", i ) << endl;
+      ++failures;
+    }
+    cerr << "  o  Frozen readers: " << threads << " threads, " << reference._gos << " Gos, "
+         << reference._occurrences << " occurrences, " << failures << " failure(s)." << endl;
+    return (failures) ? 1 : 0;
+  }
+
+// -------------------------------------------------------------------
+// Benchmark  :  "benchDijkstraQueues".
+//
+// Replay of one push / decrease-key / pop sequence, shaped like the
+// one of a Dijkstra search (the distances pushed are never below the
+// last popped one), on the heap, bucket and set priority queues. The
+// sequence is drawn once (fixed seed). The queues only look at the
+// Vertex distances, so all the Vertexes are bound to the single GCell
+// of an AnabaticEngine. The distances are unique, so the three queues
+// must pop the Vertexes in the same order.
+
+
+  struct QueueOperation {
+    enum Kind { Push=0, Decrease=1, Pop=2 };
+    Kind       _kind;
+    uint32_t   _vertex;
+    DbU::Unit  _distance;
+  };
+
+
+  vector<QueueOperation>  drawQueueOperations ( size_t vertexes )
+  {
+    vector<QueueOperation>              operations;
+    set< pair<DbU::Unit,uint32_t> >     queue;
+    vector<DbU::Unit>                   distances ( vertexes, 0 );
+    vector<bool>                        queueds   ( vertexes, false );
+    std::mt19937                        random    ( 0 );
+    std::uniform_int_distribution<int>  choice    ( 0, 9 );
+    std::uniform_int_distribution<int>  step      ( 0, 1000 );
+    DbU::Unit                           last      = 0;
+    uint32_t                            pusheds   = 0;
+    DbU::Unit                           sequence  = 0;
+
+  // The low bits hold an operation counter, making the distances unique.
+    while ((pusheds < vertexes) or not queue.empty()) {
+      int draw = choice( random );
+      if ((pusheds < vertexes) and ((draw < 5) or queue.empty())) {
+        DbU::Unit distance = (((last >> 24) + step(random)) << 24) + (++sequence);
+        operations.push_back( QueueOperation { QueueOperation::Push, pusheds, distance } );
+        queue.insert( make_pair(distance,pusheds) );
+        queueds  [ pusheds   ] = true;
+        distances[ pusheds++ ] = distance;
+        continue;
+      }
+      if ((draw < 7) and pusheds) {
+        uint32_t  vertex = random() % pusheds;
+        DbU::Unit base   = (distances[vertex] >> 24) - (last >> 24);
+        if (queueds[vertex] and (base > 0)) {
+          DbU::Unit distance = (((last >> 24) + random() % base) << 24) + (++sequence);
+          queue.erase ( make_pair(distances[vertex],vertex) );
+          queue.insert( make_pair(distance,vertex) );
+          distances[ vertex ] = distance;
+          operations.push_back( QueueOperation { QueueOperation::Decrease, vertex, distance } );
+          continue;
+        }
+      }
+      last = queue.begin()->first;
+      operations.push_back( QueueOperation { QueueOperation::Pop, queue.begin()->second, last } );
+      queueds[ queue.begin()->second ] = false;
+      queue.erase( queue.begin() );
+    }
+    return operations;
+  }
+
+
+  int  benchDijkstraQueues ( const string& cellName )
+  {
+    Cell* cell = loadCell( cellName );
+    if (not cell) {
+      cerr << Error( "benchDijkstraQueues(): Unable to load Cell \"%s\".", cellName.c_str() ) << endl;
+      return 1;
+    }
+
+    size_t                  count      = 200000;
+    vector<QueueOperation>  operations = drawQueueOperations( count );
+    AnabaticEngine*         anabatic   = AnabaticEngine::create( cell );
+    GCell*                  gcell      = anabatic->getGCells()[0];
+    vector<Vertex*>         vertexes;
+    for ( size_t i=0 ; i<count ; ++i ) vertexes.push_back( new Vertex(gcell) );
+
+    int          failures  = 0;
+    const char*  labels[3] = { "heap  ", "bucket", "set   " };
+    for ( PriorityQueue::Kind kind : { PriorityQueue::Heap, PriorityQueue::Bucket, PriorityQueue::Set } ) {
+      PriorityQueue queue;
+      queue.setKind( kind );
+      size_t mismatches = 0;
+
+      auto start = std::chrono::steady_clock::now();
+      for ( const QueueOperation& operation : operations ) {
+        Vertex* vertex = vertexes[ operation._vertex ];
+        switch ( operation._kind ) {
+          case QueueOperation::Push:
+            vertex->setDistance( operation._distance );
+            queue.push( vertex );
+            break;
+          case QueueOperation::Decrease:
+            queue.erase( vertex );
+            vertex->setDistance( operation._distance );
+            queue.push( vertex );
+            break;
+          case QueueOperation::Pop:
+            if (queue.top() != vertex) ++mismatches;
+            queue.pop();
+            break;
+        }
+      }
+      double seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+      cerr << "  o  Dijkstra " << labels[kind] << " queue: " << Timer::getStringTime(seconds)
+           << " (" << operations.size() << " operations, " << mismatches << " out of order pops)" << endl;
+      if (mismatches) ++failures;
+    }
+
+    for ( Vertex* vertex : vertexes ) delete vertex;
+    anabatic->destroy();
+    return (failures) ? 1 : 0;
+  }
+
+// -------------------------------------------------------------------
+// Test  :  "testParallelQuery".
+//
+// The parallel Query driver must find the same Gos, with the same
+// transformations and in the same order, as the sequential walk, on
+// every basic layer. Done on the whole Cell, then on random windows
+// after the Cell has been prepared once.
+
+
+  class CollectQuery : public Query {
+    public:
+      inline                 CollectQuery        ();
+      virtual bool           hasGoCallback       () const;
+      virtual void           goCallback          ( Go* );
+      virtual void           extensionGoCallback ( Go* );
+      virtual void           masterCellCallback  ();
+      virtual Query*         clone               () const;
+      virtual void           merge               ( Query* );
+    public:
+      vector< pair<Go*,Box> >  _gos;
+  };
+
+
+  inline CollectQuery::CollectQuery ()
+    : Query()
+    , _gos ()
+  { }
+
+
+  bool    CollectQuery::hasGoCallback       () const { return true; }
+  void    CollectQuery::extensionGoCallback ( Go* ) { }
+  void    CollectQuery::masterCellCallback  () { }
+  Query*  CollectQuery::clone               () const { return new CollectQuery(); }
+
+
+  void  CollectQuery::goCallback ( Go* go )
+  { _gos.push_back( make_pair( go, getTransformation().getBox(go->getBoundingBox()) )); }
+
+
+  void  CollectQuery::merge ( Query* query )
+  {
+    CollectQuery* other = static_cast<CollectQuery*>( query );
+    _gos.insert( _gos.end(), other->_gos.begin(), other->_gos.end() );
+  }
+
+
+  int  testParallelQuery ( const string& cellName, unsigned int threads )
+  {
+    Cell* cell = loadCell( cellName );
+    if (not cell) {
+      cerr << Error( "testParallelQuery(): Unable to load Cell \"%s\".", cellName.c_str() ) << endl;
+      return 1;
+    }
+
+    Box                                  bb      = cell->getBoundingBox();
+    DbU::Unit                            side    = std::max( bb.getWidth(), bb.getHeight() ) / 10;
+    std::mt19937                         random  ( 0 );
+    std::uniform_int_distribution<long>  xrandom ( bb.getXMin(), bb.getXMax() );
+    std::uniform_int_distribution<long>  yrandom ( bb.getYMin(), bb.getYMax() );
+    vector<Box>                          windows ( 1, bb );
+    for ( size_t i=0 ; i<100 ; ++i ) {
+      DbU::Unit x = xrandom( random );
+      DbU::Unit y = yrandom( random );
+      windows.push_back( Box( x, y, x+side, y+side ));
+    }
+
+    size_t gos      = 0;
+    size_t failures = 0;
+    for ( size_t iwindow=0 ; iwindow<windows.size() ; ++iwindow ) {
+      if (iwindow == 1) Query::prepareConcurrent( cell );
+      for ( BasicLayer* layer : DataBase::getDB()->getTechnology()->getBasicLayers() ) {
+        CollectQuery sequential;
+        CollectQuery parallel;
+        for ( CollectQuery* query : { &sequential, &parallel } ) {
+          query->setQuery( cell, windows[iwindow], Transformation(), layer, 0
+                         , Query::DoComponents|Query::DoTerminalCells );
+        }
+        sequential.doQuery();
+        parallel  .doParallelQuery( threads, (iwindow > 0) );
+        gos += sequential._gos.size();
+        if (parallel._gos != sequential._gos) {
+          cerr << Error( "testParallelQuery(): Parallel walk of %s on %s differs (%u Gos instead of %u)."
+                       , getString(windows[iwindow]).c_str()
+                       , getString(layer->getName()).c_str()
+                       , (unsigned)parallel._gos.size()
+                       , (unsigned)sequential._gos.size() ) << endl;
+          ++failures;
+        }
+      }
+    }
+    cerr << "  o  Parallel queries: " << threads << " threads, " << windows.size() << " windows, "
+         << gos << " Gos, " << failures << " failure(s)." << endl;
+    return (failures) ? 1 : 0;
+  }
+
+// -------------------------------------------------------------------
+// Test  :  "testSharedNames".
+//
+// Concurrent interning of the same strings by several threads, in the
+// concurrent mode of the SharedName table. Each thread builds, copies
+// and drops the Names of a common set of strings. All the threads must
+// get the same SharedName for a given string, and once all the Names
+// are gone, the table must be back to its initial count.
+
+
+  int  testSharedNames ( unsigned int threads )
+  {
+    const size_t  count      = 1000;
+    const size_t  rounds     = 200;
+    bool          concurrent = SharedName::isConcurrent();
+    size_t        initial    = SharedName::getCount();
+    size_t        failures   = 0;
+
+    SharedName::setConcurrent( true );
+    {
+      vector< vector<Name> > results ( threads );
+      vector<std::thread>    workers;
+      for ( unsigned int i=0 ; i<threads ; ++i ) {
+        workers.push_back( std::thread( [&results,i,count,rounds]() {
+          vector<Name>& names = results[i];
+          for ( size_t round=0 ; round<rounds ; ++round ) {
+            vector<Name> locals;
+            for ( size_t j=0 ; j<count ; ++j ) {
+              size_t id = (j*7 + i + round) % count;
+              locals.push_back( Name( "shared_name_" + getString(id) ));
+              Name copy = locals.back();
+              locals.back() = copy;
+            }
+            if (round+1 == rounds) {
+              names.resize( count );
+              for ( size_t j=0 ; j<count ; ++j ) names[ (j*7 + i + round) % count ] = locals[j];
+            }
+          }
+        } ));
+      }
+      for ( std::thread& worker : workers ) worker.join();
+
+      for ( size_t j=0 ; j<count ; ++j ) {
+        for ( unsigned int i=1 ; i<threads ; ++i ) {
+          if (results[i][j] == results[0][j]) continue;
+          cerr << Error( "testSharedNames(): Thread %u has another SharedName for \"%s\"."
+                       , i, getString(results[0][j]).c_str() ) << endl;
+          ++failures;
+        }
+        if (getString(results[0][j]) != "shared_name_" + getString(j)) ++failures;
+      }
+    }
+    SharedName::setConcurrent( concurrent );
+
+    if (SharedName::getCount() != initial) {
+      cerr << Error( "testSharedNames(): %u SharedNames left instead of %u."
+                   , (unsigned)SharedName::getCount(), (unsigned)initial ) << endl;
+      ++failures;
+    }
+    cerr << "  o  Shared names: " << threads << " threads, " << count << " names, "
+         << failures << " failure(s)." << endl;
+    return (failures) ? 1 : 0;
+  }
+
+
+// -------------------------------------------------------------------
+// Benchmark  :  "benchSearchPath".
+//
+// Locate many cells spread over many library directories, without
+// then within a lookup pass (SearchPath::Pass, one stat() per
+// directory). Every cell must be found in it's own directory and a
+// missing one nowhere. A file created through a write mode locate()
+// must be found back at once, even in the second of the listing.
+
+
+  int  benchSearchPath ()
+  {
+    const size_t directories = 64;
+    const size_t cells       = 256;
+    const string root        = "search_path_bench";
+
+    SearchPath searchPath;
+    mkdir( root.c_str(), 0755 );
+    for ( size_t i=0 ; i<directories ; ++i ) {
+      string directory = root + "/lib" + getString(i);
+      mkdir( directory.c_str(), 0755 );
+      for ( size_t j=0 ; j<cells ; ++j )
+        ofstream( directory + "/cell_" + getString(i) + "_" + getString(j) + ".vst" );
+      searchPath.append( directory );
+    }
+
+    int failures = 0;
+    for ( size_t run=0 ; run<2 ; ++run ) {
+      auto start = std::chrono::steady_clock::now();
+      {
+        if (run) searchPath.beginPass();
+        for ( size_t i=0 ; i<directories ; ++i ) {
+          for ( size_t j=0 ; j<cells ; ++j ) {
+            if (searchPath.locate( "cell_" + getString(i) + "_" + getString(j) + ".vst" ) != i)
+              ++failures;
+          }
+          if (searchPath.locate( "missing_" + getString(i) + ".vst" ) != SearchPath::npos)
+            ++failures;
+        }
+        if (run) searchPath.endPass();
+      }
+      double seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+      cerr << "  o  SearchPath, " << (directories*(cells+1)) << " lookups in " << directories
+           << " directories" << ((run) ? " (one pass): " : ": ")
+           << Timer::getStringTime(seconds) << endl;
+    }
+
+    string added = "cell_added.vst";
+    if (searchPath.locate( added, ios::out|ios::trunc, directories-1 ) != directories-1) ++failures;
+    if (searchPath.locate( added ) != directories-1) ++failures;
+
+    cerr << "  o  SearchPath: " << failures << " failure(s)." << endl;
+    return (failures) ? 1 : 0;
+  }
+
+
+// -------------------------------------------------------------------
+// Test  :  "testPathIds".
+//
+// Dense SharedPath identifiers: the Cell is instanciated once in a new
+// top Cell, and the paths to all it's instances are built. They must
+// get distinct identifiers, find back their head path and be stored
+// in a PathIdVector. The identifier of a path destroyed along with
+// it's instance must be given to the next path created, and once the
+// top instance is replaced, the identifiers must all be recycled.
+
+
+  int  testPathIds ( const string& cellName )
+  {
+    Cell* cell = loadCell( cellName );
+    if (not cell) {
+      cerr << Error( "testPathIds(): Unable to load cell \"%s\".", cellName.c_str() ) << endl;
+      return 1;
+    }
+
+    size_t failures = 0;
+    UpdateSession::open();
+    Cell*     top  = Cell::create( cell->getLibrary(), cellName + "_path_ids" );
+    Instance* wrap = Instance::create( top, "wrap", cell );
+    UpdateSession::close();
+
+    auto checkPaths = [&]( Instance* wrap, PathIdVector<Instance*>& instances ) {
+      Path headPath ( wrap );
+      for ( Instance* instance : cell->getInstances() ) {
+        Path path ( headPath, instance );
+        if ( (path.getId() == 0) or instances.has(path) ) {
+          cerr << Error( "testPathIds(): Duplicate id %u for %s.", path.getId(), getString(path).c_str() ) << endl;
+          ++failures;
+        }
+        if (not (path.getHeadPath() == headPath)) {
+          cerr << Error( "testPathIds(): Wrong head path for %s.", getString(path).c_str() ) << endl;
+          ++failures;
+        }
+        if (Path(headPath,instance).getId() != path.getId()) ++failures;
+        instances[ path ] = instance;
+      }
+      if (instances.has(headPath)) ++failures;
+    };
+
+    PathIdVector<Instance*> instances;
+    checkPaths( wrap, instances );
+    uint32_t idsSize = SharedPath::getIdsSize();
+
+  // Destroying an instance releases it's own path and the one through
+  // the top instance, both identifiers are taken back by the newcomer.
+    Instance* victim   = cell->getInstance( "inst_0_0" );
+    uint32_t  freedId  = Path( Path(wrap), victim ).getId();
+    uint32_t  tailId   = Path( victim ).getId();
+    Cell*     master   = victim->getMasterCell();
+    instances.clear();
+    UpdateSession::open();
+    victim->destroy();
+    Instance* newcomer = Instance::create( cell, "inst_0_0_new", master );
+    UpdateSession::close();
+    uint32_t newId = Path( Path(wrap), newcomer ).getId();
+    if ((newId != freedId) and (newId != tailId)) {
+      cerr << Error( "testPathIds(): Identifier %u has not been recycled.", freedId ) << endl;
+      ++failures;
+    }
+
+    UpdateSession::open();
+    wrap->destroy();
+    wrap = Instance::create( top, "wrap_new", cell );
+    UpdateSession::close();
+    checkPaths( wrap, instances );
+    if (SharedPath::getIdsSize() != idsSize) {
+      cerr << Error( "testPathIds(): Identifiers grown from %u to %u, not recycled."
+                   , idsSize, SharedPath::getIdsSize() ) << endl;
+      ++failures;
+    }
+
+    cerr << "  o  Path ids: " << instances.size() << " paths, "
+         << failures << " failure(s)." << endl;
+    return (failures) ? 1 : 0;
+  }
+
+
+// -------------------------------------------------------------------
+// Test  :  "testHyperNetIndex".
+//
+// Incremental maintenance of the HyperNetIndex. The Cell is indexed,
+// then it's netlist is edited: plugs disconnected and reconnected,
+// an instance created and another destroyed, a net destroyed and two
+// nets merged. The hyper nets of the edited index must match the ones
+// of an index built from scratch, and an untouched hyper net must have
+// kept it's id (no full rebuild).
+
+
+  int  testHyperNetIndex ( const string& cellName )
+  {
+    Cell* cell = loadCell( cellName );
+    if (not cell) {
+      cerr << Error( "testHyperNetIndex(): Unable to load cell \"%s\".", cellName.c_str() ) << endl;
+      return 1;
+    }
+
+    cell->setHyperNetIndex( true );
+    HyperNetIndex* index     = cell->getHyperNetIndex();
+    Occurrence     untouched = Occurrence( cell->getNet("net_10_10") );
+    uint32_t       stableId  = index->getHyperNetId( untouched );
+    size_t         hyperNets = index->getHyperNetsSize();
+
+    auto getPlug = [&]( const string& name, const char* netName ) -> Plug* {
+      Instance* instance = cell->getInstance( name );
+      return instance->getPlug( instance->getMasterCell()->getNet(netName) );
+    };
+
+    UpdateSession::open();
+    getPlug( "inst_0_1", "i" )->setNet( NULL );
+    getPlug( "inst_0_1", "i" )->setNet( cell->getNet("net_0_5") );
+    Instance* extra = Instance::create( cell, "inst_extra", cell->getInstance("inst_0_0")->getMasterCell() );
+    extra->getPlug( extra->getMasterCell()->getNet("i") )->setNet( cell->getNet("net_1_1") );
+    extra->getPlug( extra->getMasterCell()->getNet("q") )->setNet( Net::create(cell,"net_extra") );
+    cell->getInstance( "inst_2_2" )->destroy();
+    cell->getNet( "net_3_3" )->destroy();
+    cell->getNet( "net_4_4" )->merge( cell->getNet("net_4_5") );
+    UpdateSession::close();
+
+    size_t failures = 0;
+  // A rebuild renumbers the hyper nets, an update appends the new ones.
+    if ( (index->getHyperNetId(untouched) != stableId) or (index->getHyperNetsSize() <= hyperNets) ) {
+      cerr << Error( "testHyperNetIndex(): The index has been rebuilt." ) << endl;
+      ++failures;
+    }
+
+    auto toSet = []( Occurrences occurrences ) {
+      set<Occurrence> occurrenceSet;
+      for ( Occurrence occurrence : occurrences ) occurrenceSet.insert( occurrence );
+      return occurrenceSet;
+    };
+
+    HyperNetIndex reference ( cell );
+    size_t        checkeds = 0;
+    for ( Net* net : cell->getNets() ) {
+      uint32_t id          = index    ->getHyperNetId( Occurrence(net) );
+      uint32_t referenceId = reference .getHyperNetId( Occurrence(net) );
+      if ( (id == HyperNetIndex::NoId) or (referenceId == HyperNetIndex::NoId) ) {
+        cerr << Error( "testHyperNetIndex(): %s is not indexed.", getString(net).c_str() ) << endl;
+        ++failures;
+        continue;
+      }
+      ++checkeds;
+      if (  (toSet(index->getNetOccurrences(id)) != toSet(reference.getNetOccurrences(referenceId)))
+         or (toSet(index->getTerminalNetlistPlugOccurrences(id))
+             != toSet(reference.getTerminalNetlistPlugOccurrences(referenceId))) ) {
+        cerr << Error( "testHyperNetIndex(): Hyper net of %s differs from the rebuilt one."
+                     , getString(net).c_str() ) << endl;
+        ++failures;
+      }
+    }
+    cell->setHyperNetIndex( false );
+
+    cerr << "  o  HyperNet index: " << checkeds << " hyper nets checked, "
+         << failures << " failure(s)." << endl;
+    return (failures) ? 1 : 0;
+  }
+
   
 }  // Anonymous namespace.
   
@@ -149,6 +1277,19 @@ int main ( int argc, char* argv[] )
     bool coreDump = false;
     bool rbTree   = false;
     bool intvTree = false;
+    bool names    = false;
+    bool search   = false;
+    string snapshotCell;
+    string frozenCell;
+    string gdsFile;
+    string gdsDedupCell;
+    string defDesign;
+    string rtreeCell;
+    string queuesCell;
+    string queryCell;
+    string pathIdsCell;
+    string hyperNetsCell;
+    unsigned int threads = 4;
 
     boptions::options_description options ("Command line arguments & options");
     options.add_options()
@@ -158,7 +1299,35 @@ int main ( int argc, char* argv[] )
       ( "rb-tree"    , boptions::bool_switch(&rbTree  )->default_value(false)
                      , "Test of the red/black tree \"hurricane/RbTree.h\".")
       ( "intv-tree"  , boptions::bool_switch(&intvTree)->default_value(false)
-                     , "Test of the interval tree \"hurricane/IntervalTree.h\".");
+                     , "Test of the interval tree \"hurricane/IntervalTree.h\".")
+      ( "search-path", boptions::bool_switch(&search  )->default_value(false)
+                     , "Benchmark the cell lookup through a SearchPath of many directories.")
+      ( "names"      , boptions::bool_switch(&names   )->default_value(false)
+                     , "Concurrent interning in the SharedName table (--threads).")
+      ( "snapshot"   , boptions::value<string>(&snapshotCell)
+                     , "Benchmark the binary snapshot against JSON on the given (flat) Cell.")
+      ( "frozen"     , boptions::value<string>(&frozenCell)
+                     , "Concurrent readers on the frozen DataBase, walking the given Cell.")
+      ( "gds"        , boptions::value<string>(&gdsFile)
+                     , "Benchmark the GDSII loader throughput on the given file, check the parallel load.")
+      ( "def"        , boptions::value<string>(&defDesign)
+                     , "Benchmark the DEF import, plain against bulk load, on the given design.")
+      ( "gds-dedup"  , boptions::value<string>(&gdsDedupCell)
+                     , "Check that the GDSII deduplication keeps distinct empty structures (given Cell).")
+      ( "rtree"      , boptions::value<string>(&rtreeCell)
+                     , "Benchmark the QuadTree against the packed R-tree on the given Cell.")
+      ( "parallel-query", boptions::value<string>(&queryCell)
+                     , "Check the parallel Query driver against the sequential one on the given Cell.")
+      ( "path-ids"   , boptions::value<string>(&pathIdsCell)
+                     , "Dense path identifiers and their recycling, on the given Cell.")
+      ( "hypernet-index", boptions::value<string>(&hyperNetsCell)
+                     , "Incremental HyperNetIndex against a rebuilt one, on the given Cell.")
+      ( "dijkstra-queues", boptions::value<string>(&queuesCell)
+                     , "Replay a Dijkstra queue sequence on the priority queues (AnabaticEngine on the given Cell).")
+      ( "generate"   , boptions::bool_switch(&generateCells)->default_value(false)
+                     , "Generate the Cells given to the options below instead of loading them.")
+      ( "threads"    , boptions::value<unsigned int>(&threads)
+                     , "Number of threads for the concurrent tests (default 4).");
 
     boptions::variables_map arguments;
     boptions::store ( boptions::parse_command_line(argc,argv,options), arguments );
@@ -175,6 +1344,18 @@ int main ( int argc, char* argv[] )
 
     if (rbTree  ) returnCode += testRbTree();
     if (intvTree) returnCode += testIntervalTree();
+    if (names   ) returnCode += testSharedNames( threads );
+    if (search  ) returnCode += benchSearchPath();
+    if (not snapshotCell.empty()) returnCode += benchSnapshot( snapshotCell );
+    if (not frozenCell.empty()) returnCode += testFrozen( frozenCell, threads );
+    if (not gdsFile.empty()) returnCode += benchGds( gdsFile, threads );
+    if (not gdsDedupCell.empty()) returnCode += testGdsDedup( gdsDedupCell );
+    if (not defDesign.empty()) returnCode += benchDefImport( defDesign );
+    if (not rtreeCell.empty()) returnCode += benchRTree( rtreeCell );
+    if (not queuesCell.empty()) returnCode += benchDijkstraQueues( queuesCell );
+    if (not queryCell.empty()) returnCode += testParallelQuery( queryCell, threads );
+    if (not pathIdsCell.empty()) returnCode += testPathIds( pathIdsCell );
+    if (not hyperNetsCell.empty()) returnCode += testHyperNetIndex( hyperNetsCell );
 
     DebugSession::close();
   }